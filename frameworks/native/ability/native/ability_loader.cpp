@@ -26,12 +26,14 @@ AbilityLoader &AbilityLoader::GetInstance()
 
 void AbilityLoader::RegisterAbility(const std::string &abilityName, const CreateAblity &createFunc)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     abilities_.insert_or_assign(abilityName, createFunc);
     TAG_LOGD(AAFwkTag::ABILITY, "AbilityLoader::RegisterAbility:%{public}s", abilityName.c_str());
 }
 
 void AbilityLoader::RegisterExtension(const std::string &abilityName, const CreateExtension &createFunc)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     extensions_.emplace(abilityName, createFunc);
     TAG_LOGD(AAFwkTag::ABILITY, "AbilityLoader::RegisterExtension:%{public}s", abilityName.c_str());
 }
@@ -39,14 +41,22 @@ void AbilityLoader::RegisterExtension(const std::string &abilityName, const Crea
 void AbilityLoader::RegisterUIAbility(const std::string &abilityName, const CreateUIAbility &createFunc)
 {
     TAG_LOGD(AAFwkTag::ABILITY, "RegisterUIAbility: %{public}s", abilityName.c_str());
+    std::lock_guard<std::mutex> lock(mutex_);
     uiAbilities_.emplace(abilityName, createFunc);
 }
 
 Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
 {
-    auto it = abilities_.find(abilityName);
-    if (it != abilities_.end()) {
-        return it->second();
+    CreateAblity createFunc;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = abilities_.find(abilityName);
+        if (it != abilities_.end()) {
+            createFunc = it->second;
+        }
+    }
+    if (createFunc) {
+        return createFunc();
     }
     TAG_LOGE(AAFwkTag::ABILITY, "AbilityLoader::GetAbilityByName failed:%{public}s", abilityName.c_str());
     return nullptr;
@@ -54,9 +64,16 @@ Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
 
 AbilityRuntime::Extension *AbilityLoader::GetExtensionByName(const std::string &abilityName)
 {
-    auto it = extensions_.find(abilityName);
-    if (it != extensions_.end()) {
-        return it->second();
+    CreateExtension createFunc;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = extensions_.find(abilityName);
+        if (it != extensions_.end()) {
+            createFunc = it->second;
+        }
+    }
+    if (createFunc) {
+        return createFunc();
     }
     TAG_LOGE(AAFwkTag::ABILITY, "AbilityLoader::GetExtensionByName failed:%{public}s", abilityName.c_str());
     return nullptr;
@@ -64,9 +81,16 @@ AbilityRuntime::Extension *AbilityLoader::GetExtensionByName(const std::string &
 
 AbilityRuntime::UIAbility *AbilityLoader::GetUIAbilityByName(const std::string &abilityName)
 {
-    auto it = uiAbilities_.find(abilityName);
-    if (it != uiAbilities_.end()) {
-        return it->second();
+    CreateUIAbility createFunc;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = uiAbilities_.find(abilityName);
+        if (it != uiAbilities_.end()) {
+            createFunc = it->second;
+        }
+    }
+    if (createFunc) {
+        return createFunc();
     }
     TAG_LOGE(AAFwkTag::ABILITY, "GetAbilityByName failed: %{public}s", abilityName.c_str());
     return nullptr;
@@ -15,6 +15,8 @@
 
 #include "idle_time.h"
 
+#include <algorithm>
+
 #include "hilog_tag_wrapper.h"
 #ifdef SUPPORT_SCREEN
 #include "transaction/rs_interfaces.h"
@@ -24,6 +26,9 @@ namespace AppExecFwk {
 namespace {
 constexpr int64_t MS_PER_NS = 1000000;
 constexpr int32_t MAX_PERIOD_COUNT = 10;
+constexpr int64_t DEFAULT_IDLE_TASK_DEADLINE_MS = 3000;
+// left at the end of an idle window so that idle tasks do not run into the next frame.
+constexpr int64_t IDLE_TASK_RESERVED_NS = 1000000;
 }
 
 IdleTime::IdleTime(const std::shared_ptr<EventHandler> &eventHandler, IdleTimeCallback idleTimeCallback)
@@ -63,11 +68,6 @@ void IdleTime::EventTask()
         return;
     }
 
-    if (callback_ == nullptr) {
-        TAG_LOGE(AAFwkTag::APPKIT, "no callback_");
-        return;
-    }
-
     int64_t period = 0;
     int64_t lastVSyncTime = 0;
 #ifdef SUPPORT_SCREEN
@@ -84,6 +84,9 @@ void IdleTime::EventTask()
         TAG_LOGD(
             AAFwkTag::APPKIT, "EventTask idleTime %{public}" PRId64 ", cycle is %{public}" PRId64, idleTime, cycle);
         if (idleTime > 0 && cycle < MAX_PERIOD_COUNT) {
+            idleTime = RunIdleTasks(idleTime);
+        }
+        if (idleTime > 0 && cycle < MAX_PERIOD_COUNT && callback_ != nullptr) {
             TAG_LOGD(AAFwkTag::APPKIT, "callback_");
             callback_(idleTime / MS_PER_NS);
         }
@@ -130,6 +133,97 @@ bool IdleTime::GetNeedStop()
     return needStop_;
 }
 
+bool IdleTime::PostIdleTask(const std::string &name, IdleTaskFunc task, int64_t costMs, int64_t deadlineMs)
+{
+    if (task == nullptr || eventHandler_ == nullptr) {
+        TAG_LOGE(AAFwkTag::APPKIT, "null task or eventHandler_");
+        return false;
+    }
+    if (deadlineMs <= 0) {
+        deadlineMs = DEFAULT_IDLE_TASK_DEADLINE_MS;
+    }
+
+    uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(idleTaskMutex_);
+        id = ++idleTaskId_;
+        IdleTask idleTask = { id, name, std::move(task), std::max<int64_t>(costMs, 0) * MS_PER_NS };
+        idleTasks_.emplace(GetSysTimeNs() + deadlineMs * MS_PER_NS, std::move(idleTask));
+    }
+
+    std::weak_ptr<IdleTime> weak(shared_from_this());
+    auto deadlineTask = [weak, id]() {
+        auto idleTime = weak.lock();
+        if (idleTime == nullptr) {
+            TAG_LOGE(AAFwkTag::APPKIT, "idleTime is nullptr");
+            return;
+        }
+        idleTime->RunExpiredIdleTask(id);
+    };
+    eventHandler_->PostTask(deadlineTask, "IdleTime:IdleTaskDeadline", deadlineMs);
+    return true;
+}
+
+void IdleTime::RemoveIdleTask(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(idleTaskMutex_);
+    for (auto iter = idleTasks_.begin(); iter != idleTasks_.end();) {
+        if (iter->second.name == name) {
+            iter = idleTasks_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+size_t IdleTime::GetIdleTaskCount()
+{
+    std::lock_guard<std::mutex> lock(idleTaskMutex_);
+    return idleTasks_.size();
+}
+
+int64_t IdleTime::RunIdleTasks(int64_t idleTimeNs)
+{
+    int64_t idleEndTime = GetSysTimeNs() + idleTimeNs;
+    while (true) {
+        IdleTask idleTask;
+        int64_t now = GetSysTimeNs();
+        {
+            std::lock_guard<std::mutex> lock(idleTaskMutex_);
+            // earliest deadline first among the tasks that fit in what is left of the window.
+            auto iter = std::find_if(idleTasks_.begin(), idleTasks_.end(), [now, idleEndTime](const auto &item) {
+                return now + item.second.costNs + IDLE_TASK_RESERVED_NS <= idleEndTime;
+            });
+            if (iter == idleTasks_.end()) {
+                break;
+            }
+            idleTask = std::move(iter->second);
+            idleTasks_.erase(iter);
+        }
+        TAG_LOGD(AAFwkTag::APPKIT, "run idle task %{public}s", idleTask.name.c_str());
+        idleTask.task();
+    }
+    return std::max<int64_t>(idleEndTime - GetSysTimeNs(), 0);
+}
+
+void IdleTime::RunExpiredIdleTask(uint64_t id)
+{
+    IdleTask idleTask;
+    {
+        std::lock_guard<std::mutex> lock(idleTaskMutex_);
+        auto iter = std::find_if(idleTasks_.begin(), idleTasks_.end(), [id](const auto &item) {
+            return item.second.id == id;
+        });
+        if (iter == idleTasks_.end()) {
+            return;
+        }
+        idleTask = std::move(iter->second);
+        idleTasks_.erase(iter);
+    }
+    TAG_LOGI(AAFwkTag::APPKIT, "idle task %{public}s reach deadline", idleTask.name.c_str());
+    idleTask.task();
+}
+
 IdleNotifyStatusCallback IdleTime::GetIdleNotifyFunc()
 {
     IdleNotifyStatusCallback cb = [this](bool needStop) {
@@ -15,12 +15,15 @@
 
 #include "main_thread.h"
 
+#include <chrono>
+#include <cinttypes>
 #include <malloc.h>
 #include <new>
 #include <regex>
 #include <sys/prctl.h>
 #include <sys/wait.h>
 #include <sys/types.h>
+#include <thread>
 #include <unistd.h>
 
 #include "ability_manager_client.h"
@@ -56,6 +59,7 @@
 #include "ffrt.h"
 #include "file_path_utils.h"
 #include "freeze_util.h"
+#include "hap_path_cache.h"
 #include "hilog_tag_wrapper.h"
 #include "resource_config_helper.h"
 #ifdef SUPPORT_SCREEN
@@ -157,6 +161,7 @@ const std::string SIGNAL_HANDLER = "OS_SignalHandler";
 constexpr uint32_t CHECK_MAIN_THREAD_IS_ALIVE = 1;
 
 const std::string OVERLAY_STATE_CHANGED = "usual.event.OVERLAY_STATE_CHANGED";
+constexpr int64_t SUBSCRIBE_OVERLAY_CHANGE_COST_MS = 2;
 const std::string JSON_KEY_APP_FONT_SIZE_SCALE = "fontSizeScale";
 const std::string JSON_KEY_APP_FONT_MAX_SCALE = "fontSizeMaxScale";
 const std::string JSON_KEY_APP_CONFIGURATION = "configuration";
@@ -167,6 +172,12 @@ const int32_t TYPE_OTHERS = 2;
 
 extern "C" int DFX_SetAppRunningUniqueId(const char* appRunningId, size_t len) __attribute__((weak));
 
+// the module loader of an extension plugin, resolved when the first extension of its type is created.
+struct LazyExtensionModuleLoader {
+    std::once_flag resolved;
+    AbilityRuntime::ExtensionModuleLoader *loader = nullptr;
+};
+
 std::string GetLibPath(const std::string &hapPath, bool isPreInstallApp)
 {
     std::string libPath = LOCAL_CODE_PATH;
@@ -1182,8 +1193,14 @@ void MainThread::SubscribeOverlayChange(const std::string &bundleName, const std
         appThread->OnOverlayChanged(data, resourceManager, bundleName, moduleName, loadPath);
     };
     auto subscriber = std::make_shared<OverlayEventSubscriber>(subscribeInfo, callback);
-    bool subResult = EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber);
-    TAG_LOGD(AAFwkTag::APPKIT, "Overlay event subscriber register result is %{public}d", subResult);
+    // only later overlay changes are listened to, keep the common event ipc off the first frame.
+    auto subscribeTask = [subscriber]() {
+        bool subResult = EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber);
+        TAG_LOGD(AAFwkTag::APPKIT, "Overlay event subscriber register result is %{public}d", subResult);
+    };
+    if (!PostIdleTask("MainThread:SubscribeOverlayChange", subscribeTask, SUBSCRIBE_OVERLAY_CHANGE_COST_MS)) {
+        subscribeTask();
+    }
 }
 
 void MainThread::OnOverlayChanged(const EventFwk::CommonEventData &data,
@@ -1694,6 +1711,10 @@ void MainThread::HandleLaunchApplication(const AppLaunchData &appLaunchData, con
 #endif
             auto& jsEngine = (static_cast<AbilityRuntime::JsRuntime&>(*application_->GetRuntime())).GetNativeEngine();
             if (application_ != nullptr) {
+#ifdef ABILITY_LIBRARY_LOADER
+                // the extensions registered by the static constructors of the libraries take precedence.
+                WaitAbilityLibraryPreloaded();
+#endif
                 LoadAllExtensions(jsEngine);
             }
 
@@ -1787,6 +1808,10 @@ void MainThread::HandleLaunchApplication(const AppLaunchData &appLaunchData, con
     applicationImpl_->SetRecordId(appLaunchData.GetRecordId());
     applicationImpl_->SetApplication(application_);
     mainThreadState_ = MainThreadState::READY;
+#ifdef ABILITY_LIBRARY_LOADER
+    // the libraries were opened while the runtime was created, abilities may be created from them from now on.
+    WaitAbilityLibraryPreloaded();
+#endif
     if (!applicationImpl_->PerformAppReady()) {
         TAG_LOGE(AAFwkTag::APPKIT, "applicationImpl_->PerformAppReady failed");
         return;
@@ -1886,31 +1911,109 @@ void MainThread::LoadNativeLiabrary(const BundleInfo &bundleInfo, std::string &n
         return;
     }
 
-    void *handleAbilityLib = nullptr;
-    for (auto fileEntry : nativeFileEntries_) {
+    std::vector<AbilityLibraryItem> items;
+    for (const auto &fileEntry : nativeFileEntries_) {
         if (fileEntry.empty()) {
             continue;
         }
-        handleAbilityLib = dlopen(fileEntry.c_str(), RTLD_NOW | RTLD_GLOBAL);
+        AbilityLibraryItem item;
+        item.file = fileEntry;
+        if (fileEntry.find("libformrender.z.so") != std::string::npos) {
+            item.fallbackFile = FORM_RENDER_LIB_PATH;
+        }
+        items.emplace_back(std::move(item));
+    }
+    PreloadAbilityLibraries(std::move(items));
+}
+
+void MainThread::PreloadAbilityLibraries(std::vector<AbilityLibraryItem> &&items)
+{
+    if (items.empty()) {
+        return;
+    }
+    auto promise = std::make_shared<std::promise<void>>();
+    auto previous = abilityLibraryPreloaded_;
+    abilityLibraryPreloaded_ = promise->get_future().share();
+    std::thread([items = std::move(items), previous, state = abilityLibraryPreloadState_, promise]() {
+        HITRACE_METER_NAME(HITRACE_TAG_APP, "MainThread::PreloadAbilityLibraries");
+        if (previous.valid()) {
+            previous.wait();
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->fatalFile.empty()) {
+                promise->set_value();
+                return;
+            }
+        }
+        std::vector<void *> handles;
+        std::string fatalFile;
+        OpenAbilityLibraries(items, handles, fatalFile);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->handles.insert(state->handles.end(), handles.begin(), handles.end());
+            state->fatalFile = fatalFile;
+        }
+        promise->set_value();
+    }).detach();
+}
+
+bool MainThread::OpenAbilityLibraries(const std::vector<AbilityLibraryItem> &items, std::vector<void *> &handles,
+    std::string &fatalFile)
+{
+    for (const auto &item : items) {
+        auto begin = std::chrono::steady_clock::now();
+        int32_t flags = item.isGlobal ? (RTLD_NOW | RTLD_GLOBAL) : (RTLD_NOW | RTLD_LOCAL);
+        const std::string *file = &item.file;
+        void *handleAbilityLib = dlopen(file->c_str(), flags);
+        if (handleAbilityLib == nullptr && !item.fallbackFile.empty()) {
+            TAG_LOGD(AAFwkTag::APPKIT, "fail to dlopen %{public}s, try %{public}s",
+                item.file.c_str(), item.fallbackFile.c_str());
+            file = &item.fallbackFile;
+            handleAbilityLib = dlopen(file->c_str(), flags);
+        }
         if (handleAbilityLib == nullptr) {
-            if (fileEntry.find("libformrender.z.so") == std::string::npos) {
-                TAG_LOGE(AAFwkTag::APPKIT, "fail to dlopen %{public}s, [%{public}s]",
-                    fileEntry.c_str(), dlerror());
-                exit(-1);
-            } else {
-                TAG_LOGD(AAFwkTag::APPKIT, "Load libformrender.z.so from native lib path.");
-                handleAbilityLib = dlopen(FORM_RENDER_LIB_PATH, RTLD_NOW | RTLD_GLOBAL);
-                if (handleAbilityLib == nullptr) {
-                    TAG_LOGE(AAFwkTag::APPKIT, "fail to dlopen %{public}s, [%{public}s]",
-                        FORM_RENDER_LIB_PATH, dlerror());
-                    exit(-1);
-                }
-                fileEntry = FORM_RENDER_LIB_PATH;
+            TAG_LOGE(AAFwkTag::APPKIT, "Fail to dlopen %{public}s, [%{public}s]", file->c_str(), dlerror());
+            if (item.isFatal) {
+                fatalFile = *file;
+                return false;
             }
+            continue;
         }
-        TAG_LOGD(AAFwkTag::APPKIT, "success to dlopen %{public}s", fileEntry.c_str());
-        handleAbilityLib_.emplace_back(handleAbilityLib);
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        TAG_LOGI(AAFwkTag::APPKIT, "Success to dlopen %{public}s, cost %{public}" PRId64 "us",
+            file->c_str(), static_cast<int64_t>(cost));
+        handles.emplace_back(handleAbilityLib);
+    }
+    return true;
+}
+
+void MainThread::WaitAbilityLibraryPreloaded()
+{
+    if (!abilityLibraryPreloaded_.valid()) {
+        return;
+    }
+    HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
+    auto begin = std::chrono::steady_clock::now();
+    abilityLibraryPreloaded_.wait();
+    abilityLibraryPreloaded_ = std::shared_future<void>();
+    std::string fatalFile;
+    {
+        std::lock_guard<std::mutex> lock(abilityLibraryPreloadState_->mutex);
+        handleAbilityLib_.insert(handleAbilityLib_.end(),
+            abilityLibraryPreloadState_->handles.begin(), abilityLibraryPreloadState_->handles.end());
+        abilityLibraryPreloadState_->handles.clear();
+        fatalFile = abilityLibraryPreloadState_->fatalFile;
+    }
+    if (!fatalFile.empty()) {
+        TAG_LOGE(AAFwkTag::APPKIT, "Fail to preload %{public}s, exit", fatalFile.c_str());
+        exit(-1);
     }
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    TAG_LOGI(AAFwkTag::APPKIT, "ability libraries preloaded, %{public}zu opened, waited %{public}" PRId64 "ms",
+        handleAbilityLib_.size(), static_cast<int64_t>(cost));
 }
 #endif
 
@@ -1950,6 +2053,8 @@ void MainThread::HandleUpdateApplicationInfoInstalled(const ApplicationInfo &app
         return;
     }
     application_->UpdateApplicationInfoInstalled(appInfo);
+    // the hap and hsp paths may change with the new version, resolve them again on next use.
+    AbilityRuntime::HapPathCache::GetInstance().Clear();
 
     if (!appMgr_ || !applicationImpl_) {
         TAG_LOGE(AAFwkTag::APPKIT, "appMgr_ is nullptr");
@@ -1997,11 +2102,20 @@ void MainThread::LoadAllExtensions(NativeEngine &nativeEngine)
 
         std::string file = item.extensionLibFile;
         std::weak_ptr<OHOSApplication> wApp = application_;
+        auto lazyLoader = std::make_shared<LazyExtensionModuleLoader>();
         AbilityLoader::GetInstance().RegisterExtension(item.extensionName,
-            [wApp, file]() -> AbilityRuntime::Extension* {
+            [wApp, file, lazyLoader]() -> AbilityRuntime::Extension* {
             auto app = wApp.lock();
             if (app != nullptr) {
-                return AbilityRuntime::ExtensionModuleLoader::GetLoader(file.c_str()).Create(app->GetRuntime());
+                std::call_once(lazyLoader->resolved, [&file, &lazyLoader]() {
+                    auto begin = std::chrono::steady_clock::now();
+                    lazyLoader->loader = &AbilityRuntime::ExtensionModuleLoader::GetLoader(file.c_str());
+                    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - begin).count();
+                    TAG_LOGI(AAFwkTag::APPKIT, "resolve extension module %{public}s, cost %{public}" PRId64 "us",
+                        file.c_str(), static_cast<int64_t>(cost));
+                });
+                return lazyLoader->loader->Create(app->GetRuntime());
             }
             TAG_LOGE(AAFwkTag::APPKIT, "failed.");
             return nullptr;
@@ -2658,6 +2772,19 @@ void MainThread::PreloadExtensionPlugin()
     AbilityRuntime::ExtensionPluginInfo::GetInstance().Preload();
 }
 
+bool MainThread::PostIdleTask(const std::string &name, const IdleTaskFunc &task, int64_t costMs, int64_t deadlineMs)
+{
+    if (idleTime_ != nullptr) {
+        return idleTime_->PostIdleTask(name, task, costMs, deadlineMs);
+    }
+    // no VSync driven idle time, e.g. cj app, fall back to an idle priority task.
+    if (mainHandler_ == nullptr || task == nullptr) {
+        TAG_LOGE(AAFwkTag::APPKIT, "null mainHandler_ or task");
+        return false;
+    }
+    return mainHandler_->PostTask(task, name, 0, EventQueue::Priority::IDLE);
+}
+
 MainThread::MainHandler::MainHandler(const std::shared_ptr<EventRunner> &runner, const sptr<MainThread> &thread)
     : AppExecFwk::EventHandler(runner), mainThreadObj_(thread)
 {}
@@ -2711,8 +2838,9 @@ void MainThread::LoadAbilityLibrary(const std::vector<std::string> &libraryPaths
     HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
 #ifdef ABILITY_LIBRARY_LOADER
     TAG_LOGD(AAFwkTag::APPKIT, "start");
+    std::vector<AbilityLibraryItem> items;
 #ifdef SUPPORT_SCREEN
-    LoadAceAbilityLibrary();
+    LoadAceAbilityLibrary(items);
 #endif
     size_t size = libraryPaths.size();
     for (size_t index = 0; index < size; index++) {
@@ -2729,12 +2857,26 @@ void MainThread::LoadAbilityLibrary(const std::vector<std::string> &libraryPaths
 
     if (fileEntries_.empty()) {
         TAG_LOGD(AAFwkTag::APPKIT, "No ability library");
-        return;
     }
+    GetAbilityLibraryItems(fileEntries_, items);
+    PreloadAbilityLibraries(std::move(items));
+#endif  // ABILITY_LIBRARY_LOADER
+}
 
+void MainThread::LoadAceAbilityLibrary(std::vector<AbilityLibraryItem> &items)
+{
+    AbilityLibraryItem item;
+    item.file = Ace::AceForwardCompatibility::GetAceLibName();
+    item.isGlobal = false;
+    item.isFatal = false;
+    items.emplace_back(std::move(item));
+}
+
+void MainThread::GetAbilityLibraryItems(const std::vector<std::string> &fileEntries,
+    std::vector<AbilityLibraryItem> &items)
+{
     char resolvedPath[PATH_MAX] = {0};
-    void *handleAbilityLib = nullptr;
-    for (const auto& fileEntry : fileEntries_) {
+    for (const auto& fileEntry : fileEntries) {
         if (fileEntry.empty() || fileEntry.size() >= PATH_MAX) {
             continue;
         }
@@ -2742,29 +2884,9 @@ void MainThread::LoadAbilityLibrary(const std::vector<std::string> &libraryPaths
             TAG_LOGE(AAFwkTag::APPKIT, "Failed to get realpath, errno = %{public}d", errno);
             continue;
         }
-
-        handleAbilityLib = dlopen(resolvedPath, RTLD_NOW | RTLD_GLOBAL);
-        if (handleAbilityLib == nullptr) {
-            TAG_LOGE(AAFwkTag::APPKIT, "Fail to dlopen %{public}s, [%{public}s]",
-                resolvedPath, dlerror());
-            exit(-1);
-        }
-        TAG_LOGI(AAFwkTag::APPKIT, "Success to dlopen %{public}s", fileEntry.c_str());
-        handleAbilityLib_.emplace_back(handleAbilityLib);
-    }
-#endif  // ABILITY_LIBRARY_LOADER
-}
-
-void MainThread::LoadAceAbilityLibrary()
-{
-    void *AceAbilityLib = nullptr;
-    const char *path = Ace::AceForwardCompatibility::GetAceLibName();
-    AceAbilityLib = dlopen(path, RTLD_NOW | RTLD_LOCAL);
-    if (AceAbilityLib == nullptr) {
-        TAG_LOGE(AAFwkTag::APPKIT, "Fail to dlopen %{public}s, [%{public}s]", path, dlerror());
-    } else {
-        TAG_LOGD(AAFwkTag::APPKIT, "Success to dlopen %{public}s", path);
-        handleAbilityLib_.emplace_back(AceAbilityLib);
+        AbilityLibraryItem item;
+        item.file = resolvedPath;
+        items.emplace_back(std::move(item));
     }
 }
 
@@ -2772,6 +2894,8 @@ void MainThread::LoadAppLibrary()
 {
     HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
 #ifdef APPLICATION_LIBRARY_LOADER
+    // the application library links against the ability libraries opened with global symbols.
+    WaitAbilityLibraryPreloaded();
     std::string appPath = applicationLibraryPath;
     TAG_LOGI(AAFwkTag::APPKIT, "calling dlopen. appPath=%{public}s", appPath.c_str());
     handleAppLib_ = dlopen(appPath.c_str(), RTLD_NOW | RTLD_GLOBAL);
@@ -2795,26 +2919,9 @@ void MainThread::LoadAppDetailAbilityLibrary(std::string &nativeLibraryPath)
         TAG_LOGW(AAFwkTag::APPKIT, "No ability library");
         return;
     }
-    char resolvedPath[PATH_MAX] = {0};
-    void *handleAbilityLib = nullptr;
-    for (const auto& fileEntry : fileEntries) {
-        if (fileEntry.empty() || fileEntry.size() >= PATH_MAX) {
-            continue;
-        }
-        if (realpath(fileEntry.c_str(), resolvedPath) == nullptr) {
-            TAG_LOGE(AAFwkTag::APPKIT, "Failed to get realpath, errno = %{public}d", errno);
-            continue;
-        }
-
-        handleAbilityLib = dlopen(resolvedPath, RTLD_NOW | RTLD_GLOBAL);
-        if (handleAbilityLib == nullptr) {
-            TAG_LOGE(AAFwkTag::APPKIT, "Fail to dlopen %{public}s, [%{public}s]",
-                resolvedPath, dlerror());
-            exit(-1);
-        }
-        TAG_LOGI(AAFwkTag::APPKIT, "Success to dlopen %{public}s", fileEntry.c_str());
-        handleAbilityLib_.emplace_back(handleAbilityLib);
-    }
+    std::vector<AbilityLibraryItem> items;
+    GetAbilityLibraryItems(fileEntries, items);
+    PreloadAbilityLibraries(std::move(items));
 #endif // ABILITY_LIBRARY_LOADER
 }
 
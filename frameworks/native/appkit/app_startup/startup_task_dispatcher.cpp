@@ -15,12 +15,23 @@
 
 #include "startup_task_dispatcher.h"
 
+#include <chrono>
+#include <cinttypes>
+
 #include "event_handler.h"
 #include "hilog_tag_wrapper.h"
 #include "startup_manager.h"
 
 namespace OHOS {
 namespace AbilityRuntime {
+namespace {
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
 StartupTaskDispatcher::StartupTaskDispatcher(const std::map<std::string, std::shared_ptr<StartupTask>> &tasks,
     const std::shared_ptr<StartupSortResult> &sortResult) : tasks_(tasks), sortResult_(sortResult)
 {}
@@ -42,7 +53,8 @@ int32_t StartupTaskDispatcher::Run(const std::shared_ptr<OnCompletedCallback> &c
             TAG_LOGE(AAFwkTag::STARTUP, "startup task %{public}s is nullptr", iter.first.c_str());
             return ERR_STARTUP_INTERNAL_ERROR;
         }
-        inDegreeMap_.emplace(iter.first, iter.second->getDependenciesCount());
+        inDegreeMap_.emplace(std::piecewise_construct, std::forward_as_tuple(iter.first),
+            std::forward_as_tuple(iter.second->getDependenciesCount()));
         if (iter.second->GetWaitOnMainThread()) {
             mainThreadAwaitCount_++;
         }
@@ -93,22 +105,24 @@ void StartupTaskDispatcher::Dispatch(const std::string &name, const std::shared_
         OnError(ERR_STARTUP_INTERNAL_ERROR, name + " not found");
         return;
     }
+    RecordTaskEnd(name);
     if (NotifyChildren(name, result) != ERR_OK) {
         return;
     }
 
     if (findResult->second->GetWaitOnMainThread()) {
-        mainThreadAwaitCount_--;
-        TAG_LOGD(AAFwkTag::STARTUP, "mainThreadAwaitCount_ %{public}d.", mainThreadAwaitCount_);
-        if (mainThreadAwaitCount_ == 0) {
+        uint32_t mainThreadAwaitCount = --mainThreadAwaitCount_;
+        TAG_LOGD(AAFwkTag::STARTUP, "mainThreadAwaitCount_ %{public}u.", mainThreadAwaitCount);
+        if (mainThreadAwaitCount == 0) {
             if (mainThreadAwaitCallback_ != nullptr) {
                 mainThreadAwaitCallback_->Call(result);
             }
         }
     }
-    tasksCount_--;
-    TAG_LOGD(AAFwkTag::STARTUP, "tasksCount_ %{public}d.", tasksCount_);
-    if (tasksCount_ == 0) {
+    uint32_t tasksCount = --tasksCount_;
+    TAG_LOGD(AAFwkTag::STARTUP, "tasksCount_ %{public}u.", tasksCount);
+    if (tasksCount == 0) {
+        ReportCriticalPath();
         if (completedCallback_ != nullptr) {
             completedCallback_->Call(result);
         }
@@ -143,8 +157,8 @@ int32_t StartupTaskDispatcher::NotifyChildren(const std::string &name, const std
             return ERR_STARTUP_INTERNAL_ERROR;
         }
         childStartupTask->second->RunTaskOnDependencyCompleted(name, result);
-        childFindResult->second--;
-        if (childFindResult->second == 0) {
+        // only the completion that releases the last dependency may start the child.
+        if (childFindResult->second.fetch_sub(1) == 1) {
             zeroInDegree.emplace_back(childStartupTask->second);
         }
     }
@@ -171,6 +185,7 @@ int32_t StartupTaskDispatcher::RunTaskInit(const std::string &name, const std::s
     });
     StartupTask::State state = task->GetState();
     if (state == StartupTask::State::CREATED) {
+        RecordTaskStart(name);
         return task->RunTaskInit(std::move(callback));
     } else if (state == StartupTask::State::INITIALIZED) {
         callback->Call(task->GetResult());
@@ -184,6 +199,74 @@ int32_t StartupTaskDispatcher::RunTaskInit(const std::string &name, const std::s
     }
 }
 
+void StartupTaskDispatcher::RecordTaskStart(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(timingMutex_);
+    timings_[name].startTime = GetSteadyTimeMs();
+}
+
+void StartupTaskDispatcher::RecordTaskEnd(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(timingMutex_);
+    auto &timing = timings_[name];
+    timing.endTime = GetSteadyTimeMs();
+    if (timing.startTime == 0) {
+        // already initialized before this startup, it took no time here.
+        timing.startTime = timing.endTime;
+    }
+}
+
+void StartupTaskDispatcher::ReportCriticalPath()
+{
+    std::lock_guard<std::mutex> lock(timingMutex_);
+    std::vector<std::string> criticalPath = GetCriticalPathLocked();
+    if (criticalPath.empty()) {
+        return;
+    }
+    std::string pathStr;
+    for (const auto &name : criticalPath) {
+        const auto &timing = timings_[name];
+        pathStr += (pathStr.empty() ? "" : " -> ") + name + "(" +
+            std::to_string(timing.endTime - timing.startTime) + "ms)";
+    }
+    int64_t cost = timings_[criticalPath.back()].endTime - timings_[criticalPath.front()].startTime;
+    TAG_LOGI(AAFwkTag::STARTUP, "critical path %{public}" PRId64 "ms: %{public}s", cost, pathStr.c_str());
+}
+
+std::vector<std::string> StartupTaskDispatcher::GetCriticalPathLocked()
+{
+    std::vector<std::string> criticalPath;
+    auto last = timings_.end();
+    for (auto iter = timings_.begin(); iter != timings_.end(); ++iter) {
+        if (last == timings_.end() || iter->second.endTime > last->second.endTime) {
+            last = iter;
+        }
+    }
+    if (last == timings_.end()) {
+        return criticalPath;
+    }
+
+    // walk back through the dependency that finished last, it is the one each task waited for.
+    std::string current = last->first;
+    while (!current.empty()) {
+        criticalPath.insert(criticalPath.begin(), current);
+        auto taskIter = tasks_.find(current);
+        current.clear();
+        if (taskIter == tasks_.end() || taskIter->second == nullptr) {
+            break;
+        }
+        int64_t latestEnd = -1;
+        for (const auto &dependency : taskIter->second->GetDependencies()) {
+            auto depIter = timings_.find(dependency);
+            if (depIter != timings_.end() && depIter->second.endTime > latestEnd) {
+                latestEnd = depIter->second.endTime;
+                current = dependency;
+            }
+        }
+    }
+    return criticalPath;
+}
+
 void StartupTaskDispatcher::OnError(const std::string &name, const std::shared_ptr<StartupTaskResult> &result)
 {
     TAG_LOGE(AAFwkTag::STARTUP, "%{public}s failed, %{public}d", name.c_str(), result->GetResultCode());
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hap_path_cache.h"
+
+#include <cinttypes>
+
+#include "bundle_info.h"
+#include "bundle_mgr_helper.h"
+#include "hilog_tag_wrapper.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+HapPathCache &HapPathCache::GetInstance()
+{
+    static HapPathCache instance;
+    return instance;
+}
+
+void HapPathCache::SetSelfModulePaths(const std::map<std::string, std::string> &modulePaths)
+{
+    std::lock_guard lock(mutex_);
+    selfModulePaths_.clear();
+    selfModulePaths_.insert(modulePaths.begin(), modulePaths.end());
+    isSelfLoaded_ = !selfModulePaths_.empty();
+    generation_++;
+}
+
+bool HapPathCache::GetSelfModulePath(const std::string &moduleName, std::string &hapPath)
+{
+    bool isCached = false;
+    if (!LoadSelfModulePaths(isCached)) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::lock_guard lock(mutex_);
+    auto iter = selfModulePaths_.find(moduleName);
+    if (iter == selfModulePaths_.end()) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    (isCached ? hitCount_ : missCount_).fetch_add(1, std::memory_order_relaxed);
+    hapPath = iter->second;
+    return true;
+}
+
+bool HapPathCache::GetSelfHapPaths(std::vector<std::string> &hapPaths)
+{
+    bool isCached = false;
+    if (!LoadSelfModulePaths(isCached)) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    (isCached ? hitCount_ : missCount_).fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard lock(mutex_);
+    for (const auto &[moduleName, hapPath] : selfModulePaths_) {
+        hapPaths.emplace_back(hapPath);
+    }
+    return true;
+}
+
+bool HapPathCache::LoadSelfModulePaths(bool &isCached)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard lock(mutex_);
+        if (isSelfLoaded_) {
+            isCached = true;
+            return true;
+        }
+        generation = generation_;
+    }
+    isCached = false;
+
+    // query without holding the lock, the result is dropped if the cache was cleared or seeded meanwhile.
+    auto bundleMgrHelper = DelayedSingleton<AppExecFwk::BundleMgrHelper>::GetInstance();
+    if (bundleMgrHelper == nullptr) {
+        TAG_LOGE(AAFwkTag::JSRUNTIME, "null bundleMgrHelper");
+        return false;
+    }
+    AppExecFwk::BundleInfo bundleInfo;
+    auto getInfoResult = bundleMgrHelper->GetBundleInfoForSelf(
+        static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE), bundleInfo);
+    if (getInfoResult != 0 || bundleInfo.hapModuleInfos.empty()) {
+        TAG_LOGE(AAFwkTag::JSRUNTIME, "GetBundleInfoForSelf failed");
+        return false;
+    }
+
+    std::lock_guard lock(mutex_);
+    if (generation != generation_) {
+        return isSelfLoaded_;
+    }
+    selfModulePaths_.clear();
+    for (const auto &hapModuleInfo : bundleInfo.hapModuleInfos) {
+        selfModulePaths_.emplace(hapModuleInfo.moduleName, hapModuleInfo.hapPath);
+    }
+    isSelfLoaded_ = true;
+    return true;
+}
+
+bool HapPathCache::GetSharedModulePath(const std::string &key, std::string &hapPath)
+{
+    std::lock_guard lock(mutex_);
+    auto iter = sharedModulePaths_.find(key);
+    if (iter == sharedModulePaths_.end()) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    hitCount_.fetch_add(1, std::memory_order_relaxed);
+    hapPath = iter->second;
+    return true;
+}
+
+void HapPathCache::SetSharedModulePath(const std::string &key, const std::string &hapPath)
+{
+    std::lock_guard lock(mutex_);
+    sharedModulePaths_[key] = hapPath;
+}
+
+bool HapPathCache::RemoveSharedModulePath(const std::string &hapPath)
+{
+    std::lock_guard lock(mutex_);
+    bool isRemoved = false;
+    for (auto iter = sharedModulePaths_.begin(); iter != sharedModulePaths_.end();) {
+        if (iter->second == hapPath) {
+            iter = sharedModulePaths_.erase(iter);
+            isRemoved = true;
+        } else {
+            ++iter;
+        }
+    }
+    return isRemoved;
+}
+
+void HapPathCache::Clear()
+{
+    std::lock_guard lock(mutex_);
+    TAG_LOGI(AAFwkTag::JSRUNTIME, "clear hap path cache, hit: %{public}" PRIu64 ", miss: %{public}" PRIu64,
+        hitCount_.load(std::memory_order_relaxed), missCount_.load(std::memory_order_relaxed));
+    isSelfLoaded_ = false;
+    generation_++;
+    selfModulePaths_.clear();
+    sharedModulePaths_.clear();
+}
+
+uint64_t HapPathCache::GetHitCount() const
+{
+    return hitCount_.load(std::memory_order_relaxed);
+}
+
+uint64_t HapPathCache::GetMissCount() const
+{
+    return missCount_.load(std::memory_order_relaxed);
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
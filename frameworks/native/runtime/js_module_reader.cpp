@@ -17,21 +17,17 @@
 
 #include "bundle_info.h"
 #include "bundle_mgr_helper.h"
-#include "bundle_mgr_proxy.h"
 #include "file_path_utils.h"
+#include "hap_path_cache.h"
 #include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
-#include "iservice_registry.h"
 #include "js_runtime_utils.h"
 #include "singleton.h"
-#include "system_ability_definition.h"
 
 using namespace OHOS::AbilityBase;
 
 namespace OHOS {
 namespace AbilityRuntime {
-using IBundleMgr = AppExecFwk::IBundleMgr;
-
 JsModuleReader::JsModuleReader(const std::string& bundleName, const std::string& hapPath, bool isFormRender)
     : JsModuleSearcher(bundleName), isFormRender_(isFormRender)
 {
@@ -60,6 +56,12 @@ bool JsModuleReader::operator()(const std::string& inputPath, uint8_t **buff,
 
     bool newCreate = false;
     std::shared_ptr<Extractor> extractor = ExtractorUtil::GetExtractor(realHapPath, newCreate);
+    if (extractor == nullptr && HapPathCache::GetInstance().RemoveSharedModulePath(realHapPath)) {
+        // the cached hsp path is gone after the shared bundle is updated, resolve it again.
+        TAG_LOGI(AAFwkTag::JSRUNTIME, "cached path %{private}s is stale", realHapPath.c_str());
+        realHapPath = GetAppHspPath(inputPath);
+        extractor = ExtractorUtil::GetExtractor(realHapPath, newCreate);
+    }
     if (extractor == nullptr) {
         errorMsg = "hap path error: " + realHapPath;
         TAG_LOGE(AAFwkTag::JSRUNTIME, "realHapPath %{private}s GetExtractor failed", realHapPath.c_str());
@@ -131,6 +133,10 @@ std::string JsModuleReader::GetOtherHspPath(const std::string& bundleName, const
     const std::string& inputPath)
 {
     std::string presetAppHapPath = inputPath;
+    const std::string cacheKey = bundleName + ":" + inputPath;
+    if (HapPathCache::GetInstance().GetSharedModulePath(cacheKey, presetAppHapPath)) {
+        return presetAppHapPath;
+    }
 
     auto bundleMgrHelper = DelayedSingleton<AppExecFwk::BundleMgrHelper>::GetInstance();
     if (bundleMgrHelper == nullptr) {
@@ -164,6 +170,9 @@ std::string JsModuleReader::GetOtherHspPath(const std::string& bundleName, const
             break;
         }
     }
+    if (presetAppHapPath != inputPath) {
+        HapPathCache::GetInstance().SetSharedModulePath(cacheKey, presetAppHapPath);
+    }
     return presetAppHapPath;
 }
 
@@ -175,25 +184,8 @@ std::string JsModuleReader::GetPresetAppHapPath(const std::string& inputPath, co
         TAG_LOGE(AAFwkTag::JSRUNTIME, "empty moduleName");
         return presetAppHapPath;
     }
-    auto bundleMgrHelper = DelayedSingleton<AppExecFwk::BundleMgrHelper>::GetInstance();
-    if (bundleMgrHelper == nullptr) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "null bundleMgrHelper");
-        return presetAppHapPath;
-    }
     if (inputPath.find_first_of("/") == inputPath.find_last_of("/")) {
-        AppExecFwk::BundleInfo bundleInfo;
-        auto getInfoResult = bundleMgrHelper->GetBundleInfoForSelf(static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::
-            GET_BUNDLE_INFO_WITH_HAP_MODULE), bundleInfo);
-        if (getInfoResult != 0 || bundleInfo.hapModuleInfos.empty()) {
-            TAG_LOGE(AAFwkTag::JSRUNTIME, "GetBundleInfoForSelf failed");
-            return presetAppHapPath;
-        }
-        for (auto hapModuleInfo : bundleInfo.hapModuleInfos) {
-            if (hapModuleInfo.moduleName == moduleName) {
-                presetAppHapPath = hapModuleInfo.hapPath;
-                break;
-            }
-        }
+        HapPathCache::GetInstance().GetSelfModulePath(moduleName, presetAppHapPath);
     } else {
         presetAppHapPath = GetOtherHspPath(bundleName, moduleName, presetAppHapPath);
     }
@@ -202,26 +194,8 @@ std::string JsModuleReader::GetPresetAppHapPath(const std::string& inputPath, co
 
 void JsModuleReader::GetHapPathList(const std::string &bundleName, std::vector<std::string> &hapList)
 {
-    auto systemAbilityManagerClient = OHOS::SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (!systemAbilityManagerClient) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "null systemAbilityManagerClient");
-        return;
-    }
-    auto remoteObject = systemAbilityManagerClient->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (!remoteObject) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "null remoteObject");
-        return;
-    }
-    auto bundleMgrProxy = iface_cast<IBundleMgr>(remoteObject);
-    AppExecFwk::BundleInfo bundleInfo;
-    auto getInfoResult = bundleMgrProxy->GetBundleInfoForSelf(static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::
-        GET_BUNDLE_INFO_WITH_HAP_MODULE), bundleInfo);
-    if (getInfoResult != 0 || bundleInfo.hapModuleInfos.empty()) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "GetBundleInfoForSelf failed");
-        return;
-    }
-    for (auto hapModuleInfo : bundleInfo.hapModuleInfos) {
-        hapList.emplace_back(hapModuleInfo.hapPath);
+    if (!HapPathCache::GetInstance().GetSelfHapPaths(hapList)) {
+        TAG_LOGE(AAFwkTag::JSRUNTIME, "get hap paths failed");
     }
 }
 } // namespace AbilityRuntime
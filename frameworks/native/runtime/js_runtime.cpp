@@ -35,6 +35,7 @@
 #include "extract_resource_manager.h"
 #include "file_mapper.h"
 #include "file_path_utils.h"
+#include "hap_path_cache.h"
 #include "hdc_register.h"
 #include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
@@ -774,6 +775,9 @@ bool JsRuntime::Initialize(const Options& options)
             isBundle_ = options.isBundle;
             bundleName_ = options.bundleName;
             codePath_ = options.codePath;
+            if (!options.hapModulePath.empty()) {
+                HapPathCache::GetInstance().SetSelfModulePaths(options.hapModulePath);
+            }
             panda::JSNApi::SetSearchHapPathTracker(
                 vm, [options](const std::string moduleName, std::string &hapPath) -> bool {
                     if (options.hapModulePath.find(moduleName) == options.hapModulePath.end()) {
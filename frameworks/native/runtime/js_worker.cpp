@@ -34,6 +34,7 @@
 
 #include "extractor.h"
 #include "file_mapper.h"
+#include "hap_path_cache.h"
 #include "hilog_tag_wrapper.h"
 #include "iremote_object.h"
 #include "iservice_registry.h"
@@ -361,35 +362,12 @@ bool AssetHelper::ReadAmiData(const std::string& ami, uint8_t** buff, size_t* bu
 bool AssetHelper::ReadFilePathData(const std::string& filePath, uint8_t** buff, size_t* buffSize,
     std::vector<uint8_t>& content, bool& useSecureMem, bool isRestricted)
 {
-    auto bundleMgrHelper = DelayedSingleton<AppExecFwk::BundleMgrHelper>::GetInstance();
-    if (bundleMgrHelper == nullptr) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "null bundleMgrHelper");
-        return false;
-    }
-
-    AppExecFwk::BundleInfo bundleInfo;
-    auto getInfoResult = bundleMgrHelper->GetBundleInfoForSelf(
-        static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE), bundleInfo);
-    if (getInfoResult != 0) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "GetBundleInfoForSelf failed");
-        return false;
-    }
-    if (bundleInfo.hapModuleInfos.size() == 0) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "Get hapModuleInfo of bundleInfo failed");
-        return false;
-    }
-
     std::string newHapPath;
     size_t pos = filePath.find('/');
     if (!workerInfo_->isStageModel) {
         newHapPath = workerInfo_->hapPath;
-    } else {
-        for (auto hapModuleInfo : bundleInfo.hapModuleInfos) {
-            if (hapModuleInfo.moduleName == filePath.substr(0, pos)) {
-                newHapPath = hapModuleInfo.hapPath;
-                break;
-            }
-        }
+    } else if (!HapPathCache::GetInstance().GetSelfModulePath(filePath.substr(0, pos), newHapPath)) {
+        TAG_LOGW(AAFwkTag::JSRUNTIME, "module of %{private}s not found", filePath.c_str());
     }
     TAG_LOGD(AAFwkTag::JSRUNTIME, "HapPath: %{private}s", newHapPath.c_str());
     bool newCreate = false;
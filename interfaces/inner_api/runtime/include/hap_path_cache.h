@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_HAP_PATH_CACHE_H
+#define OHOS_ABILITY_RUNTIME_HAP_PATH_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * @class HapPathCache
+ * Process wide cache of module name to hap path resolutions, used by module and worker script loading
+ * so that bundle manager is asked once per process instead of once per import.
+ */
+class HapPathCache {
+public:
+    static HapPathCache &GetInstance();
+
+    /**
+     * @brief Seed the module paths of the bundle running in this process.
+     * @param modulePaths module name to hap path of every hap module of the bundle.
+     */
+    void SetSelfModulePaths(const std::map<std::string, std::string> &modulePaths);
+
+    /**
+     * @brief Get the hap path of a module of the bundle running in this process, the module paths are
+     * queried from bundle manager when they are not seeded yet.
+     * @param moduleName the module name.
+     * @param hapPath the hap path of the module.
+     * @return Returns true if the module is found; returns false otherwise.
+     */
+    bool GetSelfModulePath(const std::string &moduleName, std::string &hapPath);
+
+    /**
+     * @brief Get the hap paths of all modules of the bundle running in this process.
+     * @param hapPaths the hap paths.
+     * @return Returns true if the module paths are available; returns false otherwise.
+     */
+    bool GetSelfHapPaths(std::vector<std::string> &hapPaths);
+
+    bool GetSharedModulePath(const std::string &key, std::string &hapPath);
+    void SetSharedModulePath(const std::string &key, const std::string &hapPath);
+
+    /**
+     * @brief Drop the shared module resolutions to a hap path which can no longer be opened, the shared
+     * bundle is updated and moved to another path.
+     * @param hapPath the stale hap path.
+     * @return Returns true if any resolution is dropped; returns false otherwise.
+     */
+    bool RemoveSharedModulePath(const std::string &hapPath);
+
+    /**
+     * @brief Drop all resolutions, called when the bundle is updated.
+     */
+    void Clear();
+
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+
+private:
+    HapPathCache() = default;
+    ~HapPathCache() = default;
+    HapPathCache(const HapPathCache&) = delete;
+    HapPathCache& operator=(const HapPathCache&) = delete;
+
+    bool LoadSelfModulePaths(bool &isCached);
+
+    std::mutex mutex_;
+    bool isSelfLoaded_ = false;
+    // bumped whenever the self module paths are seeded or cleared, guards loads racing with them.
+    uint64_t generation_ = 0;
+    std::unordered_map<std::string, std::string> selfModulePaths_;
+    std::unordered_map<std::string, std::string> sharedModulePaths_;
+    std::atomic<uint64_t> hitCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_HAP_PATH_CACHE_H
@@ -17,6 +17,7 @@
 #define OHOS_ABILITY_RUNTIME_ABILITY_LOADER_H
 
 #include <functional>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -111,6 +112,8 @@ private:
     AbilityLoader(AbilityLoader &&) = delete;
     AbilityLoader &operator=(AbilityLoader &&) = delete;
 
+    // ability libraries are preloaded off the main thread, their constructors register concurrently.
+    std::mutex mutex_;
     std::unordered_map<std::string, CreateAblity> abilities_;
     std::unordered_map<std::string, CreateExtension> extensions_;
     std::unordered_map<std::string, CreateUIAbility> uiAbilities_;
@@ -16,6 +16,10 @@
 #ifndef OHOS_ABILITY_RUNTIME_IDLE_TIME_H
 #define OHOS_ABILITY_RUNTIME_IDLE_TIME_H
 
+#include <map>
+#include <mutex>
+#include <string>
+
 #include "event_handler.h"
 #include "native_engine/native_engine.h"
 
@@ -26,6 +30,7 @@ class VSyncReceiver;
 namespace AppExecFwk {
 using IdleTimeCallback = std::function<void(int32_t)>;
 using IdleNotifyStatusCallback = std::function<void(bool)>;
+using IdleTaskFunc = std::function<void()>;
 class IdleTime : public std::enable_shared_from_this<IdleTime> {
 public:
     IdleTime(const std::shared_ptr<EventHandler> &eventHandler, IdleTimeCallback idleTimeCallback);
@@ -33,18 +38,44 @@ public:
     void Start();
     IdleNotifyStatusCallback GetIdleNotifyFunc();
 
+    /**
+     * @brief Queue deferrable work to run on the main thread in the idle window before the next VSync.
+     * @param name the task name, used by RemoveIdleTask.
+     * @param task the work to run.
+     * @param costMs the estimated run time, the task only runs in an idle window it fits in.
+     * @param deadlineMs the task runs as a normal main thread task if it is still queued after deadlineMs,
+     * non-positive value means the default deadline.
+     * @return Returns true if the task is queued; returns false otherwise.
+     */
+    bool PostIdleTask(const std::string &name, IdleTaskFunc task, int64_t costMs, int64_t deadlineMs = 0);
+    void RemoveIdleTask(const std::string &name);
+    size_t GetIdleTaskCount();
+
 private:
+    struct IdleTask {
+        uint64_t id = 0;
+        std::string name;
+        IdleTaskFunc task = nullptr;
+        int64_t costNs = 0;
+    };
+
     int64_t GetSysTimeNs();
     void InitVSyncReceiver();
     void EventTask();
     void PostTask();
     void SetNeedStop(bool needStop);
     bool GetNeedStop();
+    int64_t RunIdleTasks(int64_t idleTimeNs);
+    void RunExpiredIdleTask(uint64_t id);
 
     bool needStop_ {false};
     std::shared_ptr<EventHandler> eventHandler_;
     IdleTimeCallback callback_ = nullptr;
     std::shared_ptr<Rosen::VSyncReceiver> receiver_ = nullptr;
+    std::mutex idleTaskMutex_;
+    // queued idle tasks ordered by deadline
+    std::multimap<int64_t, IdleTask> idleTasks_;
+    uint64_t idleTaskId_ = 0;
 };
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef OHOS_ABILITY_RUNTIME_MAIN_THREAD_H
 #define OHOS_ABILITY_RUNTIME_MAIN_THREAD_H
 
+#include <future>
 #include <string>
 #include <signal.h>
 #include <mutex>
@@ -262,6 +263,18 @@ public:
      */
     static void PreloadExtensionPlugin();
 
+    /**
+     *
+     * @brief Post deferrable work to run in main thread idle time, must be called on the main thread.
+     *
+     * @param name The task name.
+     * @param task The work to run.
+     * @param costMs The estimated run time of the task.
+     * @param deadlineMs The task runs anyway once the deadline is reached, non-positive means the default one.
+     * @return Returns true if the task is posted; returns false otherwise.
+     */
+    bool PostIdleTask(const std::string &name, const IdleTaskFunc &task, int64_t costMs, int64_t deadlineMs = 0);
+
     /**
      *
      * @brief Schedule the application process exit safely.
@@ -661,6 +674,22 @@ private:
     static std::weak_ptr<OHOSApplication> applicationForDump_;
 
 #ifdef ABILITY_LIBRARY_LOADER
+    struct AbilityLibraryItem {
+        std::string file;
+        // the symbols are made available to the libraries opened later.
+        bool isGlobal = true;
+        // opened instead when file fails to open.
+        std::string fallbackFile;
+        // the process exits when neither file nor fallbackFile can be opened.
+        bool isFatal = true;
+    };
+    struct AbilityLibraryPreloadState {
+        std::mutex mutex;
+        std::vector<void *> handles;
+        // the fatal library which failed to open, the later batches are skipped and the main thread exits.
+        std::string fatalFile;
+    };
+
     /**
      *
      * @brief Load the ability library.
@@ -669,8 +698,25 @@ private:
      *
      */
     void LoadAbilityLibrary(const std::vector<std::string> &libraryPaths);
-    void LoadAceAbilityLibrary();
-    
+    void LoadAceAbilityLibrary(std::vector<AbilityLibraryItem> &items);
+    void GetAbilityLibraryItems(const std::vector<std::string> &fileEntries, std::vector<AbilityLibraryItem> &items);
+
+    /**
+     * @brief Open the libraries on a background thread, in order and after the previously queued libraries,
+     * so that libraries exporting global symbols are still opened before the ones depending on them.
+     *
+     * @param items the libraries to open.
+     */
+    void PreloadAbilityLibraries(std::vector<AbilityLibraryItem> &&items);
+    static bool OpenAbilityLibraries(const std::vector<AbilityLibraryItem> &items, std::vector<void *> &handles,
+        std::string &fatalFile);
+
+    /**
+     * @brief Wait until all queued libraries are opened, must be called before an ability or extension is
+     * registered or created from them. The process exits if a fatal library failed to open.
+     */
+    void WaitAbilityLibraryPreloaded();
+
     void CalcNativeLiabraryEntries(const BundleInfo &bundleInfo, std::string &nativeLibraryPath);
     void LoadNativeLiabrary(const BundleInfo &bundleInfo, std::string &nativeLibraryPath);
 
@@ -722,6 +768,9 @@ private:
     std::vector<std::string> fileEntries_;
     std::vector<std::string> nativeFileEntries_;
     std::vector<void *> handleAbilityLib_;  // the handler of ACE Library.
+    std::shared_future<void> abilityLibraryPreloaded_;
+    std::shared_ptr<AbilityLibraryPreloadState> abilityLibraryPreloadState_ =
+        std::make_shared<AbilityLibraryPreloadState>();
     std::shared_ptr<IdleTime> idleTime_ = nullptr;
     std::vector<AppExecFwk::OverlayModuleInfo> overlayModuleInfos_;
     std::weak_ptr<AbilityRuntime::AssertFaultTaskThread> assertThread_;
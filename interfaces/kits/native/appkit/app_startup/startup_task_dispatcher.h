@@ -16,7 +16,9 @@
 #ifndef OHOS_ABILITY_RUNTIME_STARTUP_TASK_DISPATCHER_H
 #define OHOS_ABILITY_RUNTIME_STARTUP_TASK_DISPATCHER_H
 
+#include <atomic>
 #include <deque>
+#include <mutex>
 
 #include "startup_sort_result.h"
 #include "startup_task_result.h"
@@ -35,19 +37,32 @@ public:
         const std::shared_ptr<OnCompletedCallback> &mainThreadAwaitCallback);
 
 private:
+    struct TaskTiming {
+        int64_t startTime = 0;
+        int64_t endTime = 0;
+    };
+
     const std::map<std::string, std::shared_ptr<StartupTask>> &tasks_;
     std::shared_ptr<StartupSortResult> sortResult_;
-    std::map<std::string, std::uint32_t> inDegreeMap_;
-    uint32_t mainThreadAwaitCount_ = 0;
-    uint32_t tasksCount_ = 0;
+    // the key set is fixed in Run, counters may then be decremented from any completing thread.
+    std::map<std::string, std::atomic<uint32_t>> inDegreeMap_;
+    std::atomic<uint32_t> mainThreadAwaitCount_ {0};
+    std::atomic<uint32_t> tasksCount_ {0};
     std::shared_ptr<OnCompletedCallback> completedCallback_;
     std::shared_ptr<OnCompletedCallback> mainThreadAwaitCallback_;
+    std::mutex timingMutex_;
+    std::map<std::string, TaskTiming> timings_;
 
     void Dispatch(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
     int32_t NotifyChildren(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
     int32_t RunTaskInit(const std::string &name, const std::shared_ptr<StartupTask> &task);
     void OnError(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
     void OnError(int32_t errorCode, const std::string &errorMessage);
+    void RecordTaskStart(const std::string &name);
+    void RecordTaskEnd(const std::string &name);
+    void ReportCriticalPath();
+    // the chain of tasks from the first started one to the last completed one, timingMutex_ must be held.
+    std::vector<std::string> GetCriticalPathLocked();
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
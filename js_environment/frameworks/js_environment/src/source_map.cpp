@@ -155,9 +155,9 @@ std::string SourceMap::TranslateBySourceMap(const std::string& stackStr)
         }
         std::string sourceInfo;
         if (isModular_) {
-            auto iter = sourceMaps_.find(key);
-            if (iter != sourceMaps_.end()) {
-                sourceInfo = GetSourceInfo(line, column, *(iter->second));
+            auto modularMap = GetModularMap(key);
+            if (modularMap != nullptr) {
+                sourceInfo = GetSourceInfo(line, column, *modularMap);
             } else if (key.rfind(".js") != std::string::npos) {
                 ans = ans + temp + "\n";
                 continue;
@@ -195,48 +195,83 @@ void SourceMap::SplitSourceMap(const std::string& sourceMapData)
         return ExtractSourceMapData(sourceMapData, nonModularMap_);
     }
 
-    std::stringstream ss(sourceMapData);
-    std::string tmp;
+    // index each file's section by byte offset, its mappings are decoded when a stack first hits it.
+    auto content = std::make_shared<const std::string>(sourceMapData);
+    std::unordered_map<std::string, SourceMapSection> sections;
     std::string url;
-
-    std::getline(ss, tmp);
     bool isUrl = true;
-    while (std::getline(ss, tmp)) {
-        if (isUrl && tmp.size() > REAL_SOURCE_SIZE) {
-            url = tmp.substr(REAL_URL_INDEX, tmp.size() - REAL_SOURCE_SIZE);
-            isUrl = false;
-            continue;
+    size_t lineStart = content->find('\n');
+    lineStart = (lineStart == std::string::npos) ? content->size() : lineStart + 1;
+    while (lineStart < content->size()) {
+        size_t lineEnd = content->find('\n', lineStart);
+        if (lineEnd == std::string::npos) {
+            lineEnd = content->size();
         }
-        if (StringStartWith(tmp.c_str(), FLAG_SOURCES)) {
-            std::getline(ss, tmp);
-            sources_.emplace(url, tmp);
-            continue;
-        }
-        if (StringStartWith(tmp.c_str(), FLAG_MAPPINGS)) {
-            mappings_.emplace(url, tmp);
-            continue;
-        }
-        if (StringStartWith(tmp.c_str(), FLAG_END)) {
+        size_t lineLen = lineEnd - lineStart;
+        const char* line = content->data() + lineStart;
+        size_t nextLine = lineEnd + 1;
+        if (isUrl && lineLen > REAL_SOURCE_SIZE) {
+            url = content->substr(lineStart + REAL_URL_INDEX, lineLen - REAL_SOURCE_SIZE);
+            isUrl = false;
+        } else if (lineLen >= FLAG_SOURCES.size() && FLAG_SOURCES.compare(0, FLAG_SOURCES.size(), line,
+            FLAG_SOURCES.size()) == 0) {
+            // the sources value is on the next line
+            size_t sourcesEnd = (nextLine < content->size()) ? content->find('\n', nextLine) : std::string::npos;
+            if (sourcesEnd == std::string::npos) {
+                sourcesEnd = content->size();
+            }
+            auto &section = sections[url];
+            if (section.content == nullptr && nextLine < content->size()) {
+                section.content = content;
+                section.sources = content->substr(nextLine, sourcesEnd - nextLine);
+            }
+            nextLine = sourcesEnd + 1;
+        } else if (lineLen >= FLAG_MAPPINGS.size() && FLAG_MAPPINGS.compare(0, FLAG_MAPPINGS.size(), line,
+            FLAG_MAPPINGS.size()) == 0) {
+            auto &section = sections[url];
+            if (section.mappingsLength == 0 && lineLen > FLAG_MAPPINGS_LEN) {
+                section.mappingsStart = lineStart + FLAG_MAPPINGS_LEN;
+                section.mappingsLength = lineLen - FLAG_MAPPINGS_LEN - 1;
+            }
+        } else if (lineLen >= FLAG_END.size() && FLAG_END.compare(0, FLAG_END.size(), line, FLAG_END.size()) == 0) {
             isUrl = true;
         }
+        lineStart = nextLine;
     }
-    for (auto it = sources_.begin(); it != sources_.end(); ++it) {
-        std::string mappings = mappings_[it->first];
-        if (mappings.size() < FLAG_MAPPINGS_LEN + 1) {
-            TAG_LOGE(AAFwkTag::JSENV, "Translate failed, url: %{public}s", it->first.c_str());
+
+    std::lock_guard<std::mutex> mapLock(modularMapMutex_);
+    for (auto &item : sections) {
+        if (item.second.content == nullptr) {
             continue;
         }
-        std::shared_ptr<SourceMapData> modularMap = std::make_shared<SourceMapData>();
-        ExtractSourceMapData(mappings.substr(FLAG_MAPPINGS_LEN, mappings.size() - FLAG_MAPPINGS_LEN - 1), modularMap);
-        if (modularMap == nullptr) {
-            TAG_LOGE(AAFwkTag::JSENV, "Extract mappings failed, url: %{public}s", it->first.c_str());
+        if (item.second.mappingsLength == 0) {
+            TAG_LOGE(AAFwkTag::JSENV, "Translate failed, url: %{public}s", item.first.c_str());
             continue;
         }
-        modularMap->sources_.push_back(it->second);
-        sourceMaps_[it->first] = modularMap;
+        sourceMaps_.erase(item.first);
+        sourceMapSections_[item.first] = std::move(item.second);
+    }
+}
+
+std::shared_ptr<SourceMapData> SourceMap::GetModularMap(const std::string& url)
+{
+    std::lock_guard<std::mutex> lock(modularMapMutex_);
+    auto iter = sourceMaps_.find(url);
+    if (iter != sourceMaps_.end()) {
+        return iter->second;
     }
-    mappings_.clear();
-    sources_.clear();
+    auto sectionIter = sourceMapSections_.find(url);
+    if (sectionIter == sourceMapSections_.end()) {
+        return nullptr;
+    }
+    const auto &section = sectionIter->second;
+    std::shared_ptr<SourceMapData> modularMap = std::make_shared<SourceMapData>();
+    ExtractSourceMapData(section.content->data() + section.mappingsStart, section.mappingsLength, *modularMap);
+    modularMap->sources_.push_back(section.sources);
+    sourceMaps_[url] = modularMap;
+    // drop the section so the merged buffer is released once every file in it has been decoded
+    sourceMapSections_.erase(sectionIter);
+    return modularMap;
 }
 
 void SourceMap::ExtractStackInfo(const std::string& stackStr, std::vector<std::string>& res)
@@ -250,51 +285,55 @@ void SourceMap::ExtractStackInfo(const std::string& stackStr, std::vector<std::s
 
 void SourceMap::ExtractSourceMapData(const std::string& allmappings, std::shared_ptr<SourceMapData>& curMapData)
 {
-    curMapData->mappings_ = HandleMappings(allmappings);
+    ExtractSourceMapData(allmappings.data(), allmappings.size(), *curMapData);
+}
+
+void SourceMap::ExtractSourceMapData(const char* mappings, size_t length, SourceMapData& curMapData)
+{
     // the first bit: the column after transferring.
     // the second bit: the source file.
     // the third bit: the row before transferring.
     // the fourth bit: the column before transferring.
     // the fifth bit: the variable name.
-    for (const auto& mapping : curMapData->mappings_) {
-        if (mapping == ";") {
-            // plus a line for each semicolon
-            curMapData->nowPos_.afterRow++,
-            curMapData->nowPos_.afterColumn = 0;
+    std::vector<int32_t> ans;
+    size_t segmentStart = 0;
+    for (size_t i = 0; i <= length; i++) {
+        bool isEnd = (i == length);
+        if (!isEnd && mappings[i] != DELIMITER_COMMA && mappings[i] != DELIMITER_SEMICOLON) {
             continue;
         }
-        std::vector<int32_t> ans;
-
-        if (!VlqRevCode(mapping, ans)) {
-            return;
-        }
-        if (ans.empty()) {
-            TAG_LOGE(AAFwkTag::JSENV, "decode sourcemap fail, mapping: %{public}s", mapping.c_str());
-            break;
-        }
-        if (ans.size() == 1) {
-            curMapData->nowPos_.afterColumn += ans[0];
-            continue;
+        size_t segmentLen = i - segmentStart;
+        // an empty segment is only legal right before a semicolon or at the end
+        bool skipSegment = (segmentLen == 0) && (isEnd || mappings[i] == DELIMITER_SEMICOLON);
+        if (!skipSegment) {
+            ans.clear();
+            if (!VlqRevCode(mappings + segmentStart, segmentLen, ans)) {
+                return;
+            }
+            if (ans.empty()) {
+                TAG_LOGE(AAFwkTag::JSENV, "decode sourcemap fail, mapping: %{public}s",
+                    std::string(mappings + segmentStart, segmentLen).c_str());
+                break;
+            }
+            curMapData.nowPos_.afterColumn += ans[0];
+            if (ans.size() > 1) {
+                // after decode, assgin each value to the position
+                curMapData.nowPos_.sourcesVal += ans[INDEX_ONE];
+                curMapData.nowPos_.beforeRow += ans[INDEX_TWO];
+                curMapData.nowPos_.beforeColumn += ans[INDEX_THREE];
+                if (ans.size() == ANS_MAP_SIZE) {
+                    curMapData.nowPos_.namesVal += ans[INDEX_FOUR];
+                }
+                curMapData.afterPos_.push_back(curMapData.nowPos_);
+            }
         }
-        // after decode, assgin each value to the position
-        curMapData->nowPos_.afterColumn += ans[0];
-        curMapData->nowPos_.sourcesVal += ans[INDEX_ONE];
-        curMapData->nowPos_.beforeRow += ans[INDEX_TWO];
-        curMapData->nowPos_.beforeColumn += ans[INDEX_THREE];
-        if (ans.size() == ANS_MAP_SIZE) {
-            curMapData->nowPos_.namesVal += ans[INDEX_FOUR];
+        if (!isEnd && mappings[i] == DELIMITER_SEMICOLON) {
+            // plus a line for each semicolon
+            curMapData.nowPos_.afterRow++;
+            curMapData.nowPos_.afterColumn = 0;
         }
-        curMapData->afterPos_.push_back({
-            curMapData->nowPos_.beforeRow,
-            curMapData->nowPos_.beforeColumn,
-            curMapData->nowPos_.afterRow,
-            curMapData->nowPos_.afterColumn,
-            curMapData->nowPos_.sourcesVal,
-            curMapData->nowPos_.namesVal
-        });
+        segmentStart = i + 1;
     }
-    curMapData->mappings_.clear();
-    curMapData->mappings_.shrink_to_fit();
 }
 
 MappingInfo SourceMap::Find(int32_t row, int32_t col, const SourceMapData& targetMap)
@@ -403,31 +442,7 @@ std::string SourceMap::GetRelativePath(const std::string& sources)
     return sources;
 }
 
-std::vector<std::string> SourceMap::HandleMappings(const std::string& mapping)
-{
-    std::vector<std::string> keyInfo;
-    std::string tempStr;
-    for (uint32_t i = 0; i < mapping.size(); i++) {
-        if (mapping[i] == DELIMITER_COMMA) {
-            keyInfo.push_back(tempStr);
-            tempStr = "";
-        } else if (mapping[i] == DELIMITER_SEMICOLON) {
-            if (tempStr != "") {
-                keyInfo.push_back(tempStr);
-            }
-            tempStr = "";
-            keyInfo.push_back(";");
-        } else {
-            tempStr += mapping[i];
-        }
-    }
-    if (tempStr != "") {
-        keyInfo.push_back(tempStr);
-    }
-    return keyInfo;
-};
-
-bool SourceMap::VlqRevCode(const std::string& vStr, std::vector<int32_t>& ans)
+bool SourceMap::VlqRevCode(const char* vStr, size_t length, std::vector<int32_t>& ans)
 {
     const int32_t VLQ_BASE_SHIFT = 5;
     // binary: 100000
@@ -439,7 +454,7 @@ bool SourceMap::VlqRevCode(const std::string& vStr, std::vector<int32_t>& ans)
     uint32_t result = 0;
     uint32_t shift = 0;
     bool continuation = 0;
-    for (uint32_t i = 0; i < vStr.size(); i++) {
+    for (size_t i = 0; i < length; i++) {
         uint32_t digit = Base64CharToInt(vStr[i]);
         if (digit == DIGIT_NUM) {
             return false;
@@ -520,9 +535,9 @@ bool SourceMap::ReadSourceMapData(const std::string& hapPath, const std::string&
 bool SourceMap::TranslateUrlPositionBySourceMap(std::string& url, int& line, int& column)
 {
     if (isModular_) {
-        auto iter = sourceMaps_.find(url);
-        if (iter != sourceMaps_.end()) {
-            return GetLineAndColumnNumbers(line, column, *(iter->second), url);
+        auto modularMap = GetModularMap(url);
+        if (modularMap != nullptr) {
+            return GetLineAndColumnNumbers(line, column, *modularMap, url);
         }
         TAG_LOGE(AAFwkTag::JSENV, "stageMode sourceMaps find fail");
         return false;
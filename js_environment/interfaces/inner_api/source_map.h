@@ -19,6 +19,7 @@
 #include <cstring>
 #include <fstream>
 #include <limits.h>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
@@ -55,7 +56,6 @@ public:
     std::vector<std::string> files_;
     std::vector<std::string> sources_;
     std::vector<std::string> names_;
-    std::vector<std::string> mappings_;
     std::vector<SourceMapInfo> afterPos_;
 
     inline SourceMapData GetSourceMapData() const
@@ -85,10 +85,19 @@ public:
     void SplitSourceMap(const std::string& sourceMapData);
     
 private:
+    // location of one file's section inside the merged source map, decoded on first lookup.
+    struct SourceMapSection {
+        std::shared_ptr<const std::string> content;
+        size_t mappingsStart = 0;
+        size_t mappingsLength = 0;
+        std::string sources;
+    };
+
     void ExtractSourceMapData(const std::string& allmappings, std::shared_ptr<SourceMapData>& curMapData);
+    void ExtractSourceMapData(const char* mappings, size_t length, SourceMapData& curMapData);
     void ExtractKeyInfo(const std::string& sourceMap, std::vector<std::string>& sourceKeyInfo);
-    std::vector<std::string> HandleMappings(const std::string& mapping);
-    bool VlqRevCode(const std::string& vStr, std::vector<int32_t>& ans);
+    std::shared_ptr<SourceMapData> GetModularMap(const std::string& url);
+    bool VlqRevCode(const char* vStr, size_t length, std::vector<int32_t>& ans);
     MappingInfo Find(int32_t row, int32_t col, const SourceMapData& targetMap);
     void GetPosInfo(const std::string& temp, int32_t start, std::string& line, std::string& column);
     std::string GetRelativePath(const std::string& sources);
@@ -97,13 +106,13 @@ private:
 private:
     bool isModular_ = true;
     std::string hapPath_;
+    std::mutex modularMapMutex_;
     std::unordered_map<std::string, std::shared_ptr<SourceMapData>> sourceMaps_;
+    std::unordered_map<std::string, SourceMapSection> sourceMapSections_;
     std::shared_ptr<SourceMapData> nonModularMap_;
     static ReadSourceMapCallback readSourceMapFunc_;
     static std::mutex sourceMapMutex_;
     static GetHapPathCallback getHapPathFunc_;
-    std::unordered_map<std::string, std::string> sources_;
-    std::unordered_map<std::string, std::string> mappings_;
 };
 } // namespace JsEnv
 } // namespace OHOS
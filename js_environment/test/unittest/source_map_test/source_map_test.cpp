@@ -401,5 +401,56 @@ HWTEST_F(SourceMapTest, JsEnv_SourceMap_1800, Function | MediumTest | Level1)
 
     GTEST_LOG_(INFO) << "JsEnv_SourceMap_1800 end" << stack.c_str();
 }
+
+/**
+ * @tc.number: JsEnv_SourceMap_1900
+ * @tc.name: SplitSourceMap
+ * @tc.desc: Verifying merged source map sections are indexed at split and decoded on first lookup.
+ */
+HWTEST_F(SourceMapTest, JsEnv_SourceMap_1900, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "JsEnv_SourceMap_1900 start";
+    std::string sourceMaps = "{\n"
+        "  \"entry/src/main/ets/pages/Index.ets\": {\n"
+        "    \"version\": 3,\n"
+        "    \"file\": \"Index.ets\",\n"
+        "    \"sources\": [\n"
+        "      \"entry/src/main/ets/pages/Index.ets\"\n"
+        "    ],\n"
+        "    \"names\": [],\n"
+        "    \"mappings\": \";;;;AAAA,OAAO\"\n"
+        "  },\n"
+        "  \"entry/src/main/ets/pages/Other.ets\": {\n"
+        "    \"version\": 3,\n"
+        "    \"file\": \"Other.ets\",\n"
+        "    \"sources\": [\n"
+        "      \"entry/src/main/ets/pages/Other.ets\"\n"
+        "    ],\n"
+        "    \"names\": [],\n"
+        "    \"mappings\": \";AAAA\"\n"
+        "  }\n"
+        "}";
+
+    auto mapObj = std::make_shared<SourceMap>();
+    mapObj->Init(true, "");
+    mapObj->SplitSourceMap(sourceMaps);
+    EXPECT_EQ(mapObj->sourceMapSections_.size(), 2u);
+    EXPECT_TRUE(mapObj->sourceMaps_.empty());
+
+    std::string stackStr = "at anonymous (entry/src/main/ets/pages/Index.ets:5:9)";
+    std::string stack = mapObj->TranslateBySourceMap(stackStr);
+    EXPECT_EQ(stack, "at anonymous (entry/src/main/ets/pages/Index.ets:1:8)\n");
+    EXPECT_EQ(mapObj->sourceMapSections_.size(), 1u);
+    EXPECT_EQ(mapObj->sourceMaps_.size(), 1u);
+
+    std::string url = "entry/src/main/ets/pages/Other.ets";
+    int line = 2;
+    int column = 1;
+    EXPECT_TRUE(mapObj->TranslateUrlPositionBySourceMap(url, line, column));
+    EXPECT_EQ(line, 1);
+    EXPECT_EQ(column, 1);
+    EXPECT_TRUE(mapObj->sourceMapSections_.empty());
+    GTEST_LOG_(INFO) << "JsEnv_SourceMap_1900 end";
+}
 } // namespace AppExecFwk
 } // namespace OHOS
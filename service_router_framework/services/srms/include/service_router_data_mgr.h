@@ -18,6 +18,8 @@
 
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <singleton.h>
@@ -88,9 +90,27 @@ private:
 
     void ClearAllBundleInfos();
 
+    /**
+     * @brief Add the infos of a bundle to the business type and purpose name indexes.
+     * @param bundleName Indicates the bundle name.
+     * @param innerServiceInfo Indicates the inner service info of the bundle.
+     */
+    void AddIndexLocked(const std::string &bundleName, const InnerServiceInfo &innerServiceInfo);
+
+    /**
+     * @brief Remove the infos of a bundle from the business type and purpose name indexes.
+     * @param bundleName Indicates the bundle name.
+     * @param innerServiceInfo Indicates the inner service info of the bundle.
+     */
+    void RemoveIndexLocked(const std::string &bundleName, const InnerServiceInfo &innerServiceInfo);
+
 private:
-    mutable std::mutex bundleInfoMutex_;
+    mutable std::shared_mutex bundleInfoMutex_;
     std::map<std::string, InnerServiceInfo> innerServiceInfos_;
+    // business type to bundle name to infos, ordered by bundle name as innerServiceInfos_.
+    std::map<BusinessType, std::map<std::string, std::vector<BusinessAbilityInfo>>> businessAbilityIndex_;
+    // purpose name to bundle name to infos, ordered by bundle name as innerServiceInfos_.
+    std::unordered_map<std::string, std::map<std::string, std::vector<PurposeInfo>>> purposeIndex_;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -46,7 +46,7 @@ bool ServiceRouterDataMgr::LoadAllBundleInfos()
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     for (const auto &bundleInfo : bundleInfos) {
         UpdateBundleInfoLocked(bundleInfo);
     }
@@ -68,7 +68,7 @@ bool ServiceRouterDataMgr::LoadBundleInfo(const std::string &bundleName)
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     UpdateBundleInfoLocked(bundleInfo);
     return true;
 }
@@ -88,20 +88,59 @@ void ServiceRouterDataMgr::UpdateBundleInfoLocked(const BundleInfo &bundleInfo)
     if (BundleInfoResolveUtil::ResolveBundleInfo(bundleInfo, purposeInfos, businessAbilityInfos,
         innerServiceInfo.GetAppInfo())) {
         innerServiceInfo.UpdateInnerServiceInfo(purposeInfos, businessAbilityInfos);
-        innerServiceInfos_.try_emplace(bundleInfo.name, innerServiceInfo);
+        if (infoItem != innerServiceInfos_.end()) {
+            RemoveIndexLocked(bundleInfo.name, infoItem->second);
+        }
+        AddIndexLocked(bundleInfo.name, innerServiceInfo);
+        innerServiceInfos_.insert_or_assign(bundleInfo.name, std::move(innerServiceInfo));
+    }
+}
+
+void ServiceRouterDataMgr::AddIndexLocked(const std::string &bundleName, const InnerServiceInfo &innerServiceInfo)
+{
+    for (const auto &businessAbilityInfo : innerServiceInfo.GetBusinessAbilityInfos()) {
+        businessAbilityIndex_[businessAbilityInfo.businessType][bundleName].emplace_back(businessAbilityInfo);
+    }
+    for (const auto &purposeInfo : innerServiceInfo.GetPurposeInfos()) {
+        purposeIndex_[purposeInfo.purposeName][bundleName].emplace_back(purposeInfo);
+    }
+}
+
+void ServiceRouterDataMgr::RemoveIndexLocked(const std::string &bundleName, const InnerServiceInfo &innerServiceInfo)
+{
+    for (const auto &businessAbilityInfo : innerServiceInfo.GetBusinessAbilityInfos()) {
+        auto typeItem = businessAbilityIndex_.find(businessAbilityInfo.businessType);
+        if (typeItem == businessAbilityIndex_.end()) {
+            continue;
+        }
+        typeItem->second.erase(bundleName);
+        if (typeItem->second.empty()) {
+            businessAbilityIndex_.erase(typeItem);
+        }
+    }
+    for (const auto &purposeInfo : innerServiceInfo.GetPurposeInfos()) {
+        auto purposeItem = purposeIndex_.find(purposeInfo.purposeName);
+        if (purposeItem == purposeIndex_.end()) {
+            continue;
+        }
+        purposeItem->second.erase(bundleName);
+        if (purposeItem->second.empty()) {
+            purposeIndex_.erase(purposeItem);
+        }
     }
 }
 
 void ServiceRouterDataMgr::DeleteBundleInfo(const std::string &bundleName)
 {
     TAG_LOGD(AAFwkTag::SER_ROUTER, "SRDM DeleteBundleInfo");
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     auto infoItem = innerServiceInfos_.find(bundleName);
     if (infoItem == innerServiceInfos_.end()) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "SRDM inner service info not found by bundleName");
         return;
     }
-    innerServiceInfos_.erase(bundleName);
+    RemoveIndexLocked(bundleName, infoItem->second);
+    innerServiceInfos_.erase(infoItem);
 }
 
 int32_t ServiceRouterDataMgr::QueryBusinessAbilityInfos(const BusinessAbilityFilter &filter,
@@ -114,9 +153,13 @@ int32_t ServiceRouterDataMgr::QueryBusinessAbilityInfos(const BusinessAbilityFil
         return ERR_BUNDLE_MANAGER_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
-    for (const auto &item : innerServiceInfos_) {
-        item.second.FindBusinessAbilityInfos(validType, businessAbilityInfos);
+    std::shared_lock<std::shared_mutex> lock(bundleInfoMutex_);
+    auto typeItem = businessAbilityIndex_.find(validType);
+    if (typeItem == businessAbilityIndex_.end()) {
+        return ERR_OK;
+    }
+    for (const auto &[bundleName, infos] : typeItem->second) {
+        businessAbilityInfos.insert(businessAbilityInfos.end(), infos.begin(), infos.end());
     }
     return ERR_OK;
 }
@@ -130,12 +173,16 @@ int32_t ServiceRouterDataMgr::QueryPurposeInfos(const Want &want, const std::str
         return ERR_BUNDLE_MANAGER_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::shared_lock<std::shared_mutex> lock(bundleInfoMutex_);
     ElementName element = want.GetElement();
     std::string bundleName = element.GetBundleName();
     if (bundleName.empty()) {
-        for (const auto &item : innerServiceInfos_) {
-            item.second.FindPurposeInfos(purposeName, purposeInfos);
+        auto purposeItem = purposeIndex_.find(purposeName);
+        if (purposeItem == purposeIndex_.end()) {
+            return ERR_OK;
+        }
+        for (const auto &[infoBundleName, infos] : purposeItem->second) {
+            purposeInfos.insert(purposeInfos.end(), infos.begin(), infos.end());
         }
     } else {
         auto infoItem = innerServiceInfos_.find(bundleName);
@@ -168,10 +215,12 @@ BusinessType ServiceRouterDataMgr::GetBusinessType(const BusinessAbilityFilter &
 
 void ServiceRouterDataMgr::ClearAllBundleInfos()
 {
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     if (!innerServiceInfos_.empty()) {
         innerServiceInfos_.clear();
     }
+    businessAbilityIndex_.clear();
+    purposeIndex_.clear();
 }
 }  // namespace AbilityRuntime
 }  // namespace OHOS
@@ -24,6 +24,7 @@
 #include "service_info.h"
 #include "service_router_data_mgr.h"
 #include "service_router_mgr_proxy.h"
+#include "sr_constants.h"
 #include "want.h"
 
 using namespace testing::ext;
@@ -39,6 +40,30 @@ const std::string BUNDLE_NAME = "bundleName";
 const std::string PURPOSE_NAME = "pay";
 const int32_t ERR_COD1 = 8519924;
 const int32_t ERR_COD2 = 8388613;
+
+BundleInfo CreateBundleInfo(const std::string &bundleName, const std::string &purposeName,
+    const std::string &serviceType)
+{
+    ExtensionAbilityInfo extensionInfo;
+    extensionInfo.name = bundleName + ".ability";
+    extensionInfo.bundleName = bundleName;
+    extensionInfo.type = ExtensionAbilityType::UI;
+    Metadata purposeMetadata;
+    purposeMetadata.name = SrConstants::METADATA_SUPPORT_PURPOSE_KEY;
+    purposeMetadata.value = purposeName;
+    extensionInfo.metadata.emplace_back(purposeMetadata);
+    Metadata serviceTypeMetadata;
+    serviceTypeMetadata.name = SrConstants::METADATA_SERVICE_TYPE_KEY;
+    serviceTypeMetadata.value = serviceType;
+    extensionInfo.metadata.emplace_back(serviceTypeMetadata);
+
+    BundleInfo bundleInfo;
+    bundleInfo.name = bundleName;
+    bundleInfo.applicationInfo.name = bundleName;
+    bundleInfo.applicationInfo.bundleName = bundleName;
+    bundleInfo.extensionInfos.emplace_back(extensionInfo);
+    return bundleInfo;
+}
 }  // namespace
 
 class ServiceRouterMgrInterfaceTest : public testing::Test {
@@ -567,4 +592,109 @@ HWTEST_F(ServiceRouterMgrInterfaceTest, serviceRouterMgrProxy_0004, Function | S
     auto ret = serviceRouterMgrProxy->ConnectUIExtensionAbility(want, connect, sessionInfo, userId);
     EXPECT_EQ(ret, ERR_COD2);
 }
+
+/**
+ * @tc.number: ServiceRouterDataMgrIndex_0001
+ * @tc.name: test the business type and purpose name indexes
+ * @tc.desc: 1. insert bundles in reverse name order
+ *           2. the queries read the indexes in bundle name order
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterDataMgrIndex_0001, Function | SmallTest | Level0)
+{
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.b", PURPOSE_NAME, "share"));
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.a", PURPOSE_NAME, "share"));
+    EXPECT_EQ(serviceRouterMgr->innerServiceInfos_.size(), 2u);
+    EXPECT_EQ(serviceRouterMgr->businessAbilityIndex_[BusinessType::SHARE].size(), 2u);
+    EXPECT_EQ(serviceRouterMgr->purposeIndex_[PURPOSE_NAME].size(), 2u);
+
+    BusinessAbilityFilter filter;
+    filter.businessType = BusinessType::SHARE;
+    std::vector<BusinessAbilityInfo> abilityInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    ASSERT_EQ(abilityInfos.size(), 2u);
+    EXPECT_EQ(abilityInfos[0].bundleName, "com.example.a");
+    EXPECT_EQ(abilityInfos[1].bundleName, "com.example.b");
+
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    ASSERT_EQ(purposeInfos.size(), 2u);
+    EXPECT_EQ(purposeInfos[0].bundleName, "com.example.a");
+    EXPECT_EQ(purposeInfos[1].bundleName, "com.example.b");
+}
+
+/**
+ * @tc.number: ServiceRouterDataMgrIndex_0002
+ * @tc.name: test the indexes after a bundle update
+ * @tc.desc: 1. update a loaded bundle with another purpose and no business type
+ *           2. the old index entries of the bundle are replaced
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterDataMgrIndex_0002, Function | SmallTest | Level0)
+{
+    const std::string newPurposeName = "print";
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.a", PURPOSE_NAME, "share"));
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.b", PURPOSE_NAME, "share"));
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.a", newPurposeName, ""));
+    EXPECT_EQ(serviceRouterMgr->innerServiceInfos_.size(), 2u);
+
+    BusinessAbilityFilter filter;
+    filter.businessType = BusinessType::SHARE;
+    std::vector<BusinessAbilityInfo> abilityInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    ASSERT_EQ(abilityInfos.size(), 1u);
+    EXPECT_EQ(abilityInfos[0].bundleName, "com.example.b");
+
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    ASSERT_EQ(purposeInfos.size(), 1u);
+    EXPECT_EQ(purposeInfos[0].bundleName, "com.example.b");
+
+    purposeInfos.clear();
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, newPurposeName, purposeInfos), ERR_OK);
+    ASSERT_EQ(purposeInfos.size(), 1u);
+    EXPECT_EQ(purposeInfos[0].bundleName, "com.example.a");
+
+    // a second update with the same infos must not duplicate the index entries.
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.a", newPurposeName, ""));
+    purposeInfos.clear();
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, newPurposeName, purposeInfos), ERR_OK);
+    EXPECT_EQ(purposeInfos.size(), 1u);
+}
+
+/**
+ * @tc.number: ServiceRouterDataMgrIndex_0003
+ * @tc.name: test the indexes after a bundle delete
+ * @tc.desc: 1. delete the loaded bundles one by one
+ *           2. the empty index entries are erased
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterDataMgrIndex_0003, Function | SmallTest | Level0)
+{
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.a", PURPOSE_NAME, "share"));
+    serviceRouterMgr->UpdateBundleInfoLocked(CreateBundleInfo("com.example.b", PURPOSE_NAME, "share"));
+
+    serviceRouterMgr->DeleteBundleInfo("com.example.a");
+    EXPECT_EQ(serviceRouterMgr->innerServiceInfos_.size(), 1u);
+    BusinessAbilityFilter filter;
+    filter.businessType = BusinessType::SHARE;
+    std::vector<BusinessAbilityInfo> abilityInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    ASSERT_EQ(abilityInfos.size(), 1u);
+    EXPECT_EQ(abilityInfos[0].bundleName, "com.example.b");
+
+    serviceRouterMgr->DeleteBundleInfo("com.example.b");
+    EXPECT_TRUE(serviceRouterMgr->innerServiceInfos_.empty());
+    EXPECT_TRUE(serviceRouterMgr->businessAbilityIndex_.empty());
+    EXPECT_TRUE(serviceRouterMgr->purposeIndex_.empty());
+    abilityInfos.clear();
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    EXPECT_TRUE(abilityInfos.empty());
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    EXPECT_TRUE(purposeInfos.empty());
+}
 } // OHOS
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <list>
 #include <string>
 #include <mutex>
+#include <unordered_map>
 
 #include "ability_config.h"
 #include "ability_info.h"
@@ -42,7 +43,7 @@ public:
 
     /**
      * Init the ability cache manager with capacity for the device (devCapacity)
-     * and the capacity for a single process(procCapacity)
+     * and the capacity for a single process(procCapacity), 0 means no limit.
      */
     void Init(uint32_t devCapacity, uint32_t procCapacity);
 
@@ -113,19 +114,34 @@ public:
     private:
         AbilityCacheManager();
         ~AbilityCacheManager();
+        using RecordList = std::list<std::shared_ptr<AbilityRecord>>;
         struct ProcRecordsInfo {
-            std::list<std::shared_ptr<AbilityRecord>> recList;
-            uint32_t cnt;
+            RecordList recList;
+            uint32_t cnt = 0;
+        };
+        // position of a cached record in both lru lists, so that it can be unlinked without walking them.
+        struct CacheNode {
+            RecordList::iterator devIter;
+            RecordList::iterator procIter;
+            IRemoteObject *token = nullptr;
+            uint32_t accessTokenId = 0;
+            bool inDevList = false;
+            bool inProcList = false;
         };
         uint32_t devLruCapacity_ = 0;
         uint32_t procLruCapacity_ = 0;
         uint32_t devLruCnt_ = 0;
         std::mutex mutex_;
         std::map<uint32_t, ProcRecordsInfo> procLruMap_;
-        std::list<std::shared_ptr<AbilityRecord>> devRecLru_;
+        RecordList devRecLru_;
+        std::unordered_map<int, CacheNode> recordIndex_;
+        std::unordered_map<IRemoteObject *, int> tokenIndex_;
         std::shared_ptr<AbilityRecord> AddToProcLru(std::shared_ptr<AbilityRecord> abilityRecord);
         std::shared_ptr<AbilityRecord> AddToDevLru(std::shared_ptr<AbilityRecord> abilityRecord,
             std::shared_ptr<AbilityRecord> rec);
+        CacheNode &GetOrCreateCacheNode(const std::shared_ptr<AbilityRecord> &abilityRecord);
+        void EraseCacheNodeIfUnlinked(int recordId);
+        void EvictAbilityRec(std::shared_ptr<AbilityRecord> abilityRecord);
         void RemoveAbilityRecInDevList(std::shared_ptr<AbilityRecord> abilityRecord);
         void RemoveAbilityRecInProcList(std::shared_ptr<AbilityRecord> abilityRecord);
         std::shared_ptr<AbilityRecord> GetAbilityRecInProcList(const AbilityRequest &abilityRequest);
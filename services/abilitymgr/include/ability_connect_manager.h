@@ -28,6 +28,7 @@
 #include "event_handler_wrap.h"
 #include "ability_record.h"
 #include "ability_running_info.h"
+#include "ability_token_index.h"
 #include "event_report.h"
 #include "extension_config.h"
 #include "extension_running_info.h"
@@ -609,6 +610,7 @@ private:
     std::string GenerateBundleName(const AbilityRequest &abilityRequest) const;
 
     bool AddToServiceMap(const std::string &key, std::shared_ptr<AbilityRecord> abilityRecord);
+    void RemoveFromServiceMapLocked(const std::string &key);
     ServiceMapType GetServiceMap();
 
     void AddConnectObjectToMap(sptr<IRemoteObject> connectObject, const ConnectListType &connectRecordList,
@@ -633,6 +635,9 @@ private:
     ffrt::mutex serviceMapMutex_;
     ServiceMapType serviceMap_;
     std::list<std::shared_ptr<AbilityRecord>> terminatingExtensionList_;
+    // token indexes of serviceMap_ and terminatingExtensionList_.
+    AbilityTokenIndex serviceTokenIndex_;
+    AbilityTokenIndex terminatingTokenIndex_;
 
     std::mutex recipientMapMutex_;
     RecipientMapType recipientMap_;
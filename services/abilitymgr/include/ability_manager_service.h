@@ -1416,6 +1416,11 @@ public:
      */
     void AppUpgradeCompleted(const std::string &bundleName, int32_t uid);
 
+    /**
+     * Drop the interceptor verdicts cached for start requests, called on bundle events.
+     */
+    void ClearInterceptorVerdictCache();
+
     /**
      * Record app exit reason.
      * @param exitReason The reason of app exit.
@@ -1944,6 +1949,8 @@ private:
     void DumpUIExtensionProviderRunningInfos(pid_t pid, std::vector<std::string> &info);
     void DataDumpSysStateInner(
         const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
+    void DumpInterceptorStats(std::vector<std::string> &info);
+    void DumpPendingTimeouts(std::vector<std::string> &info);
     ErrCode ProcessMultiParam(std::vector<std::string>& argsStr, std::string& result);
     void ShowHelp(std::string& result);
     void ShowIllegalInfomation(std::string& result);
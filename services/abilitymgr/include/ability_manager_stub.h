@@ -18,6 +18,9 @@
 
 #include "ability_manager_interface.h"
 
+#include <atomic>
+#include <memory>
+#include <vector>
 #include <iremote_object.h>
 #include <iremote_stub.h>
 #ifdef WITH_DLP
@@ -39,6 +42,13 @@ public:
     virtual int OnRemoteRequest(
         uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
 
+    /**
+     * Dump the call count and cost histogram of every ipc code received so far.
+     *
+     * @param info, the dump result.
+     */
+    void DumpRequestStats(std::vector<std::string> &info);
+
     /**
      * Calls this interface to move the ability to the foreground.
      *
@@ -305,52 +315,32 @@ private:
     int32_t NotifyFrozenProcessByRSSInner(MessageParcel &data, MessageParcel &reply);
     int32_t CleanUIAbilityBySCBInner(MessageParcel &data, MessageParcel &reply);
     int32_t PreStartMissionInner(MessageParcel &data, MessageParcel &reply);
-    int OnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerThird(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerFourth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerFifth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerSixth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerSeventh(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerEighth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerNinth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerTenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerEleventh(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInner(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerTwelveth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerThirteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerFourteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerFifteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerSixteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerSeventeenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerEighteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int OnRemoteRequestInnerNineteenth(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int HandleOnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int HandleOnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
     int32_t OpenLinkInner(MessageParcel &data, MessageParcel &reply);
     int32_t TerminateMissionInner(MessageParcel &data, MessageParcel &reply);
+
+    using RequestFuncType = int (AbilityManagerStub::*)(MessageParcel &data, MessageParcel &reply);
+    struct RequestFuncEntry {
+        AbilityManagerInterfaceCode code;
+        RequestFuncType func;
+    };
+    struct RequestFuncTable {
+        RequestFuncTable(const RequestFuncEntry *begin, const RequestFuncEntry *end);
+        std::vector<RequestFuncEntry> entries;
+        std::vector<uint16_t> slots; // indexed by code, entry index + 1, 0 means not handled
+    };
+    static constexpr size_t REQUEST_COST_BUCKET_NUM = 5;
+    struct RequestStat {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> totalCostUs;
+        std::atomic<uint64_t> maxCostUs;
+        std::atomic<uint64_t> costBuckets[REQUEST_COST_BUCKET_NUM];
+    };
+
+    static const RequestFuncTable &GetRequestFuncTable();
+    int OnRemoteRequestInner(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option);
+    void RecordRequestCost(size_t index, int64_t costUs);
+
+    std::unique_ptr<RequestStat[]> requestStats_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
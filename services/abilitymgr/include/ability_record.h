@@ -73,7 +73,16 @@ public:
     std::shared_ptr<AbilityRecord> GetAbilityRecord() const;
     static std::shared_ptr<AbilityRecord> GetAbilityRecordByToken(const sptr<IRemoteObject> &token);
 
+    /**
+     * Get how many lookups missed the live token set and fell back to the descriptor check.
+     *
+     * @return the slow path count since start up.
+     */
+    static uint64_t GetSlowPathCount();
+
 private:
+    static bool IsLiveToken(const IRemoteObject *object);
+
     std::weak_ptr<AbilityRecord> abilityRecord_;  // ability of this token
 };
 
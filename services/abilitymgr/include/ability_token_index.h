@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_ABILITY_TOKEN_INDEX_H
+#define OHOS_ABILITY_RUNTIME_ABILITY_TOKEN_INDEX_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "ability_record.h"
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityTokenIndex
+ * Token keyed index of the ability records held by one container (mission list, terminate list, service map...).
+ * The owner updates it at every place the container is mutated and guards it with the container's lock.
+ * Token lookups only consult the index, so every record put into the container must be added here too.
+ */
+class AbilityTokenIndex {
+public:
+    AbilityTokenIndex() = default;
+    ~AbilityTokenIndex() = default;
+
+    void Add(const std::shared_ptr<AbilityRecord> &abilityRecord)
+    {
+        auto key = GetKey(abilityRecord);
+        if (key != nullptr) {
+            records_[key] = abilityRecord;
+        }
+    }
+
+    void Remove(const std::shared_ptr<AbilityRecord> &abilityRecord)
+    {
+        auto key = GetKey(abilityRecord);
+        if (key == nullptr) {
+            return;
+        }
+        auto iter = records_.find(key);
+        if (iter != records_.end() && iter->second == abilityRecord) {
+            records_.erase(iter);
+        }
+    }
+
+    std::shared_ptr<AbilityRecord> Find(const sptr<IRemoteObject> &token) const
+    {
+        if (token == nullptr) {
+            return nullptr;
+        }
+        auto iter = records_.find(token.GetRefPtr());
+        return iter != records_.end() ? iter->second : nullptr;
+    }
+
+    size_t Size() const
+    {
+        return records_.size();
+    }
+
+    void Clear()
+    {
+        records_.clear();
+    }
+
+private:
+    static IRemoteObject *GetKey(const std::shared_ptr<AbilityRecord> &abilityRecord)
+    {
+        if (abilityRecord == nullptr) {
+            return nullptr;
+        }
+        sptr<IRemoteObject> token = abilityRecord->GetToken();
+        return token.GetRefPtr();
+    }
+
+    std::unordered_map<IRemoteObject *, std::shared_ptr<AbilityRecord>> records_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_ABILITY_TOKEN_INDEX_H
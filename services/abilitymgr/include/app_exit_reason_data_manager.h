@@ -16,6 +16,7 @@
 #ifndef OHOS_ABILITY_RUNTIME_APP_EXIT_REASON_DATA_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_APP_EXIT_REASON_DATA_MANAGER_H
 
+#include <map>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -65,6 +66,10 @@ public:
 private:
     DistributedKv::Status GetKvStore();
     bool CheckKvStore();
+    bool LoadEntriesLocked();
+    DistributedKv::Status GetEntryLocked(const DistributedKv::Key &key, DistributedKv::Value &value);
+    DistributedKv::Status PutEntryLocked(const DistributedKv::Key &key, const DistributedKv::Value &value);
+    DistributedKv::Status DeleteEntryLocked(const DistributedKv::Key &key);
     DistributedKv::Value ConvertAppExitReasonInfoToValue(
         const std::vector<std::string> &abilityList, const AAFwk::ExitReason &exitReason);
     void ConvertAppExitReasonInfoFromValue(const DistributedKv::Value &value, AAFwk::ExitReason &exitReason,
@@ -89,6 +94,9 @@ private:
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable std::mutex kvStorePtrMutex_;
+    // write-through mirror of kvStorePtr_, keyed by tokenId, recover info key and "bundleName:extension".
+    std::map<std::string, DistributedKv::Value> entries_;
+    bool isEntriesLoaded_ = false;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -16,13 +16,24 @@
 #ifndef OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
 #define OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
 
+#include <atomic>
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "ability_interceptor_interface.h"
 #include "cpp/mutex.h"
 
 namespace OHOS {
 namespace AAFwk {
-using InterceptorMap = std::unordered_map<std::string, std::shared_ptr<IAbilityInterceptor>>;
+struct InterceptorStats {
+    uint64_t processCount = 0;
+    uint64_t rejectCount = 0;
+    uint64_t verdictHitCount = 0;
+    uint64_t totalCostUs = 0;
+    uint64_t maxCostUs = 0;
+};
+
 /**
  * @class AbilityInterceptorExecuter
  * AbilityInterceptorExecuter excute the interceptors.
@@ -43,17 +54,53 @@ public:
     void RemoveInterceptor(std::string interceptorName);
 
     /**
-     * Excute the DoProcess of the interceptors.
+     * Excute the DoProcess of the interceptors in the order they are added, the first reject is returned.
      */
     ErrCode DoProcess(AbilityInterceptorParam param);
 
     void SetTaskHandler(std::shared_ptr<AAFwk::TaskHandlerWrap> taskHandler);
+
+    /**
+     * Drop the cached verdicts, called on bundle events.
+     */
+    void ClearVerdictCache();
+
+    std::map<std::string, InterceptorStats> GetInterceptorStats();
 private:
-    InterceptorMap GetInterceptorMapCopy();
+    struct InterceptorCounters {
+        std::atomic<uint64_t> processCount = 0;
+        std::atomic<uint64_t> rejectCount = 0;
+        std::atomic<uint64_t> verdictHitCount = 0;
+        std::atomic<uint64_t> totalCostUs = 0;
+        std::atomic<uint64_t> maxCostUs = 0;
+    };
+    struct InterceptorEntry {
+        std::string name;
+        std::shared_ptr<IAbilityInterceptor> interceptor;
+        std::shared_ptr<InterceptorCounters> counters;
+    };
+    using InterceptorList = std::vector<InterceptorEntry>;
+    struct VerdictEntry {
+        wptr<IRemoteObject> caller;
+        std::unordered_set<std::string> passedInterceptors;
+    };
+
+    std::shared_ptr<const InterceptorList> GetInterceptorList();
+    ErrCode ProcessInterceptor(const InterceptorEntry &entry, const AbilityInterceptorParam &param);
+    static std::string GetVerdictKey(const AbilityInterceptorParam &param);
+    bool IsVerdictPassed(const std::string &key, const std::string &name, const AbilityInterceptorParam &param);
+    void SetVerdictPassed(const std::string &key, const std::string &name, const AbilityInterceptorParam &param,
+        uint64_t generation);
 private:
     std::recursive_mutex interceptorMapLock_;
-    std::unordered_map<std::string, std::shared_ptr<IAbilityInterceptor>> interceptorMap_;
+    // replaced on add and remove, DoProcess walks a snapshot without copying the interceptors.
+    std::shared_ptr<const InterceptorList> interceptorList_ = std::make_shared<InterceptorList>();
+
+    ffrt::mutex verdictLock_;
+    // bumped by ClearVerdictCache, guards verdicts racing with it.
+    uint64_t verdictGeneration_ = 0;
+    std::unordered_map<std::string, VerdictEntry> verdictCache_;
 };
 } // namespace AAFwk
 } // namespace OHOS
-#endif // OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
\ No newline at end of file
+#endif // OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
@@ -59,6 +59,15 @@ public:
      * Set handler for async task executing.
      */
     virtual void SetTaskHandler(std::shared_ptr<AAFwk::TaskHandlerWrap> taskHandler) {};
+
+    /**
+     * Whether a pass of this request may be reused for the same caller, target and user until the next
+     * bundle event.
+     */
+    virtual bool IsVerdictCacheable(const AbilityInterceptorParam &param)
+    {
+        return false;
+    }
 };
 } // namespace AAFwk
 } // namespace OHOS
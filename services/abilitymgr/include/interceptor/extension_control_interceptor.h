@@ -26,6 +26,7 @@ public:
     ExtensionControlInterceptor() = default;
     ~ExtensionControlInterceptor() = default;
     ErrCode DoProcess(AbilityInterceptorParam param) override;
+    bool IsVerdictCacheable(const AbilityInterceptorParam &param) override;
 private:
     bool IsExtensionStartThirdPartyAppEnable(std::string extensionTypeName, std::string targetBundleName);
     bool IsExtensionStartServiceEnable(std::string extensionTypeName, std::string targetUri);
@@ -17,8 +17,10 @@
 #define OHOS_ABILITY_RUNTIME_MISSION_DATA_STORAGE_H
 
 #include <list>
+#include <map>
 #include <mutex>
 #include <queue>
+#include <vector>
 #include "cpp/mutex.h"
 
 #include "inner_mission_info.h"
@@ -31,6 +33,8 @@ constexpr const char* MISSION_DATA_FILE_PATH = "MissionInfo";
 constexpr const char* MISSION_JSON_FILE_PREFIX = "mission";
 constexpr const char* LOW_RESOLUTION_FLAG = "little";
 constexpr const char* JSON_FILE_SUFFIX = ".json";
+constexpr const char* MISSION_JOURNAL_FILE_NAME = "mission_journal.log";
+constexpr const char* MISSION_JOURNAL_TMP_SUFFIX = ".tmp";
 constexpr const char* JPEG_FILE_SUFFIX = ".jpg";
 constexpr const char* FILE_SEPARATOR = "/";
 constexpr const char* UNDERLINE_SEPARATOR = "_";
@@ -60,6 +64,30 @@ public:
      */
     void DeleteMissionInfo(int missionId);
 
+    /**
+     * @brief Queue a mission update for the next journal flush, only the latest update of a mission is kept.
+     * @param missionInfo Indicates the missionInfo object to be save.
+     * @return Returns true if the caller should schedule FlushPendingMissionInfo; returns false otherwise.
+     */
+    bool EnqueueSaveMissionInfo(const InnerMissionInfo &missionInfo);
+
+    /**
+     * @brief Queue a mission removal for the next journal flush.
+     * @param missionId Indicates this mission id.
+     * @return Returns true if the caller should schedule FlushPendingMissionInfo; returns false otherwise.
+     */
+    bool EnqueueDeleteMissionInfo(int missionId);
+
+    /**
+     * @brief Append all queued mission updates to the journal with a single write.
+     */
+    void FlushPendingMissionInfo();
+
+    /**
+     * @brief Drop all queued mission updates without writing them, used before the user dir is removed.
+     */
+    void DiscardPendingMissionInfo();
+
     /**
      * @brief Save mission snapshot
      * @param missionId Indicates this mission id.
@@ -112,6 +140,28 @@ private:
 
     bool CheckFileNameValid(const std::string &fileName);
 
+    struct JournalRecord {
+        int32_t missionId = -1;
+        bool isDelete = false;
+        std::string content;
+    };
+
+    std::string GetMissionJournalFilePath() const;
+
+    bool EnsureMissionDataDir();
+
+    void LoadLegacyMissionFiles(std::vector<std::string> &legacyFiles);
+
+    void ReplayMissionJournal();
+
+    void CommitJournalRecordsLocked(const std::vector<JournalRecord> &records);
+
+    bool CompactMissionJournalLocked();
+
+    static std::string EncodeJournalRecord(const JournalRecord &record);
+
+    static bool DecodeJournalRecord(const std::string &line, JournalRecord &record);
+
 #ifdef SUPPORT_SCREEN
     template<typename T>
     void WriteToJpeg(const std::string &filePath, T &snapshot) const;
@@ -133,6 +183,14 @@ private:
 
     int userId_ = 0;
     ffrt::mutex cachedPixelMapMutex_;
+
+    // journal state, liveRecords_ mirrors the journal content once it has been loaded.
+    ffrt::mutex journalMutex_;
+    std::map<int32_t, std::string> liveRecords_;
+    std::map<int32_t, JournalRecord> pendingRecords_;
+    size_t journalRecordCount_ = 0;
+    bool isJournalLoaded_ = false;
+    bool isFlushScheduled_ = false;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
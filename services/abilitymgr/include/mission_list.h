@@ -21,6 +21,7 @@
 
 #include "ability_manager_constants.h"
 #include "ability_record.h"
+#include "ability_token_index.h"
 #include "iremote_object.h"
 #include "mission.h"
 
@@ -38,7 +39,8 @@ enum MissionListType {
 class MissionList : public std::enable_shared_from_this<MissionList> {
 public:
     explicit MissionList(MissionListType type = MissionListType::CURRENT);
-    explicit MissionList(const MissionList& missionList) : type_(missionList.type_), missions_(missionList.missions_) {}
+    explicit MissionList(const MissionList& missionList)
+        : type_(missionList.type_), missions_(missionList.missions_), tokenIndex_(missionList.tokenIndex_) {}
     virtual ~MissionList();
 
     /**
@@ -230,9 +232,12 @@ public:
 private:
     std::string GetTypeName();
     bool MatchedInitialMission(const std::shared_ptr<Mission>& mission, const std::string &bundleName, int32_t uid);
+    void RemoveFromTokenIndex(const std::shared_ptr<Mission> &mission);
 
     MissionListType type_;
     std::list<std::shared_ptr<Mission>> missions_ {};
+    // ability records of missions_ keyed by token.
+    AbilityTokenIndex tokenIndex_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -23,6 +23,7 @@
 #include "cpp/mutex.h"
 
 #include "ability_running_info.h"
+#include "ability_token_index.h"
 #include "mission_list.h"
 #include "mission_list_manager_interface.h"
 #include "mission_listener_controller.h"
@@ -529,7 +530,7 @@ private:
     int TerminateAbilityInner(const std::shared_ptr<AbilityRecord> &abilityRecord,
         int resultCode, const Want *resultWant, bool flag);
     int32_t GetMissionIdByAbilityTokenInner(const sptr<IRemoteObject> &token);
-    std::shared_ptr<AbilityRecord> GetAbilityFromTerminateListInner(const sptr<IRemoteObject> &token);
+    std::shared_ptr<AbilityRecord> GetAbilityFromTerminateListInner(const sptr<IRemoteObject> &token) const;
     void SetLastExitReason(std::shared_ptr<AbilityRecord> &abilityRecord);
     bool IsAppLastAbility(const std::shared_ptr<AbilityRecord> &abilityRecord);
     std::shared_ptr<MissionList> GetMissionList(int32_t missionId);
@@ -551,6 +552,8 @@ private:
     std::shared_ptr<MissionList> defaultSingleList_;
     std::shared_ptr<MissionList> launcherList_;
     std::list<std::shared_ptr<AbilityRecord>> terminateAbilityList_;
+    // terminateAbilityList_ keyed by token.
+    AbilityTokenIndex terminateTokenIndex_;
 
     std::queue<AbilityRequest> waitingAbilityQueue_;
     std::shared_ptr<MissionListenerController> listenerController_;
@@ -57,6 +57,12 @@ public:
     bool IsEqualsRequestWant(const Want &otherWant);
     int32_t GetAppIndex();
 
+    /**
+     * Hash over the fields compared by PendingWantManager when looking a record up,
+     * so that equal keys always have equal hash codes.
+     */
+    size_t GetHashCode();
+
 private:
     int32_t type_ = {};
     std::string bundleName_ = {};
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include "cpp/mutex.h"
@@ -166,6 +167,10 @@ private:
     void MakeWantSenderCanceledLocked(PendingWantRecord &record);
 
     sptr<PendingWantRecord> GetPendingWantRecordByKey(const std::shared_ptr<PendingWantKey> &key);
+    void InsertWantRecordLocked(const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record);
+    void EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key);
+    void AddKeyIndexLocked(const std::shared_ptr<PendingWantKey> &key);
+    void RemoveKeyIndexLocked(const std::shared_ptr<PendingWantKey> &key);
     bool CheckPendingWantRecordByKey(
         const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key);
 
@@ -177,6 +182,8 @@ private:
 
 private:
     std::map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>> wantRecords_;
+    // hash code of PendingWantKey to the keys of wantRecords_, kept in sync with wantRecords_
+    std::unordered_multimap<size_t, std::shared_ptr<PendingWantKey>> wantRecordsIndex_;
     ffrt::mutex mutex_;
 };
 }  // namespace AAFwk
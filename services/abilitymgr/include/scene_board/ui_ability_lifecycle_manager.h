@@ -25,6 +25,7 @@
 
 #include "ability_manager_constants.h"
 #include "ability_record.h"
+#include "ability_token_index.h"
 #include "isession_handler_interface.h"
 
 namespace OHOS {
@@ -452,6 +453,9 @@ private:
     std::unordered_map<int32_t, std::shared_ptr<AbilityRecord>> sessionAbilityMap_;
     std::unordered_map<int64_t, std::shared_ptr<AbilityRecord>> tmpAbilityMap_;
     std::list<std::shared_ptr<AbilityRecord>> terminateAbilityList_;
+    // token indexes of sessionAbilityMap_ and terminateAbilityList_.
+    AbilityTokenIndex sessionTokenIndex_;
+    AbilityTokenIndex terminateTokenIndex_;
     sptr<IRemoteObject> rootSceneSession_;
     std::map<SpecifiedInfo, std::shared_ptr<AbilityRecord>, key_compare> specifiedAbilityMap_;
     int32_t specifiedRequestId_ = 0;
@@ -27,8 +27,7 @@
 namespace OHOS {
 namespace AAFwk {
 constexpr const char* THREAD_NAME = "TaskDataStorage";
-constexpr const char* SAVE_MISSION_INFO = "SaveMissionInfo";
-constexpr const char* DELETE_MISSION_INFO = "DeleteMissionInfo";
+constexpr const char* FLUSH_MISSION_INFO = "FlushMissionInfo";
 constexpr const char* SAVE_MISSION_SNAPSHOT = "SaveMissionSnapshot";
 constexpr const char* GET_MISSION_SNAPSHOT = "GetMissionSnapshot";
 
@@ -96,6 +95,10 @@ public:
     bool GetMissionSnapshot(int missionId, MissionSnapshot& missionSnapshot, bool isLowResolution);
 
 private:
+    void ScheduleFlushMissionInfo();
+
+    static constexpr int64_t FLUSH_MISSION_INFO_DELAY_MS = 100;
+
     std::unordered_map<int, std::shared_ptr<MissionDataStorage>> missionDataStorageMgr_;
     std::shared_ptr<MissionDataStorage> currentMissionDataStorage_;
     std::shared_ptr<TaskHandlerWrap> handler_;
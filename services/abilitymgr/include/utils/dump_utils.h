@@ -45,6 +45,9 @@ public:
         KEY_DUMP_SYS_PENDING,
         KEY_DUMP_SYS_PROCESS,
         KEY_DUMP_SYS_DATA,
+        KEY_DUMP_SYS_IPC,
+        KEY_DUMP_SYS_INTERCEPTOR,
+        KEY_DUMP_SYS_TIMEOUT,
     };
 
     static std::pair<bool, DumpUtils::DumpKey> DumpMapOne(std::string argString);
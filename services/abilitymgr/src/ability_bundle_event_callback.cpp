@@ -52,6 +52,10 @@ void AbilityBundleEventCallback::OnReceiveEvent(const EventFwk::CommonEventData
         return;
     }
     TAG_LOGD(AAFwkTag::ABILITYMGR, "OnReceiveEvent, action:%{public}s.", action.c_str());
+    auto abilityMgr = DelayedSingleton<AbilityManagerService>::GetInstance();
+    if (abilityMgr != nullptr) {
+        abilityMgr->ClearInterceptorVerdictCache();
+    }
 
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED) {
         // uninstall bundle
@@ -34,88 +34,112 @@ AbilityCacheManager &AbilityCacheManager::GetInstance()
 
 void AbilityCacheManager::Init(uint32_t devCapacity, uint32_t procCapacity)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     devLruCapacity_ = devCapacity;
     procLruCapacity_ = procCapacity;
 }
 
-void AbilityCacheManager::RemoveAbilityRecInDevList(std::shared_ptr<AbilityRecord> abilityRecord)
+AbilityCacheManager::CacheNode &AbilityCacheManager::GetOrCreateCacheNode(
+    const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    auto it = devRecLru_.begin();
-    uint32_t accessTokenId = abilityRecord->GetApplicationInfo().accessTokenId;
-    while (it != devRecLru_.end()) {
-        if ((*it)->GetRecordId() == abilityRecord->GetRecordId()) {
-            devRecLru_.erase(it);
-            devLruCnt_--;
-            return;
-        } else {
-            it++;
+    auto [it, isNew] = recordIndex_.try_emplace(abilityRecord->GetRecordId());
+    if (isNew) {
+        it->second.accessTokenId = abilityRecord->GetApplicationInfo().accessTokenId;
+        auto token = abilityRecord->GetToken();
+        if (token != nullptr) {
+            it->second.token = token.GetRefPtr();
+            tokenIndex_[it->second.token] = abilityRecord->GetRecordId();
         }
     }
+    return it->second;
+}
+
+void AbilityCacheManager::EraseCacheNodeIfUnlinked(int recordId)
+{
+    auto it = recordIndex_.find(recordId);
+    if (it == recordIndex_.end() || it->second.inDevList || it->second.inProcList) {
+        return;
+    }
+    auto tokenIt = tokenIndex_.find(it->second.token);
+    if (tokenIt != tokenIndex_.end() && tokenIt->second == recordId) {
+        tokenIndex_.erase(tokenIt);
+    }
+    recordIndex_.erase(it);
+}
+
+void AbilityCacheManager::RemoveAbilityRecInDevList(std::shared_ptr<AbilityRecord> abilityRecord)
+{
+    auto it = recordIndex_.find(abilityRecord->GetRecordId());
+    if (it == recordIndex_.end() || !it->second.inDevList) {
+        return;
+    }
+    CacheNode &node = it->second;
+    devRecLru_.erase(node.devIter);
+    node.inDevList = false;
+    devLruCnt_--;
+    EraseCacheNodeIfUnlinked(abilityRecord->GetRecordId());
 }
 
 void AbilityCacheManager::RemoveAbilityRecInProcList(std::shared_ptr<AbilityRecord> abilityRecord)
 {
-    const Want want = abilityRecord->GetWant();
-    uint32_t accessTokenId = abilityRecord->GetApplicationInfo().accessTokenId;
-    auto findProcInfo = procLruMap_.find(accessTokenId);
-    if (findProcInfo == procLruMap_.end()) {
+    auto it = recordIndex_.find(abilityRecord->GetRecordId());
+    if (it == recordIndex_.end() || !it->second.inProcList) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "Can't found the abilityRecord in process list for remove.");
         return;
     }
-    auto it = findProcInfo->second.recList.begin();
-
-    while (it != findProcInfo->second.recList.end()) {
-        if ((*it)->GetRecordId() == abilityRecord->GetRecordId()) {
-            findProcInfo->second.recList.erase(it);
-            findProcInfo->second.cnt--;
-            if (findProcInfo->second.cnt == 0) {
-                procLruMap_.erase(findProcInfo);
-            }
-            return;
-        } else {
-            it++;
+    CacheNode &node = it->second;
+    auto findProcInfo = procLruMap_.find(node.accessTokenId);
+    if (findProcInfo != procLruMap_.end()) {
+        findProcInfo->second.recList.erase(node.procIter);
+        findProcInfo->second.cnt--;
+        if (findProcInfo->second.cnt == 0) {
+            procLruMap_.erase(findProcInfo);
         }
     }
+    node.inProcList = false;
+    EraseCacheNodeIfUnlinked(abilityRecord->GetRecordId());
+}
+
+void AbilityCacheManager::EvictAbilityRec(std::shared_ptr<AbilityRecord> abilityRecord)
+{
+    RemoveAbilityRecInProcList(abilityRecord);
+    RemoveAbilityRecInDevList(abilityRecord);
 }
 
 std::shared_ptr<AbilityRecord> AbilityCacheManager::AddToProcLru(std::shared_ptr<AbilityRecord> abilityRecord)
 {
-    auto findProcInfo = procLruMap_.find(abilityRecord->GetApplicationInfo().accessTokenId);
-    if (findProcInfo == procLruMap_.end()) {
-        std::list<std::shared_ptr<AbilityRecord>> recList;
-        ProcRecordsInfo procRecInfo = {recList, 1};
-        procRecInfo.recList.push_back(abilityRecord);
-        procLruMap_[abilityRecord->GetApplicationInfo().accessTokenId] = procRecInfo;
+    CacheNode &node = GetOrCreateCacheNode(abilityRecord);
+    if (node.inProcList) {
         return nullptr;
     }
-    if (findProcInfo->second.cnt == procLruCapacity_) {
-        RemoveAbilityRecInDevList(findProcInfo->second.recList.front());
-        std::shared_ptr<AbilityRecord> rec = findProcInfo->second.recList.front();
-        findProcInfo->second.recList.pop_front();
-        findProcInfo->second.recList.push_back(abilityRecord);
-        return rec;
+    ProcRecordsInfo &procRecInfo = procLruMap_[node.accessTokenId];
+    node.procIter = procRecInfo.recList.insert(procRecInfo.recList.end(), abilityRecord);
+    node.inProcList = true;
+    procRecInfo.cnt++;
+    if (procLruCapacity_ == 0 || procRecInfo.cnt <= procLruCapacity_) {
+        return nullptr;
     }
-    findProcInfo->second.cnt++;
-    findProcInfo->second.recList.push_back(abilityRecord);
-    return nullptr;
+    // a put adds one record, so at most the least recently used one of the process is over the capacity.
+    std::shared_ptr<AbilityRecord> rec = procRecInfo.recList.front();
+    EvictAbilityRec(rec);
+    return rec;
 }
 
 std::shared_ptr<AbilityRecord> AbilityCacheManager::AddToDevLru(std::shared_ptr<AbilityRecord> abilityRecord,
     std::shared_ptr<AbilityRecord> rec)
 {
-    if (rec != nullptr) {
-        devRecLru_.push_back(abilityRecord);
+    CacheNode &node = GetOrCreateCacheNode(abilityRecord);
+    if (!node.inDevList) {
+        node.devIter = devRecLru_.insert(devRecLru_.end(), abilityRecord);
+        node.inDevList = true;
         devLruCnt_++;
-        return rec;
     }
-    if (devLruCnt_ == devLruCapacity_) {
-        rec = devRecLru_.front();
-        RemoveAbilityRecInProcList(rec);
-        devRecLru_.pop_front();
-        devLruCnt_--;
+    // the record eliminated from the process list has already left the device list too.
+    if (rec != nullptr || devLruCapacity_ == 0 || devLruCnt_ <= devLruCapacity_) {
+        return rec;
     }
-    devRecLru_.push_back(abilityRecord);
-    devLruCnt_++;
+    rec = devRecLru_.front();
+    EvictAbilityRec(rec);
     return rec;
 }
 
@@ -128,6 +152,11 @@ std::shared_ptr<AbilityRecord> AbilityCacheManager::Put(std::shared_ptr<AbilityR
     TAG_LOGD(AAFwkTag::ABILITYMGR, "Put the ability to lru, service:%{public}s, extension type %{public}d",
         abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
     std::lock_guard<std::mutex> lock(mutex_);
+    if (recordIndex_.find(abilityRecord->GetRecordId()) != recordIndex_.end()) {
+        // put again, refresh it as the most recently used one.
+        RemoveAbilityRecInProcList(abilityRecord);
+        RemoveAbilityRecInDevList(abilityRecord);
+    }
     std::shared_ptr<AbilityRecord> rec = AddToProcLru(abilityRecord);
     return AddToDevLru(abilityRecord, rec);
 }
@@ -159,16 +188,12 @@ std::shared_ptr<AbilityRecord> AbilityCacheManager::GetAbilityRecInProcList(cons
         TAG_LOGE(AAFwkTag::ABILITYMGR, "Can't found the bundleName in process list for get.");
         return nullptr;
     }
-    ProcRecordsInfo &procRecordsInfo = findProcInfo->second;
-    auto recIter = procRecordsInfo.recList.begin();
-    while (recIter != procRecordsInfo.recList.end()) {
-        if (IsRecInfoSame(abilityRequest, *recIter)) {
-            std::shared_ptr<AbilityRecord> abilityRecord = *recIter;
-            procRecordsInfo.recList.erase(recIter);
-            procRecordsInfo.cnt--;
+    for (const auto &rec : findProcInfo->second.recList) {
+        if (IsRecInfoSame(abilityRequest, rec)) {
+            std::shared_ptr<AbilityRecord> abilityRecord = rec;
+            RemoveAbilityRecInProcList(abilityRecord);
             return abilityRecord;
         }
-        recIter++;
     }
     TAG_LOGD(AAFwkTag::ABILITYMGR, "Can't found the abilityRecord in process list for get.");
     return nullptr;
@@ -195,20 +220,19 @@ std::shared_ptr<AbilityRecord> AbilityCacheManager::FindRecordByToken(const sptr
         return nullptr;
     }
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = devRecLru_.begin();
-    while (it != devRecLru_.end()) {
-        sptr<IRemoteObject> srcToken = (*it)->GetToken();
-        if (srcToken == token) {
-            std::shared_ptr<AbilityRecord> &abilityRecord = *it;
-            TAG_LOGD(AAFwkTag::ABILITYMGR,
-                "Find the ability by token from lru, service:%{public}s, extension type %{public}d",
-                abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
-            return abilityRecord;
-        } else {
-            it++;
-        }
+    auto tokenIt = tokenIndex_.find(token.GetRefPtr());
+    if (tokenIt == tokenIndex_.end()) {
+        return nullptr;
     }
-    return nullptr;
+    auto nodeIt = recordIndex_.find(tokenIt->second);
+    if (nodeIt == recordIndex_.end() || !nodeIt->second.inDevList) {
+        return nullptr;
+    }
+    std::shared_ptr<AbilityRecord> &abilityRecord = *(nodeIt->second.devIter);
+    TAG_LOGD(AAFwkTag::ABILITYMGR,
+        "Find the ability by token from lru, service:%{public}s, extension type %{public}d",
+        abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
+    return abilityRecord;
 }
 
 std::list<std::shared_ptr<AbilityRecord>> AbilityCacheManager::GetAbilityList()
@@ -294,11 +318,11 @@ void AbilityCacheManager::DeleteInvalidServiceRecord(const std::string &bundleNa
     auto it = devRecLru_.begin();
     while (it != devRecLru_.end()) {
         auto abilityRecord = *it;
+        it++;
         if (abilityRecord != nullptr && abilityRecord->GetApplicationInfo().bundleName == bundleName) {
             RemoveAbilityRecInProcList(abilityRecord);
             RemoveAbilityRecInDevList(abilityRecord);
         }
-        it++;
     }
 }
 }  // namespace AAFwk
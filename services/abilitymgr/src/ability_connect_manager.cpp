@@ -492,7 +492,7 @@ void AbilityConnectManager::GetOrCreateServiceRecord(const AbilityRequest &abili
             TAG_LOGI(AAFwkTag::ABILITYMGR, "Removing ability: %{public}s", element.GetURI().c_str());
         }
         std::lock_guard lock(serviceMapMutex_);
-        serviceMap_.erase(serviceKey);
+        RemoveFromServiceMapLocked(serviceKey);
     }
     isLoadedAbility = true;
     if (noReuse || targetService == nullptr) {
@@ -1073,7 +1073,7 @@ void AbilityConnectManager::TerminateOrCacheAbility(std::shared_ptr<AbilityRecor
         }
         {
             std::lock_guard lock(serviceMapMutex_);
-            serviceMap_.erase(serviceKey);
+            RemoveFromServiceMapLocked(serviceKey);
         }
         auto eliminateRecord = AbilityCacheManager::GetInstance().Put(abilityRecord);
         if (eliminateRecord != nullptr) {
@@ -1283,19 +1283,8 @@ std::shared_ptr<AbilityRecord> AbilityConnectManager::GetServiceRecordByElementN
 std::shared_ptr<AbilityRecord> AbilityConnectManager::GetExtensionByTokenFromServiceMap(
     const sptr<IRemoteObject> &token)
 {
-    auto IsMatch = [token](auto service) {
-        if (!service.second) {
-            return false;
-        }
-        sptr<IRemoteObject> srcToken = service.second->GetToken();
-        return srcToken == token;
-    };
     std::lock_guard lock(serviceMapMutex_);
-    auto serviceRecord = std::find_if(serviceMap_.begin(), serviceMap_.end(), IsMatch);
-    if (serviceRecord != serviceMap_.end()) {
-        return serviceRecord->second;
-    }
-    return nullptr;
+    return serviceTokenIndex_.Find(token);
 }
 
 std::shared_ptr<AbilityRecord> AbilityConnectManager::GetExtensionByTokenFromAbilityCache(
@@ -1355,24 +1344,8 @@ std::shared_ptr<AbilityRecord> AbilityConnectManager::GetUIExtensioBySessionInfo
 std::shared_ptr<AbilityRecord> AbilityConnectManager::GetExtensionByTokenFromTerminatingMap(
     const sptr<IRemoteObject> &token)
 {
-    auto IsMatch = [token](auto& extensionRecord) {
-        if (extensionRecord == nullptr) {
-            return false;
-        }
-        auto terminatingToken = extensionRecord->GetToken();
-        if (terminatingToken != nullptr) {
-            return terminatingToken->AsObject() == token;
-        }
-        return false;
-    };
-
     std::lock_guard lock(serviceMapMutex_);
-    auto terminatingExtensionRecord =
-        std::find_if(terminatingExtensionList_.begin(), terminatingExtensionList_.end(), IsMatch);
-    if (terminatingExtensionRecord != terminatingExtensionList_.end()) {
-        return *terminatingExtensionRecord;
-    }
-    return nullptr;
+    return terminatingTokenIndex_.Find(token);
 }
 
 std::list<std::shared_ptr<ConnectionRecord>> AbilityConnectManager::GetConnectRecordListByCallback(
@@ -1939,6 +1912,7 @@ void AbilityConnectManager::RemoveServiceAbility(const std::shared_ptr<AbilityRe
     TAG_LOGD(AAFwkTag::ABILITYMGR, "Remove service(%{public}s) from terminating map.", abilityRecord->GetURI().c_str());
     std::lock_guard lock(serviceMapMutex_);
     terminatingExtensionList_.remove(abilityRecord);
+    terminatingTokenIndex_.Remove(abilityRecord);
 }
 
 void AbilityConnectManager::AddConnectDeathRecipient(sptr<IRemoteObject> connectObject)
@@ -2284,6 +2258,7 @@ void AbilityConnectManager::CloseAssertDialog(const std::string &assertSessionId
             auto assertSessionStr = item.second->GetWant().GetStringParam(Want::PARAM_ASSERT_FAULT_SESSION_ID);
             if (assertSessionStr == assertSessionId) {
                 abilityRecord = item.second;
+                serviceTokenIndex_.Remove(item.second);
                 serviceMap_.erase(item.first);
                 break;
             }
@@ -2297,7 +2272,11 @@ void AbilityConnectManager::CloseAssertDialog(const std::string &assertSessionId
         return;
     }
     TAG_LOGD(AAFwkTag::ABILITYMGR, "Terminate assert fault dialog");
-    terminatingExtensionList_.push_back(abilityRecord);
+    {
+        std::lock_guard lock(serviceMapMutex_);
+        terminatingExtensionList_.push_back(abilityRecord);
+        terminatingTokenIndex_.Add(abilityRecord);
+    }
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     if (token != nullptr) {
         std::lock_guard lock(serialMutex_);
@@ -2574,6 +2553,8 @@ void AbilityConnectManager::PauseExtensions()
             if (targetExtension != nullptr && targetExtension->GetAbilityInfo().type == AbilityType::EXTENSION &&
                 (IsLauncher(targetExtension) || targetExtension->IsSceneBoard())) {
                 terminatingExtensionList_.push_back(it->second);
+                terminatingTokenIndex_.Add(it->second);
+                serviceTokenIndex_.Remove(it->second);
                 it = serviceMap_.erase(it);
                 TAG_LOGI(AAFwkTag::ABILITYMGR, "terminate ability:%{public}s.",
                     targetExtension->GetAbilityInfo().name.c_str());
@@ -2802,13 +2783,14 @@ void AbilityConnectManager::MoveToTerminatingMap(const std::shared_ptr<AbilityRe
     auto& abilityInfo = abilityRecord->GetAbilityInfo();
     std::lock_guard lock(serviceMapMutex_);
     terminatingExtensionList_.push_back(abilityRecord);
+    terminatingTokenIndex_.Add(abilityRecord);
     std::string serviceKey = abilityRecord->GetURI();
     if (FRS_BUNDLE_NAME == abilityInfo.bundleName) {
         AppExecFwk::ElementName element(abilityInfo.deviceId, abilityInfo.bundleName, abilityInfo.name,
             abilityInfo.moduleName);
         serviceKey = element.GetURI() + std::to_string(abilityRecord->GetWant().GetIntParam(FRS_APP_INDEX, 0));
     }
-    serviceMap_.erase(serviceKey);
+    RemoveFromServiceMapLocked(serviceKey);
     AbilityCacheManager::GetInstance().Remove(abilityRecord);
     if (IsSpecialAbility(abilityRecord->GetAbilityInfo())) {
         TAG_LOGI(AAFwkTag::ABILITYMGR, "Moving ability: %{public}s", abilityRecord->GetURI().c_str());
@@ -3124,6 +3106,7 @@ void AbilityConnectManager::DeleteInvalidServiceRecord(const std::string &bundle
     for (auto it = serviceMap_.begin(); it != serviceMap_.end();) {
         if (it->second != nullptr && it->second->GetApplicationInfo().bundleName == bundleName &&
             !IsUIExtensionAbility(it->second) && !IsAbilityNeedKeepAlive(it->second)) {
+            serviceTokenIndex_.Remove(it->second);
             it = serviceMap_.erase(it);
         } else {
             ++it;
@@ -3139,9 +3122,22 @@ bool AbilityConnectManager::AddToServiceMap(const std::string &key, std::shared_
         return false;
     }
     auto insert = serviceMap_.emplace(key, abilityRecord);
+    if (insert.second) {
+        serviceTokenIndex_.Add(abilityRecord);
+    }
     return insert.second;
 }
 
+void AbilityConnectManager::RemoveFromServiceMapLocked(const std::string &key)
+{
+    auto iter = serviceMap_.find(key);
+    if (iter == serviceMap_.end()) {
+        return;
+    }
+    serviceTokenIndex_.Remove(iter->second);
+    serviceMap_.erase(iter);
+}
+
 AbilityConnectManager::ServiceMapType AbilityConnectManager::GetServiceMap()
 {
     std::lock_guard lock(serviceMapMutex_);
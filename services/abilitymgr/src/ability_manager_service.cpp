@@ -2172,6 +2172,45 @@ bool AbilityManagerService::IsDmsAlive() const
     return g_isDmsAlive.load();
 }
 
+void AbilityManagerService::ClearInterceptorVerdictCache()
+{
+    if (interceptorExecuter_ != nullptr) {
+        interceptorExecuter_->ClearVerdictCache();
+    }
+    if (afterCheckExecuter_ != nullptr) {
+        afterCheckExecuter_->ClearVerdictCache();
+    }
+}
+
+void AbilityManagerService::DumpInterceptorStats(std::vector<std::string> &info)
+{
+    auto dumpExecuter = [&info](const std::string &title,
+        const std::shared_ptr<AbilityInterceptorExecuter> &executer) {
+        if (executer == nullptr) {
+            return;
+        }
+        info.push_back(title);
+        for (const auto &[name, stats] : executer->GetInterceptorStats()) {
+            uint64_t avgCostUs = stats.processCount == 0 ? 0 : stats.totalCostUs / stats.processCount;
+            info.push_back("  " + name + " process:" + std::to_string(stats.processCount) +
+                " reject:" + std::to_string(stats.rejectCount) +
+                " verdictHit:" + std::to_string(stats.verdictHitCount) +
+                " avgUs:" + std::to_string(avgCostUs) + " maxUs:" + std::to_string(stats.maxCostUs));
+        }
+    };
+    dumpExecuter("Interceptor stats:", interceptorExecuter_);
+    dumpExecuter("After check interceptor stats:", afterCheckExecuter_);
+}
+
+void AbilityManagerService::DumpPendingTimeouts(std::vector<std::string> &info)
+{
+    CHECK_POINTER(taskHandler_);
+    info.push_back("Pending timeouts: " + std::to_string(taskHandler_->GetPendingTimeoutCount()));
+    for (const auto &[category, count] : taskHandler_->GetPendingTimeoutCountByCategory()) {
+        info.push_back("  " + category + ": " + std::to_string(count));
+    }
+}
+
 void AbilityManagerService::AppUpgradeCompleted(const std::string &bundleName, int32_t uid)
 {
     if (!AAFwk::PermissionVerification::GetInstance()->IsSACall()) {
@@ -5568,6 +5607,16 @@ void AbilityManagerService::DumpSysState(
         case DumpUtils::KEY_DUMP_SYS_ABILITY:
             DumpSysAbilityInner(args, info, isClient, isUserID, userId);
             break;
+        case DumpUtils::KEY_DUMP_SYS_IPC:
+            DumpRequestStats(info);
+            info.push_back("Token lookup slow path count: " + std::to_string(Token::GetSlowPathCount()));
+            break;
+        case DumpUtils::KEY_DUMP_SYS_INTERCEPTOR:
+            DumpInterceptorStats(info);
+            break;
+        case DumpUtils::KEY_DUMP_SYS_TIMEOUT:
+            DumpPendingTimeouts(info);
+            break;
         default:
             info.push_back("error: invalid argument, please see 'ability dump -h'.");
             break;
@@ -8719,7 +8768,13 @@ void AbilityManagerService::ShowHelp(std::string& result)
         .append("-r                          ")
         .append("dump all process in the system\n")
         .append("-d                          ")
-        .append("dump all data ability infomation in the system");
+        .append("dump all data ability infomation in the system\n")
+        .append("-I                          ")
+        .append("dump the ipc request count and cost of ability manager service\n")
+        .append("-T                          ")
+        .append("dump the process count and cost of the start ability interceptors\n")
+        .append("-O                          ")
+        .append("dump the pending timeout count of ability manager service per category");
 }
 
 void AbilityManagerService::ShowIllegalInfomation(std::string& result)
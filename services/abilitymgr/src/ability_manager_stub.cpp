@@ -20,6 +20,9 @@
 #include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
 #include "status_bar_delegate_interface.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <iterator>
 
 namespace OHOS {
@@ -29,843 +32,366 @@ namespace {
 const std::u16string extensionDescriptor = u"ohos.aafwk.ExtensionManager";
 constexpr int32_t CYCLE_LIMIT = 1000;
 constexpr int32_t MAX_KILL_PROCESS_PID_COUNT = 100;
+constexpr uint64_t REQUEST_COST_BUCKET_BOUNDS_US[] = { 100, 1000, 10000, 100000 };
 } // namespace
 AbilityManagerStub::AbilityManagerStub()
+    : requestStats_(std::make_unique<RequestStat[]>(GetRequestFuncTable().entries.size()))
 {}
 
 AbilityManagerStub::~AbilityManagerStub()
 {}
 
-int AbilityManagerStub::OnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::TERMINATE_ABILITY) {
-        return TerminateAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MINIMIZE_ABILITY) {
-        return MinimizeAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ATTACH_ABILITY_THREAD) {
-        return AttachAbilityThreadInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ABILITY_TRANSITION_DONE) {
-        return AbilityTransitionDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ABILITY_WINDOW_CONFIG_TRANSITION_DONE) {
-        return AbilityWindowConfigTransitionDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONNECT_ABILITY_DONE) {
-        return ScheduleConnectAbilityDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DISCONNECT_ABILITY_DONE) {
-        return ScheduleDisconnectAbilityDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::COMMAND_ABILITY_DONE) {
-        return ScheduleCommandAbilityDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::COMMAND_ABILITY_WINDOW_DONE) {
-        return ScheduleCommandAbilityWindowDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ACQUIRE_DATA_ABILITY) {
-        return AcquireDataAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::RELEASE_DATA_ABILITY) {
-        return ReleaseDataAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::BACK_TO_CALLER_UIABILITY) {
-        return BackToCallerInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::KILL_PROCESS) {
-        return KillProcessInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNINSTALL_APP) {
-        return UninstallAppInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UPGRADE_APP) {
-        return UpgradeAppInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY) {
-        return StartAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_ADD_CALLER) {
-        return StartAbilityAddCallerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_WITH_SPECIFY_TOKENID) {
-        return StartAbilityInnerSpecifyTokenId(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_AS_CALLER_BY_TOKEN) {
-        return StartAbilityAsCallerByTokenInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_AS_CALLER_FOR_OPTIONS) {
-        return StartAbilityAsCallerForOptionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_SESSION_ABILITY_ADD_CALLER) {
-        return StartAbilityByUIContentSessionAddCallerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_SESSION_ABILITY_FOR_OPTIONS) {
-        return StartAbilityByUIContentSessionForOptionsInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerThird(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_BY_INSIGHT_INTENT) {
-        return StartAbilityByInsightIntentInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONNECT_ABILITY) {
-        return ConnectAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DISCONNECT_ABILITY) {
-        return DisconnectAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::STOP_SERVICE_ABILITY) {
-        return StopServiceAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DUMP_STATE) {
-        return DumpStateInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DUMPSYS_STATE) {
-        return DumpSysStateInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_FOR_SETTINGS) {
-        return StartAbilityForSettingsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONTINUE_MISSION) {
-        return ContinueMissionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONTINUE_MISSION_OF_BUNDLENAME) {
-        return ContinueMissionOfBundleNameInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONTINUE_ABILITY) {
-        return ContinueAbilityInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerFourth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::START_CONTINUATION) {
-        return StartContinuationInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::NOTIFY_COMPLETE_CONTINUATION) {
-        return NotifyCompleteContinuationInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::NOTIFY_CONTINUATION_RESULT) {
-        return NotifyContinuationResultInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SEND_RESULT_TO_ABILITY) {
-        return SendResultToAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_REMOTE_MISSION_LISTENER) {
-        return RegisterRemoteMissionListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_REMOTE_ON_LISTENER) {
-        return RegisterRemoteOnListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_REMOTE_OFF_LISTENER) {
-        return RegisterRemoteOffListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_REMOTE_MISSION_LISTENER) {
-        return UnRegisterRemoteMissionListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_FOR_OPTIONS) {
-        return StartAbilityForOptionsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_SYNC_MISSIONS) {
-        return StartSyncRemoteMissionsInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerFifth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::STOP_SYNC_MISSIONS) {
-        return StopSyncRemoteMissionsInner(data, reply);
-    }
+const AbilityManagerStub::RequestFuncTable &AbilityManagerStub::GetRequestFuncTable()
+{
+    // every ipc code handled by this stub, resolved through the dense index of RequestFuncTable.
+    static constexpr RequestFuncEntry requestFuncEntries[] = {
+        { AbilityManagerInterfaceCode::TERMINATE_ABILITY, &AbilityManagerStub::TerminateAbilityInner },
+        { AbilityManagerInterfaceCode::MINIMIZE_ABILITY, &AbilityManagerStub::MinimizeAbilityInner },
+        { AbilityManagerInterfaceCode::ATTACH_ABILITY_THREAD, &AbilityManagerStub::AttachAbilityThreadInner },
+        { AbilityManagerInterfaceCode::ABILITY_TRANSITION_DONE, &AbilityManagerStub::AbilityTransitionDoneInner },
+        { AbilityManagerInterfaceCode::ABILITY_WINDOW_CONFIG_TRANSITION_DONE,
+            &AbilityManagerStub::AbilityWindowConfigTransitionDoneInner },
+        { AbilityManagerInterfaceCode::CONNECT_ABILITY_DONE, &AbilityManagerStub::ScheduleConnectAbilityDoneInner },
+        { AbilityManagerInterfaceCode::DISCONNECT_ABILITY_DONE,
+            &AbilityManagerStub::ScheduleDisconnectAbilityDoneInner },
+        { AbilityManagerInterfaceCode::COMMAND_ABILITY_DONE, &AbilityManagerStub::ScheduleCommandAbilityDoneInner },
+        { AbilityManagerInterfaceCode::COMMAND_ABILITY_WINDOW_DONE,
+            &AbilityManagerStub::ScheduleCommandAbilityWindowDoneInner },
+        { AbilityManagerInterfaceCode::ACQUIRE_DATA_ABILITY, &AbilityManagerStub::AcquireDataAbilityInner },
+        { AbilityManagerInterfaceCode::RELEASE_DATA_ABILITY, &AbilityManagerStub::ReleaseDataAbilityInner },
+        { AbilityManagerInterfaceCode::BACK_TO_CALLER_UIABILITY, &AbilityManagerStub::BackToCallerInner },
+        { AbilityManagerInterfaceCode::KILL_PROCESS, &AbilityManagerStub::KillProcessInner },
+        { AbilityManagerInterfaceCode::UNINSTALL_APP, &AbilityManagerStub::UninstallAppInner },
+        { AbilityManagerInterfaceCode::UPGRADE_APP, &AbilityManagerStub::UpgradeAppInner },
+        { AbilityManagerInterfaceCode::START_ABILITY, &AbilityManagerStub::StartAbilityInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_ADD_CALLER, &AbilityManagerStub::StartAbilityAddCallerInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_WITH_SPECIFY_TOKENID,
+            &AbilityManagerStub::StartAbilityInnerSpecifyTokenId },
+        { AbilityManagerInterfaceCode::START_ABILITY_AS_CALLER_BY_TOKEN,
+            &AbilityManagerStub::StartAbilityAsCallerByTokenInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_AS_CALLER_FOR_OPTIONS,
+            &AbilityManagerStub::StartAbilityAsCallerForOptionInner },
+        { AbilityManagerInterfaceCode::START_UI_SESSION_ABILITY_ADD_CALLER,
+            &AbilityManagerStub::StartAbilityByUIContentSessionAddCallerInner },
+        { AbilityManagerInterfaceCode::START_UI_SESSION_ABILITY_FOR_OPTIONS,
+            &AbilityManagerStub::StartAbilityByUIContentSessionForOptionsInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_BY_INSIGHT_INTENT,
+            &AbilityManagerStub::StartAbilityByInsightIntentInner },
+        { AbilityManagerInterfaceCode::CONNECT_ABILITY, &AbilityManagerStub::ConnectAbilityInner },
+        { AbilityManagerInterfaceCode::DISCONNECT_ABILITY, &AbilityManagerStub::DisconnectAbilityInner },
+        { AbilityManagerInterfaceCode::STOP_SERVICE_ABILITY, &AbilityManagerStub::StopServiceAbilityInner },
+        { AbilityManagerInterfaceCode::DUMP_STATE, &AbilityManagerStub::DumpStateInner },
+        { AbilityManagerInterfaceCode::DUMPSYS_STATE, &AbilityManagerStub::DumpSysStateInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_FOR_SETTINGS, &AbilityManagerStub::StartAbilityForSettingsInner },
+        { AbilityManagerInterfaceCode::CONTINUE_MISSION, &AbilityManagerStub::ContinueMissionInner },
+        { AbilityManagerInterfaceCode::CONTINUE_MISSION_OF_BUNDLENAME,
+            &AbilityManagerStub::ContinueMissionOfBundleNameInner },
+        { AbilityManagerInterfaceCode::CONTINUE_ABILITY, &AbilityManagerStub::ContinueAbilityInner },
+        { AbilityManagerInterfaceCode::START_CONTINUATION, &AbilityManagerStub::StartContinuationInner },
+        { AbilityManagerInterfaceCode::NOTIFY_COMPLETE_CONTINUATION,
+            &AbilityManagerStub::NotifyCompleteContinuationInner },
+        { AbilityManagerInterfaceCode::NOTIFY_CONTINUATION_RESULT, &AbilityManagerStub::NotifyContinuationResultInner },
+        { AbilityManagerInterfaceCode::SEND_RESULT_TO_ABILITY, &AbilityManagerStub::SendResultToAbilityInner },
+        { AbilityManagerInterfaceCode::REGISTER_REMOTE_MISSION_LISTENER,
+            &AbilityManagerStub::RegisterRemoteMissionListenerInner },
+        { AbilityManagerInterfaceCode::REGISTER_REMOTE_ON_LISTENER,
+            &AbilityManagerStub::RegisterRemoteOnListenerInner },
+        { AbilityManagerInterfaceCode::REGISTER_REMOTE_OFF_LISTENER,
+            &AbilityManagerStub::RegisterRemoteOffListenerInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_REMOTE_MISSION_LISTENER,
+            &AbilityManagerStub::UnRegisterRemoteMissionListenerInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_FOR_OPTIONS, &AbilityManagerStub::StartAbilityForOptionsInner },
+        { AbilityManagerInterfaceCode::START_SYNC_MISSIONS, &AbilityManagerStub::StartSyncRemoteMissionsInner },
+        { AbilityManagerInterfaceCode::STOP_SYNC_MISSIONS, &AbilityManagerStub::StopSyncRemoteMissionsInner },
 #ifdef ABILITY_COMMAND_FOR_TEST
-    if (interfaceCode == AbilityManagerInterfaceCode::FORCE_TIMEOUT) {
-        return ForceTimeoutForTestInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::FORCE_TIMEOUT, &AbilityManagerStub::ForceTimeoutForTestInner },
 #endif
-    if (interfaceCode == AbilityManagerInterfaceCode::FREE_INSTALL_ABILITY_FROM_REMOTE) {
-        return FreeInstallAbilityFromRemoteInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ADD_FREE_INSTALL_OBSERVER) {
-        return AddFreeInstallObserverInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONNECT_ABILITY_WITH_TYPE) {
-        return ConnectAbilityWithTypeInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ABILITY_RECOVERY) {
-        return ScheduleRecoverAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ABILITY_RECOVERY_ENABLE) {
-        return EnableRecoverAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ABILITY_RECOVERY_SUBMITINFO) {
-        return SubmitSaveRecoveryInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CLEAR_RECOVERY_PAGE_STACK) {
-        return ScheduleClearRecoveryPageStackInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MINIMIZE_UI_ABILITY_BY_SCB) {
-        return MinimizeUIAbilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CLOSE_UI_ABILITY_BY_SCB) {
-        return CloseUIAbilityBySCBInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerSixth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_COLLABORATOR) {
-        return RegisterIAbilityManagerCollaboratorInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_COLLABORATOR) {
-        return UnregisterIAbilityManagerCollaboratorInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_APP_DEBUG_LISTENER) {
-        return RegisterAppDebugListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_APP_DEBUG_LISTENER) {
-        return UnregisterAppDebugListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::ATTACH_APP_DEBUG) {
-        return AttachAppDebugInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DETACH_APP_DEBUG) {
-        return DetachAppDebugInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::IS_ABILITY_CONTROLLER_START) {
-        return IsAbilityControllerStartInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::EXECUTE_INTENT) {
-        return ExecuteIntentInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::EXECUTE_INSIGHT_INTENT_DONE) {
-        return ExecuteInsightIntentDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::OPEN_FILE) {
-        return OpenFileInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerSeventh(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_SENDER) {
-        return GetWantSenderInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SEND_PENDING_WANT_SENDER) {
-        return SendWantSenderInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CANCEL_PENDING_WANT_SENDER) {
-        return CancelWantSenderInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_UID) {
-        return GetPendingWantUidInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_USERID) {
-        return GetPendingWantUserIdInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_BUNDLENAME) {
-        return GetPendingWantBundleNameInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_CODE) {
-        return GetPendingWantCodeInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_TYPE) {
-        return GetPendingWantTypeInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_CANCEL_LISTENER) {
-        return RegisterCancelListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_CANCEL_LISTENER) {
-        return UnregisterCancelListenerInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerEighth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_REQUEST_WANT) {
-        return GetPendingRequestWantInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PENDING_WANT_SENDER_INFO) {
-        return GetWantSenderInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_APP_MEMORY_SIZE) {
-        return GetAppMemorySizeInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::IS_RAM_CONSTRAINED_DEVICE) {
-        return IsRamConstrainedDeviceInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::LOCK_MISSION_FOR_CLEANUP) {
-        return LockMissionForCleanupInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNLOCK_MISSION_FOR_CLEANUP) {
-        return UnlockMissionForCleanupInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_SESSION_LOCKED_STATE) {
-        return SetLockedStateInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_MISSION_LISTENER) {
-        return RegisterMissionListenerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_MISSION_LISTENER) {
-        return UnRegisterMissionListenerInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerNinth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_MISSION_INFOS) {
-        return GetMissionInfosInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_MISSION_INFO_BY_ID) {
-        return GetMissionInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CLEAN_MISSION) {
-        return CleanMissionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CLEAN_ALL_MISSIONS) {
-        return CleanAllMissionsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_MISSION_TO_FRONT) {
-        return MoveMissionToFrontInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_MISSION_TO_FRONT_BY_OPTIONS) {
-        return MoveMissionToFrontByOptionsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_MISSIONS_TO_FOREGROUND) {
-        return MoveMissionsToForegroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_MISSIONS_TO_BACKGROUND) {
-        return MoveMissionsToBackgroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_CALL_ABILITY) {
-        return StartAbilityByCallInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CALL_REQUEST_DONE) {
-        return CallRequestDoneInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerTenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::RELEASE_CALL_ABILITY) {
-        return ReleaseCallInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_USER) {
-        return StartUserInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::STOP_USER) {
-        return StopUserInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::LOGOUT_USER) {
-        return LogoutUserInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_ABILITY_RUNNING_INFO) {
-        return GetAbilityRunningInfosInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_EXTENSION_RUNNING_INFO) {
-        return GetExtensionRunningInfosInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_PROCESS_RUNNING_INFO) {
-        return GetProcessRunningInfosInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_ABILITY_CONTROLLER) {
-        return SetAbilityControllerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_MISSION_SNAPSHOT_INFO) {
-        return GetMissionSnapshotInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::IS_USER_A_STABILITY_TEST) {
-        return IsRunningInStabilityTestInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerEleventh(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::ACQUIRE_SHARE_DATA) {
-        return AcquireShareDataInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SHARE_DATA_DONE) {
-        return ShareDataDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_ABILITY_TOKEN) {
-        return GetAbilityTokenByCalleeObjInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::FORCE_EXIT_APP) {
-        return ForceExitAppInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::RECORD_APP_EXIT_REASON) {
-        return RecordAppExitReasonInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::RECORD_PROCESS_EXIT_REASON) {
-        return RecordProcessExitReasonInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_SESSION_HANDLER) {
-        return RegisterSessionHandlerInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::FREE_INSTALL_ABILITY_FROM_REMOTE,
+            &AbilityManagerStub::FreeInstallAbilityFromRemoteInner },
+        { AbilityManagerInterfaceCode::ADD_FREE_INSTALL_OBSERVER, &AbilityManagerStub::AddFreeInstallObserverInner },
+        { AbilityManagerInterfaceCode::CONNECT_ABILITY_WITH_TYPE, &AbilityManagerStub::ConnectAbilityWithTypeInner },
+        { AbilityManagerInterfaceCode::ABILITY_RECOVERY, &AbilityManagerStub::ScheduleRecoverAbilityInner },
+        { AbilityManagerInterfaceCode::ABILITY_RECOVERY_ENABLE, &AbilityManagerStub::EnableRecoverAbilityInner },
+        { AbilityManagerInterfaceCode::ABILITY_RECOVERY_SUBMITINFO, &AbilityManagerStub::SubmitSaveRecoveryInfoInner },
+        { AbilityManagerInterfaceCode::CLEAR_RECOVERY_PAGE_STACK,
+            &AbilityManagerStub::ScheduleClearRecoveryPageStackInner },
+        { AbilityManagerInterfaceCode::MINIMIZE_UI_ABILITY_BY_SCB, &AbilityManagerStub::MinimizeUIAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::CLOSE_UI_ABILITY_BY_SCB, &AbilityManagerStub::CloseUIAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::REGISTER_COLLABORATOR,
+            &AbilityManagerStub::RegisterIAbilityManagerCollaboratorInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_COLLABORATOR,
+            &AbilityManagerStub::UnregisterIAbilityManagerCollaboratorInner },
+        { AbilityManagerInterfaceCode::REGISTER_APP_DEBUG_LISTENER,
+            &AbilityManagerStub::RegisterAppDebugListenerInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_APP_DEBUG_LISTENER,
+            &AbilityManagerStub::UnregisterAppDebugListenerInner },
+        { AbilityManagerInterfaceCode::ATTACH_APP_DEBUG, &AbilityManagerStub::AttachAppDebugInner },
+        { AbilityManagerInterfaceCode::DETACH_APP_DEBUG, &AbilityManagerStub::DetachAppDebugInner },
+        { AbilityManagerInterfaceCode::IS_ABILITY_CONTROLLER_START,
+            &AbilityManagerStub::IsAbilityControllerStartInner },
+        { AbilityManagerInterfaceCode::EXECUTE_INTENT, &AbilityManagerStub::ExecuteIntentInner },
+        { AbilityManagerInterfaceCode::EXECUTE_INSIGHT_INTENT_DONE,
+            &AbilityManagerStub::ExecuteInsightIntentDoneInner },
+        { AbilityManagerInterfaceCode::OPEN_FILE, &AbilityManagerStub::OpenFileInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_SENDER, &AbilityManagerStub::GetWantSenderInner },
+        { AbilityManagerInterfaceCode::SEND_PENDING_WANT_SENDER, &AbilityManagerStub::SendWantSenderInner },
+        { AbilityManagerInterfaceCode::CANCEL_PENDING_WANT_SENDER, &AbilityManagerStub::CancelWantSenderInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_UID, &AbilityManagerStub::GetPendingWantUidInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_USERID, &AbilityManagerStub::GetPendingWantUserIdInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_BUNDLENAME,
+            &AbilityManagerStub::GetPendingWantBundleNameInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_CODE, &AbilityManagerStub::GetPendingWantCodeInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_TYPE, &AbilityManagerStub::GetPendingWantTypeInner },
+        { AbilityManagerInterfaceCode::REGISTER_CANCEL_LISTENER, &AbilityManagerStub::RegisterCancelListenerInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_CANCEL_LISTENER, &AbilityManagerStub::UnregisterCancelListenerInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_REQUEST_WANT, &AbilityManagerStub::GetPendingRequestWantInner },
+        { AbilityManagerInterfaceCode::GET_PENDING_WANT_SENDER_INFO, &AbilityManagerStub::GetWantSenderInfoInner },
+        { AbilityManagerInterfaceCode::GET_APP_MEMORY_SIZE, &AbilityManagerStub::GetAppMemorySizeInner },
+        { AbilityManagerInterfaceCode::IS_RAM_CONSTRAINED_DEVICE, &AbilityManagerStub::IsRamConstrainedDeviceInner },
+        { AbilityManagerInterfaceCode::LOCK_MISSION_FOR_CLEANUP, &AbilityManagerStub::LockMissionForCleanupInner },
+        { AbilityManagerInterfaceCode::UNLOCK_MISSION_FOR_CLEANUP, &AbilityManagerStub::UnlockMissionForCleanupInner },
+        { AbilityManagerInterfaceCode::SET_SESSION_LOCKED_STATE, &AbilityManagerStub::SetLockedStateInner },
+        { AbilityManagerInterfaceCode::REGISTER_MISSION_LISTENER, &AbilityManagerStub::RegisterMissionListenerInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_MISSION_LISTENER,
+            &AbilityManagerStub::UnRegisterMissionListenerInner },
+        { AbilityManagerInterfaceCode::GET_MISSION_INFOS, &AbilityManagerStub::GetMissionInfosInner },
+        { AbilityManagerInterfaceCode::GET_MISSION_INFO_BY_ID, &AbilityManagerStub::GetMissionInfoInner },
+        { AbilityManagerInterfaceCode::CLEAN_MISSION, &AbilityManagerStub::CleanMissionInner },
+        { AbilityManagerInterfaceCode::CLEAN_ALL_MISSIONS, &AbilityManagerStub::CleanAllMissionsInner },
+        { AbilityManagerInterfaceCode::MOVE_MISSION_TO_FRONT, &AbilityManagerStub::MoveMissionToFrontInner },
+        { AbilityManagerInterfaceCode::MOVE_MISSION_TO_FRONT_BY_OPTIONS,
+            &AbilityManagerStub::MoveMissionToFrontByOptionsInner },
+        { AbilityManagerInterfaceCode::MOVE_MISSIONS_TO_FOREGROUND,
+            &AbilityManagerStub::MoveMissionsToForegroundInner },
+        { AbilityManagerInterfaceCode::MOVE_MISSIONS_TO_BACKGROUND,
+            &AbilityManagerStub::MoveMissionsToBackgroundInner },
+        { AbilityManagerInterfaceCode::START_CALL_ABILITY, &AbilityManagerStub::StartAbilityByCallInner },
+        { AbilityManagerInterfaceCode::CALL_REQUEST_DONE, &AbilityManagerStub::CallRequestDoneInner },
+        { AbilityManagerInterfaceCode::RELEASE_CALL_ABILITY, &AbilityManagerStub::ReleaseCallInner },
+        { AbilityManagerInterfaceCode::START_USER, &AbilityManagerStub::StartUserInner },
+        { AbilityManagerInterfaceCode::STOP_USER, &AbilityManagerStub::StopUserInner },
+        { AbilityManagerInterfaceCode::LOGOUT_USER, &AbilityManagerStub::LogoutUserInner },
+        { AbilityManagerInterfaceCode::GET_ABILITY_RUNNING_INFO, &AbilityManagerStub::GetAbilityRunningInfosInner },
+        { AbilityManagerInterfaceCode::GET_EXTENSION_RUNNING_INFO, &AbilityManagerStub::GetExtensionRunningInfosInner },
+        { AbilityManagerInterfaceCode::GET_PROCESS_RUNNING_INFO, &AbilityManagerStub::GetProcessRunningInfosInner },
+        { AbilityManagerInterfaceCode::SET_ABILITY_CONTROLLER, &AbilityManagerStub::SetAbilityControllerInner },
+        { AbilityManagerInterfaceCode::GET_MISSION_SNAPSHOT_INFO, &AbilityManagerStub::GetMissionSnapshotInfoInner },
+        { AbilityManagerInterfaceCode::IS_USER_A_STABILITY_TEST, &AbilityManagerStub::IsRunningInStabilityTestInner },
+        { AbilityManagerInterfaceCode::ACQUIRE_SHARE_DATA, &AbilityManagerStub::AcquireShareDataInner },
+        { AbilityManagerInterfaceCode::SHARE_DATA_DONE, &AbilityManagerStub::ShareDataDoneInner },
+        { AbilityManagerInterfaceCode::GET_ABILITY_TOKEN, &AbilityManagerStub::GetAbilityTokenByCalleeObjInner },
+        { AbilityManagerInterfaceCode::FORCE_EXIT_APP, &AbilityManagerStub::ForceExitAppInner },
+        { AbilityManagerInterfaceCode::RECORD_APP_EXIT_REASON, &AbilityManagerStub::RecordAppExitReasonInner },
+        { AbilityManagerInterfaceCode::RECORD_PROCESS_EXIT_REASON, &AbilityManagerStub::RecordProcessExitReasonInner },
+        { AbilityManagerInterfaceCode::REGISTER_SESSION_HANDLER, &AbilityManagerStub::RegisterSessionHandlerInner },
 #ifdef ABILITY_COMMAND_FOR_TEST
-    if (interfaceCode == AbilityManagerInterfaceCode::BLOCK_ABILITY) {
-        return BlockAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::BLOCK_AMS_SERVICE) {
-        return BlockAmsServiceInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::BLOCK_APP_SERVICE) {
-        return BlockAppServiceInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::BLOCK_ABILITY, &AbilityManagerStub::BlockAbilityInner },
+        { AbilityManagerInterfaceCode::BLOCK_AMS_SERVICE, &AbilityManagerStub::BlockAmsServiceInner },
+        { AbilityManagerInterfaceCode::BLOCK_APP_SERVICE, &AbilityManagerStub::BlockAppServiceInner },
 #endif
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerTwelveth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::START_USER_TEST) {
-        return StartUserTestInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::FINISH_USER_TEST) {
-        return FinishUserTestInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_TOP_ABILITY_TOKEN) {
-        return GetTopAbilityTokenInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CHECK_UI_EXTENSION_IS_FOCUSED) {
-        return CheckUIExtensionIsFocusedInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DELEGATOR_DO_ABILITY_FOREGROUND) {
-        return DelegatorDoAbilityForegroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DELEGATOR_DO_ABILITY_BACKGROUND) {
-        return DelegatorDoAbilityBackgroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DO_ABILITY_FOREGROUND) {
-        return DoAbilityForegroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DO_ABILITY_BACKGROUND) {
-        return DoAbilityBackgroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_MISSION_ID_BY_ABILITY_TOKEN) {
-        return GetMissionIdByTokenInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_TOP_ABILITY) {
-        return GetTopAbilityInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerThirteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_ELEMENT_NAME_BY_TOKEN) {
-        return GetElementNameByTokenInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::DUMP_ABILITY_INFO_DONE) {
-        return DumpAbilityInfoDoneInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_EXTENSION_ABILITY) {
-        return StartExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::STOP_EXTENSION_ABILITY) {
-        return StopExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UPDATE_MISSION_SNAPSHOT_FROM_WMS) {
-        return UpdateMissionSnapShotFromWMSInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_CONNECTION_OBSERVER) {
-        return RegisterConnectionObserverInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_CONNECTION_OBSERVER) {
-        return UnregisterConnectionObserverInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::START_USER_TEST, &AbilityManagerStub::StartUserTestInner },
+        { AbilityManagerInterfaceCode::FINISH_USER_TEST, &AbilityManagerStub::FinishUserTestInner },
+        { AbilityManagerInterfaceCode::GET_TOP_ABILITY_TOKEN, &AbilityManagerStub::GetTopAbilityTokenInner },
+        { AbilityManagerInterfaceCode::CHECK_UI_EXTENSION_IS_FOCUSED,
+            &AbilityManagerStub::CheckUIExtensionIsFocusedInner },
+        { AbilityManagerInterfaceCode::DELEGATOR_DO_ABILITY_FOREGROUND,
+            &AbilityManagerStub::DelegatorDoAbilityForegroundInner },
+        { AbilityManagerInterfaceCode::DELEGATOR_DO_ABILITY_BACKGROUND,
+            &AbilityManagerStub::DelegatorDoAbilityBackgroundInner },
+        { AbilityManagerInterfaceCode::DO_ABILITY_FOREGROUND, &AbilityManagerStub::DoAbilityForegroundInner },
+        { AbilityManagerInterfaceCode::DO_ABILITY_BACKGROUND, &AbilityManagerStub::DoAbilityBackgroundInner },
+        { AbilityManagerInterfaceCode::GET_MISSION_ID_BY_ABILITY_TOKEN, &AbilityManagerStub::GetMissionIdByTokenInner },
+        { AbilityManagerInterfaceCode::GET_TOP_ABILITY, &AbilityManagerStub::GetTopAbilityInner },
+        { AbilityManagerInterfaceCode::GET_ELEMENT_NAME_BY_TOKEN, &AbilityManagerStub::GetElementNameByTokenInner },
+        { AbilityManagerInterfaceCode::DUMP_ABILITY_INFO_DONE, &AbilityManagerStub::DumpAbilityInfoDoneInner },
+        { AbilityManagerInterfaceCode::START_EXTENSION_ABILITY, &AbilityManagerStub::StartExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::STOP_EXTENSION_ABILITY, &AbilityManagerStub::StopExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::UPDATE_MISSION_SNAPSHOT_FROM_WMS,
+            &AbilityManagerStub::UpdateMissionSnapShotFromWMSInner },
+        { AbilityManagerInterfaceCode::REGISTER_CONNECTION_OBSERVER,
+            &AbilityManagerStub::RegisterConnectionObserverInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_CONNECTION_OBSERVER,
+            &AbilityManagerStub::UnregisterConnectionObserverInner },
 #ifdef WITH_DLP
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_DLP_CONNECTION_INFOS) {
-        return GetDlpConnectionInfosInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::GET_DLP_CONNECTION_INFOS, &AbilityManagerStub::GetDlpConnectionInfosInner },
 #endif // WITH_DLP
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_ABILITY_TO_BACKGROUND) {
-        return MoveAbilityToBackgroundInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MOVE_UI_ABILITY_TO_BACKGROUND) {
-        return MoveUIAbilityToBackgroundInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerFourteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_MISSION_CONTINUE_STATE) {
-        return SetMissionContinueStateInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::PREPARE_TERMINATE_ABILITY_BY_SCB) {
-        return PrepareTerminateAbilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REQUESET_MODAL_UIEXTENSION) {
-        return RequestModalUIExtensionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_UI_EXTENSION_ROOT_HOST_INFO) {
-        return GetUIExtensionRootHostInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_UI_EXTENSION_SESSION_INFO) {
-        return GetUIExtensionSessionInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::PRELOAD_UIEXTENSION_ABILITY) {
-        return PreloadUIExtensionAbilityInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerFifteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-#ifdef SUPPORT_GRAPHICS
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_MISSION_LABEL) {
-        return SetMissionLabelInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_MISSION_ICON) {
-        return SetMissionIconInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_WMS_HANDLER) {
-        return RegisterWindowManagerServiceHandlerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::COMPLETEFIRSTFRAMEDRAWING) {
-        return CompleteFirstFrameDrawingInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_EXTENSION_ABILITY) {
-        return StartUIExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::MINIMIZE_UI_EXTENSION_ABILITY) {
-        return MinimizeUIExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::TERMINATE_UI_EXTENSION_ABILITY) {
-        return TerminateUIExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CONNECT_UI_EXTENSION_ABILITY) {
-        return ConnectUIExtensionAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::PREPARE_TERMINATE_ABILITY) {
-        return PrepareTerminateAbilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_DIALOG_SESSION_INFO) {
-        return GetDialogSessionInfoInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SEND_DIALOG_RESULT) {
-        return SendDialogResultInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_ABILITY_FIRST_FRAME_STATE_OBSERVER) {
-        return RegisterAbilityFirstFrameStateObserverInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_ABILITY_FIRST_FRAME_STATE_OBSERVER) {
-        return UnregisterAbilityFirstFrameStateObserverInner(data, reply);
-    }
-#endif
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerSixteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
+        { AbilityManagerInterfaceCode::MOVE_ABILITY_TO_BACKGROUND, &AbilityManagerStub::MoveAbilityToBackgroundInner },
+        { AbilityManagerInterfaceCode::MOVE_UI_ABILITY_TO_BACKGROUND,
+            &AbilityManagerStub::MoveUIAbilityToBackgroundInner },
+        { AbilityManagerInterfaceCode::SET_MISSION_CONTINUE_STATE, &AbilityManagerStub::SetMissionContinueStateInner },
+        { AbilityManagerInterfaceCode::PREPARE_TERMINATE_ABILITY_BY_SCB,
+            &AbilityManagerStub::PrepareTerminateAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::REQUESET_MODAL_UIEXTENSION, &AbilityManagerStub::RequestModalUIExtensionInner },
+        { AbilityManagerInterfaceCode::GET_UI_EXTENSION_ROOT_HOST_INFO,
+            &AbilityManagerStub::GetUIExtensionRootHostInfoInner },
+        { AbilityManagerInterfaceCode::GET_UI_EXTENSION_SESSION_INFO,
+            &AbilityManagerStub::GetUIExtensionSessionInfoInner },
+        { AbilityManagerInterfaceCode::PRELOAD_UIEXTENSION_ABILITY,
+            &AbilityManagerStub::PreloadUIExtensionAbilityInner },
 #ifdef SUPPORT_GRAPHICS
-    if (interfaceCode == AbilityManagerInterfaceCode::COMPLETE_FIRST_FRAME_DRAWING_BY_SCB) {
-        return CompleteFirstFrameDrawingBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_EXTENSION_ABILITY_EMBEDDED) {
-        return StartUIExtensionAbilityEmbeddedInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_EXTENSION_CONSTRAINED_EMBEDDED) {
-        return StartUIExtensionConstrainedEmbeddedInner(data, reply);
-    }
+        { AbilityManagerInterfaceCode::SET_MISSION_LABEL, &AbilityManagerStub::SetMissionLabelInner },
+        { AbilityManagerInterfaceCode::SET_MISSION_ICON, &AbilityManagerStub::SetMissionIconInner },
+        { AbilityManagerInterfaceCode::REGISTER_WMS_HANDLER,
+            &AbilityManagerStub::RegisterWindowManagerServiceHandlerInner },
+        { AbilityManagerInterfaceCode::COMPLETEFIRSTFRAMEDRAWING, &AbilityManagerStub::CompleteFirstFrameDrawingInner },
+        { AbilityManagerInterfaceCode::START_UI_EXTENSION_ABILITY, &AbilityManagerStub::StartUIExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::MINIMIZE_UI_EXTENSION_ABILITY,
+            &AbilityManagerStub::MinimizeUIExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::TERMINATE_UI_EXTENSION_ABILITY,
+            &AbilityManagerStub::TerminateUIExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::CONNECT_UI_EXTENSION_ABILITY,
+            &AbilityManagerStub::ConnectUIExtensionAbilityInner },
+        { AbilityManagerInterfaceCode::PREPARE_TERMINATE_ABILITY, &AbilityManagerStub::PrepareTerminateAbilityInner },
+        { AbilityManagerInterfaceCode::GET_DIALOG_SESSION_INFO, &AbilityManagerStub::GetDialogSessionInfoInner },
+        { AbilityManagerInterfaceCode::SEND_DIALOG_RESULT, &AbilityManagerStub::SendDialogResultInner },
+        { AbilityManagerInterfaceCode::REGISTER_ABILITY_FIRST_FRAME_STATE_OBSERVER,
+            &AbilityManagerStub::RegisterAbilityFirstFrameStateObserverInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_ABILITY_FIRST_FRAME_STATE_OBSERVER,
+            &AbilityManagerStub::UnregisterAbilityFirstFrameStateObserverInner },
+        { AbilityManagerInterfaceCode::COMPLETE_FIRST_FRAME_DRAWING_BY_SCB,
+            &AbilityManagerStub::CompleteFirstFrameDrawingBySCBInner },
+        { AbilityManagerInterfaceCode::START_UI_EXTENSION_ABILITY_EMBEDDED,
+            &AbilityManagerStub::StartUIExtensionAbilityEmbeddedInner },
+        { AbilityManagerInterfaceCode::START_UI_EXTENSION_CONSTRAINED_EMBEDDED,
+            &AbilityManagerStub::StartUIExtensionConstrainedEmbeddedInner },
 #endif
-    if (interfaceCode == AbilityManagerInterfaceCode::REQUEST_DIALOG_SERVICE) {
-        return HandleRequestDialogService(data, reply);
-    };
-    if (interfaceCode == AbilityManagerInterfaceCode::REPORT_DRAWN_COMPLETED) {
-        return HandleReportDrawnCompleted(data, reply);
+        { AbilityManagerInterfaceCode::REQUEST_DIALOG_SERVICE, &AbilityManagerStub::HandleRequestDialogService },
+        { AbilityManagerInterfaceCode::REPORT_DRAWN_COMPLETED, &AbilityManagerStub::HandleReportDrawnCompleted },
+        { AbilityManagerInterfaceCode::QUERY_MISSION_VAILD, &AbilityManagerStub::IsValidMissionIdsInner },
+        { AbilityManagerInterfaceCode::VERIFY_PERMISSION, &AbilityManagerStub::VerifyPermissionInner },
+        { AbilityManagerInterfaceCode::START_UI_ABILITY_BY_SCB, &AbilityManagerStub::StartUIAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::SET_ROOT_SCENE_SESSION, &AbilityManagerStub::SetRootSceneSessionInner },
+        { AbilityManagerInterfaceCode::CALL_ABILITY_BY_SCB, &AbilityManagerStub::CallUIAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::START_SPECIFIED_ABILITY_BY_SCB,
+            &AbilityManagerStub::StartSpecifiedAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::NOTIFY_SAVE_AS_RESULT, &AbilityManagerStub::NotifySaveAsResultInner },
+        { AbilityManagerInterfaceCode::SET_SESSIONMANAGERSERVICE, &AbilityManagerStub::SetSessionManagerServiceInner },
+        { AbilityManagerInterfaceCode::UPDATE_SESSION_INFO, &AbilityManagerStub::UpdateSessionInfoBySCBInner },
+        { AbilityManagerInterfaceCode::REGISTER_STATUS_BAR_DELEGATE,
+            &AbilityManagerStub::RegisterStatusBarDelegateInner },
+        { AbilityManagerInterfaceCode::KILL_PROCESS_WITH_PREPARE_TERMINATE,
+            &AbilityManagerStub::KillProcessWithPrepareTerminateInner },
+        { AbilityManagerInterfaceCode::REGISTER_AUTO_STARTUP_SYSTEM_CALLBACK,
+            &AbilityManagerStub::RegisterAutoStartupSystemCallbackInner },
+        { AbilityManagerInterfaceCode::UNREGISTER_AUTO_STARTUP_SYSTEM_CALLBACK,
+            &AbilityManagerStub::UnregisterAutoStartupSystemCallbackInner },
+        { AbilityManagerInterfaceCode::SET_APPLICATION_AUTO_STARTUP,
+            &AbilityManagerStub::SetApplicationAutoStartupInner },
+        { AbilityManagerInterfaceCode::CANCEL_APPLICATION_AUTO_STARTUP,
+            &AbilityManagerStub::CancelApplicationAutoStartupInner },
+        { AbilityManagerInterfaceCode::QUERY_ALL_AUTO_STARTUP_APPLICATION,
+            &AbilityManagerStub::QueryAllAutoStartupApplicationsInner },
+        { AbilityManagerInterfaceCode::GET_CONNECTION_DATA, &AbilityManagerStub::GetConnectionDataInner },
+        { AbilityManagerInterfaceCode::SET_APPLICATION_AUTO_STARTUP_BY_EDM,
+            &AbilityManagerStub::SetApplicationAutoStartupByEDMInner },
+        { AbilityManagerInterfaceCode::CANCEL_APPLICATION_AUTO_STARTUP_BY_EDM,
+            &AbilityManagerStub::CancelApplicationAutoStartupByEDMInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_FOR_RESULT_AS_CALLER,
+            &AbilityManagerStub::StartAbilityForResultAsCallerInner },
+        { AbilityManagerInterfaceCode::START_ABILITY_FOR_RESULT_AS_CALLER_FOR_OPTIONS,
+            &AbilityManagerStub::StartAbilityForResultAsCallerForOptionsInner },
+        { AbilityManagerInterfaceCode::GET_FOREGROUND_UI_ABILITIES,
+            &AbilityManagerStub::GetForegroundUIAbilitiesInner },
+        { AbilityManagerInterfaceCode::RESTART_APP, &AbilityManagerStub::RestartAppInner },
+        { AbilityManagerInterfaceCode::OPEN_ATOMIC_SERVICE, &AbilityManagerStub::OpenAtomicServiceInner },
+        { AbilityManagerInterfaceCode::IS_EMBEDDED_OPEN_ALLOWED, &AbilityManagerStub::IsEmbeddedOpenAllowedInner },
+        { AbilityManagerInterfaceCode::REQUEST_ASSERT_FAULT_DIALOG,
+            &AbilityManagerStub::RequestAssertFaultDialogInner },
+        { AbilityManagerInterfaceCode::NOTIFY_DEBUG_ASSERT_RESULT, &AbilityManagerStub::NotifyDebugAssertResultInner },
+        { AbilityManagerInterfaceCode::CHANGE_ABILITY_VISIBILITY, &AbilityManagerStub::ChangeAbilityVisibilityInner },
+        { AbilityManagerInterfaceCode::CHANGE_UI_ABILITY_VISIBILITY_BY_SCB,
+            &AbilityManagerStub::ChangeUIAbilityVisibilityBySCBInner },
+        { AbilityManagerInterfaceCode::START_SHORTCUT, &AbilityManagerStub::StartShortcutInner },
+        { AbilityManagerInterfaceCode::SET_RESIDENT_PROCESS_ENABLE,
+            &AbilityManagerStub::SetResidentProcessEnableInner },
+        { AbilityManagerInterfaceCode::GET_ABILITY_STATE_BY_PERSISTENT_ID,
+            &AbilityManagerStub::GetAbilityStateByPersistentIdInner },
+        { AbilityManagerInterfaceCode::TRANSFER_ABILITY_RESULT,
+            &AbilityManagerStub::TransferAbilityResultForExtensionInner },
+        { AbilityManagerInterfaceCode::NOTIFY_FROZEN_PROCESS_BY_RSS,
+            &AbilityManagerStub::NotifyFrozenProcessByRSSInner },
+        { AbilityManagerInterfaceCode::PRE_START_MISSION, &AbilityManagerStub::PreStartMissionInner },
+        { AbilityManagerInterfaceCode::CLEAN_UI_ABILITY_BY_SCB, &AbilityManagerStub::CleanUIAbilityBySCBInner },
+        { AbilityManagerInterfaceCode::OPEN_LINK, &AbilityManagerStub::OpenLinkInner },
+        { AbilityManagerInterfaceCode::TERMINATE_MISSION, &AbilityManagerStub::TerminateMissionInner },
     };
-    if (interfaceCode == AbilityManagerInterfaceCode::QUERY_MISSION_VAILD) {
-        return IsValidMissionIdsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::VERIFY_PERMISSION) {
-        return VerifyPermissionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_UI_ABILITY_BY_SCB) {
-        return StartUIAbilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_ROOT_SCENE_SESSION) {
-        return SetRootSceneSessionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CALL_ABILITY_BY_SCB) {
-        return CallUIAbilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_SPECIFIED_ABILITY_BY_SCB) {
-        return StartSpecifiedAbilityBySCBInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
+    static const RequestFuncTable requestFuncTable(std::begin(requestFuncEntries), std::end(requestFuncEntries));
+    return requestFuncTable;
 }
 
-int AbilityManagerStub::OnRemoteRequestInnerSeventeenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
+AbilityManagerStub::RequestFuncTable::RequestFuncTable(const RequestFuncEntry *begin, const RequestFuncEntry *end)
+    : entries(begin, end)
 {
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::NOTIFY_SAVE_AS_RESULT) {
-        return NotifySaveAsResultInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_SESSIONMANAGERSERVICE) {
-        return SetSessionManagerServiceInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UPDATE_SESSION_INFO) {
-        return UpdateSessionInfoBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_STATUS_BAR_DELEGATE) {
-        return RegisterStatusBarDelegateInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::KILL_PROCESS_WITH_PREPARE_TERMINATE) {
-        return KillProcessWithPrepareTerminateInner(data, reply);
+    uint32_t maxCode = 0;
+    for (const auto &entry : entries) {
+        maxCode = std::max(maxCode, static_cast<uint32_t>(entry.code));
     }
-    if (interfaceCode == AbilityManagerInterfaceCode::REGISTER_AUTO_STARTUP_SYSTEM_CALLBACK) {
-        return RegisterAutoStartupSystemCallbackInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::UNREGISTER_AUTO_STARTUP_SYSTEM_CALLBACK) {
-        return UnregisterAutoStartupSystemCallbackInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_APPLICATION_AUTO_STARTUP) {
-        return SetApplicationAutoStartupInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CANCEL_APPLICATION_AUTO_STARTUP) {
-        return CancelApplicationAutoStartupInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::QUERY_ALL_AUTO_STARTUP_APPLICATION) {
-        return QueryAllAutoStartupApplicationsInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-int AbilityManagerStub::OnRemoteRequestInnerEighteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_CONNECTION_DATA) {
-        return GetConnectionDataInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_APPLICATION_AUTO_STARTUP_BY_EDM) {
-        return SetApplicationAutoStartupByEDMInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CANCEL_APPLICATION_AUTO_STARTUP_BY_EDM) {
-        return CancelApplicationAutoStartupByEDMInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_FOR_RESULT_AS_CALLER) {
-        return StartAbilityForResultAsCallerInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_ABILITY_FOR_RESULT_AS_CALLER_FOR_OPTIONS) {
-        return StartAbilityForResultAsCallerForOptionsInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_FOREGROUND_UI_ABILITIES) {
-        return GetForegroundUIAbilitiesInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::RESTART_APP) {
-        return RestartAppInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::OPEN_ATOMIC_SERVICE) {
-        return OpenAtomicServiceInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::IS_EMBEDDED_OPEN_ALLOWED) {
-        return IsEmbeddedOpenAllowedInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::REQUEST_ASSERT_FAULT_DIALOG) {
-        return RequestAssertFaultDialogInner(data, reply);
-    }
-    return ERR_CODE_NOT_EXIST;
-}
-
-
-int AbilityManagerStub::OnRemoteRequestInnerNineteenth(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    AbilityManagerInterfaceCode interfaceCode = static_cast<AbilityManagerInterfaceCode>(code);
-    if (interfaceCode == AbilityManagerInterfaceCode::NOTIFY_DEBUG_ASSERT_RESULT) {
-        return NotifyDebugAssertResultInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CHANGE_ABILITY_VISIBILITY) {
-        return ChangeAbilityVisibilityInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CHANGE_UI_ABILITY_VISIBILITY_BY_SCB) {
-        return ChangeUIAbilityVisibilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::START_SHORTCUT) {
-        return StartShortcutInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::SET_RESIDENT_PROCESS_ENABLE) {
-        return SetResidentProcessEnableInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::GET_ABILITY_STATE_BY_PERSISTENT_ID) {
-        return GetAbilityStateByPersistentIdInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::TRANSFER_ABILITY_RESULT) {
-        return TransferAbilityResultForExtensionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::NOTIFY_FROZEN_PROCESS_BY_RSS) {
-        return NotifyFrozenProcessByRSSInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::PRE_START_MISSION) {
-        return PreStartMissionInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::CLEAN_UI_ABILITY_BY_SCB) {
-        return CleanUIAbilityBySCBInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::OPEN_LINK) {
-        return OpenLinkInner(data, reply);
-    }
-    if (interfaceCode == AbilityManagerInterfaceCode::TERMINATE_MISSION) {
-        return TerminateMissionInner(data, reply);
+    slots.assign(maxCode + 1, 0);
+    for (size_t index = 0; index < entries.size(); index++) {
+        auto &slot = slots[static_cast<uint32_t>(entries[index].code)];
+        if (slot == 0) {
+            slot = static_cast<uint16_t>(index + 1);
+        }
     }
-    return ERR_CODE_NOT_EXIST;
 }
 
 int AbilityManagerStub::OnRemoteRequestInner(uint32_t code, MessageParcel &data,
     MessageParcel &reply, MessageOption &option)
 {
-    int retCode = ERR_OK;
-    retCode = HandleOnRemoteRequestInnerFirst(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = HandleOnRemoteRequestInnerSecond(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
+    const auto &requestFuncTable = GetRequestFuncTable();
+    if (code < requestFuncTable.slots.size() && requestFuncTable.slots[code] != 0) {
+        size_t index = requestFuncTable.slots[code] - 1;
+        auto begin = std::chrono::steady_clock::now();
+        int retCode = (this->*(requestFuncTable.entries[index].func))(data, reply);
+        RecordRequestCost(index, std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count());
         return retCode;
     }
     TAG_LOGW(AAFwkTag::ABILITYMGR, "default case, need check.");
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
 
-int AbilityManagerStub::HandleOnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
+void AbilityManagerStub::RecordRequestCost(size_t index, int64_t costUs)
 {
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerFirst(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSecond(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerThird(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFourth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFifth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
+    if (requestStats_ == nullptr) {
+        return;
     }
-    retCode = OnRemoteRequestInnerSixth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSeventh(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerEighth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerNinth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    RequestStat &stat = requestStats_[index];
+    stat.count.fetch_add(1, std::memory_order_relaxed);
+    stat.totalCostUs.fetch_add(cost, std::memory_order_relaxed);
+    uint64_t maxCost = stat.maxCostUs.load(std::memory_order_relaxed);
+    while (cost > maxCost && !stat.maxCostUs.compare_exchange_weak(maxCost, cost, std::memory_order_relaxed)) {}
+    size_t bucket = 0;
+    while (bucket < std::size(REQUEST_COST_BUCKET_BOUNDS_US) && cost >= REQUEST_COST_BUCKET_BOUNDS_US[bucket]) {
+        bucket++;
     }
-    return ERR_CODE_NOT_EXIST;
+    stat.costBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
 }
 
-int AbilityManagerStub::HandleOnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
+void AbilityManagerStub::DumpRequestStats(std::vector<std::string> &info)
 {
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerEleventh(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTwelveth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerThirteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFourteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFifteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSixteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSeventeenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerEighteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
+    const auto &requestFuncTable = GetRequestFuncTable();
+    std::vector<std::pair<uint64_t, size_t>> usedIndexes;
+    for (size_t index = 0; requestStats_ != nullptr && index < requestFuncTable.entries.size(); index++) {
+        uint64_t count = requestStats_[index].count.load(std::memory_order_relaxed);
+        if (count > 0) {
+            usedIndexes.emplace_back(count, index);
+        }
     }
-    retCode = OnRemoteRequestInnerNineteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
+    std::sort(usedIndexes.begin(), usedIndexes.end(), std::greater<>());
+    info.push_back("IPC request stats, cost buckets(us): <100 <1000 <10000 <100000 >=100000");
+    for (const auto &[count, index] : usedIndexes) {
+        const RequestStat &stat = requestStats_[index];
+        std::string line = "  code:" + std::to_string(static_cast<uint32_t>(requestFuncTable.entries[index].code)) +
+            " count:" + std::to_string(count) +
+            " avgUs:" + std::to_string(stat.totalCostUs.load(std::memory_order_relaxed) / count) +
+            " maxUs:" + std::to_string(stat.maxCostUs.load(std::memory_order_relaxed)) + " buckets:";
+        for (const auto &bucket : stat.costBuckets) {
+            line.append(" ").append(std::to_string(bucket.load(std::memory_order_relaxed)));
+        }
+        info.push_back(line);
     }
-    return ERR_CODE_NOT_EXIST;
 }
 
 int AbilityManagerStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
@@ -15,7 +15,11 @@
 
 #include "ability_record.h"
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include <singleton.h>
+#include <unordered_set>
 
 #include "ability_manager_service.h"
 #include "ability_resident_process_rdb.h"
@@ -126,11 +130,49 @@ auto g_addLifecycleEventTask = [](sptr<Token> token, FreezeUtil::TimeoutState st
     FreezeUtil::GetInstance().AddLifecycleEvent(flow, entry);
 };
 
+namespace {
+// Tokens created in this process, keyed by their IRemoteObject address and dropped in ~Token,
+// so a hit proves the object is a live local Token without reading its descriptor.
+struct LiveTokenSet {
+    std::shared_mutex mutex;
+    std::unordered_set<const IRemoteObject *> tokens;
+};
+
+LiveTokenSet &GetLiveTokenSet()
+{
+    // never destroyed, tokens may still be released by other static objects at exit.
+    static LiveTokenSet *liveTokenSet = new LiveTokenSet();
+    return *liveTokenSet;
+}
+
+std::atomic<uint64_t> g_tokenSlowPathCount = 0;
+}
+
 Token::Token(std::weak_ptr<AbilityRecord> abilityRecord) : abilityRecord_(abilityRecord)
-{}
+{
+    auto &liveTokenSet = GetLiveTokenSet();
+    std::unique_lock lock(liveTokenSet.mutex);
+    liveTokenSet.tokens.insert(static_cast<const IRemoteObject *>(this));
+}
 
 Token::~Token()
-{}
+{
+    auto &liveTokenSet = GetLiveTokenSet();
+    std::unique_lock lock(liveTokenSet.mutex);
+    liveTokenSet.tokens.erase(static_cast<const IRemoteObject *>(this));
+}
+
+bool Token::IsLiveToken(const IRemoteObject *object)
+{
+    auto &liveTokenSet = GetLiveTokenSet();
+    std::shared_lock lock(liveTokenSet.mutex);
+    return liveTokenSet.tokens.find(object) != liveTokenSet.tokens.end();
+}
+
+uint64_t Token::GetSlowPathCount()
+{
+    return g_tokenSlowPathCount.load(std::memory_order_relaxed);
+}
 
 std::shared_ptr<AbilityRecord> Token::GetAbilityRecordByToken(const sptr<IRemoteObject> &token)
 {
@@ -139,6 +181,12 @@ std::shared_ptr<AbilityRecord> Token::GetAbilityRecordByToken(const sptr<IRemote
         return nullptr;
     }
 
+    // the caller holds a strong reference, so a live token can not be destroyed during the cast.
+    if (IsLiveToken(token.GetRefPtr())) {
+        return (static_cast<Token *>(token.GetRefPtr()))->GetAbilityRecord();
+    }
+    g_tokenSlowPathCount.fetch_add(1, std::memory_order_relaxed);
+
     std::string descriptor = Str16ToStr8(token->GetObjectDescriptor());
     if (descriptor != "ohos.aafwk.AbilityToken") {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "Input token is not an AbilityToken, token->GetObjectDescriptor(): %{public}s",
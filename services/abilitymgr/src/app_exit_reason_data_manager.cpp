@@ -84,6 +84,63 @@ bool AppExitReasonDataManager::CheckKvStore()
     return kvStorePtr_ != nullptr;
 }
 
+bool AppExitReasonDataManager::LoadEntriesLocked()
+{
+    if (isEntriesLoaded_) {
+        return true;
+    }
+    if (kvStorePtr_ == nullptr) {
+        return false;
+    }
+
+    std::vector<DistributedKv::Entry> allEntries;
+    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
+    if (status != DistributedKv::Status::SUCCESS) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
+        return false;
+    }
+    entries_.clear();
+    for (const auto &item : allEntries) {
+        entries_.emplace(item.key.ToString(), item.value);
+    }
+    isEntriesLoaded_ = true;
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "load %{public}zu entries", entries_.size());
+    return true;
+}
+
+DistributedKv::Status AppExitReasonDataManager::GetEntryLocked(
+    const DistributedKv::Key &key, DistributedKv::Value &value)
+{
+    if (!LoadEntriesLocked()) {
+        return DistributedKv::Status::ERROR;
+    }
+    auto iter = entries_.find(key.ToString());
+    if (iter == entries_.end()) {
+        return DistributedKv::Status::KEY_NOT_FOUND;
+    }
+    value = iter->second;
+    return DistributedKv::Status::SUCCESS;
+}
+
+DistributedKv::Status AppExitReasonDataManager::PutEntryLocked(
+    const DistributedKv::Key &key, const DistributedKv::Value &value)
+{
+    DistributedKv::Status status = kvStorePtr_->Put(key, value);
+    if (status == DistributedKv::Status::SUCCESS && isEntriesLoaded_) {
+        entries_[key.ToString()] = value;
+    }
+    return status;
+}
+
+DistributedKv::Status AppExitReasonDataManager::DeleteEntryLocked(const DistributedKv::Key &key)
+{
+    DistributedKv::Status status = kvStorePtr_->Delete(key);
+    if (status == DistributedKv::Status::SUCCESS) {
+        entries_.erase(key.ToString());
+    }
+    return status;
+}
+
 int32_t AppExitReasonDataManager::SetAppExitReason(const std::string &bundleName, uint32_t accessTokenId,
     const std::vector<std::string> &abilityList, const AAFwk::ExitReason &exitReason)
 {
@@ -107,7 +164,7 @@ int32_t AppExitReasonDataManager::SetAppExitReason(const std::string &bundleName
     DistributedKv::Status status;
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
+        status = PutEntryLocked(key, value);
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -148,28 +205,31 @@ int32_t AppExitReasonDataManager::DeleteAppExitReason(const std::string &bundleN
     }
 
     std::string keyUiExten = bundleName + SEPARATOR;
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "Get entries error: %{public}d", status);
+    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    if (!LoadEntriesLocked()) {
         return ERR_INVALID_OPERATION;
     }
 
-    for (const auto &item : allEntries) {
-        const auto &keyValue = item.key.ToString();
-        if (keyValue != accessTokenIdStr && keyValue.find(keyUiExten) == std::string::npos) {
-            continue;
-        }
-
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        auto errCode = kvStorePtr_->Delete(item.key);
-        status = (errCode != DistributedKv::Status::SUCCESS) ? errCode : status;
+    std::vector<DistributedKv::Key> keys;
+    if (entries_.find(accessTokenIdStr) != entries_.end()) {
+        keys.emplace_back(accessTokenIdStr);
+    }
+    for (auto iter = entries_.lower_bound(keyUiExten);
+        iter != entries_.end() && iter->first.compare(0, keyUiExten.size(), keyUiExten) == 0; ++iter) {
+        keys.emplace_back(iter->first);
+    }
+    if (keys.empty()) {
+        return ERR_OK;
     }
 
+    DistributedKv::Status status = kvStorePtr_->DeleteBatch(keys);
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "delete data from kvStore error: %{public}d", status);
         return ERR_INVALID_OPERATION;
     }
+    for (const auto &key : keys) {
+        entries_.erase(key.ToString());
+    }
     return ERR_OK;
 }
 
@@ -191,8 +251,16 @@ int32_t AppExitReasonDataManager::GetAppExitReason(const std::string &bundleName
         }
     }
 
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
+    DistributedKv::Value value;
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(DistributedKv::Key(accessTokenIdStr), value);
+    }
+    isSetReason = false;
+    if (status == DistributedKv::Status::KEY_NOT_FOUND) {
+        return ERR_OK;
+    }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
         return ERR_INVALID_VALUE;
@@ -200,27 +268,20 @@ int32_t AppExitReasonDataManager::GetAppExitReason(const std::string &bundleName
 
     std::vector<std::string> abilityList;
     int64_t time_stamp;
-    isSetReason = false;
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == accessTokenIdStr) {
-            ConvertAppExitReasonInfoFromValue(item.value, exitReason, time_stamp, abilityList);
-            auto pos = std::find(abilityList.begin(), abilityList.end(), abilityName);
-            if (pos != abilityList.end()) {
-                isSetReason = true;
-                abilityList.erase(std::remove(abilityList.begin(), abilityList.end(), abilityName), abilityList.end());
-                UpdateAppExitReason(accessTokenId, abilityList, exitReason);
-            }
-            TAG_LOGI(AAFwkTag::ABILITYMGR, "current bundle name: %{public}s, tokenId:%{private}u, reason: %{public}d,"
-                "  exitMsg: %{public}s, abilityName:%{public}s isSetReason:%{public}d",
-                bundleName.c_str(), accessTokenId, exitReason.reason, exitReason.exitMsg.c_str(),
-                abilityName.c_str(), isSetReason);
-            if (abilityList.empty()) {
-                InnerDeleteAppExitReason(accessTokenIdStr);
-            }
-            break;
-        }
+    ConvertAppExitReasonInfoFromValue(value, exitReason, time_stamp, abilityList);
+    auto pos = std::find(abilityList.begin(), abilityList.end(), abilityName);
+    if (pos != abilityList.end()) {
+        isSetReason = true;
+        abilityList.erase(std::remove(abilityList.begin(), abilityList.end(), abilityName), abilityList.end());
+        UpdateAppExitReason(accessTokenId, abilityList, exitReason);
+    }
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "current bundle name: %{public}s, tokenId:%{private}u, reason: %{public}d,"
+        "  exitMsg: %{public}s, abilityName:%{public}s isSetReason:%{public}d",
+        bundleName.c_str(), accessTokenId, exitReason.reason, exitReason.exitMsg.c_str(),
+        abilityName.c_str(), isSetReason);
+    if (abilityList.empty()) {
+        InnerDeleteAppExitReason(accessTokenIdStr);
     }
-
     return ERR_OK;
 }
 
@@ -236,7 +297,7 @@ void AppExitReasonDataManager::UpdateAppExitReason(uint32_t accessTokenId, const
     DistributedKv::Status status;
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
+        status = DeleteEntryLocked(key);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "delete data from kvStore error: %{public}d.", status);
@@ -246,7 +307,7 @@ void AppExitReasonDataManager::UpdateAppExitReason(uint32_t accessTokenId, const
     DistributedKv::Value value = ConvertAppExitReasonInfoToValue(abilityList, exitReason);
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
+        status = PutEntryLocked(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "insert data to kvStore error: %{public}d", status);
@@ -308,7 +369,7 @@ void AppExitReasonDataManager::InnerDeleteAppExitReason(const std::string &keyNa
     DistributedKv::Status status;
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
+        status = DeleteEntryLocked(key);
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -332,7 +393,11 @@ int32_t AppExitReasonDataManager::AddAbilityRecoverInfo(uint32_t accessTokenId,
 
     DistributedKv::Key key = GetAbilityRecoverInfoKey(accessTokenId);
     DistributedKv::Value value;
-    DistributedKv::Status status = kvStorePtr_->Get(key, value);
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(key, value);
+    }
     if (status != DistributedKv::Status::SUCCESS && status != DistributedKv::Status::KEY_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "AddAbilityRecoverInfo get error: %{public}d", status);
         return ERR_INVALID_VALUE;
@@ -357,7 +422,7 @@ int32_t AppExitReasonDataManager::AddAbilityRecoverInfo(uint32_t accessTokenId,
     value = ConvertAbilityRecoverInfoToValue(recoverInfoList, sessionIdList);
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
+        status = PutEntryLocked(key, value);
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -398,7 +463,11 @@ int32_t AppExitReasonDataManager::DeleteAbilityRecoverInfo(
 
     DistributedKv::Key key = GetAbilityRecoverInfoKey(accessTokenId);
     DistributedKv::Value value;
-    DistributedKv::Status status = kvStorePtr_->Get(key, value);
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(key, value);
+    }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "DeleteAbilityRecoverInfo get error: %{public}d", status);
         return ERR_INVALID_VALUE;
@@ -442,7 +511,11 @@ int32_t AppExitReasonDataManager::GetAbilityRecoverInfo(
 
     DistributedKv::Key key = GetAbilityRecoverInfoKey(accessTokenId);
     DistributedKv::Value value;
-    DistributedKv::Status status = kvStorePtr_->Get(key, value);
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(key, value);
+    }
     if (status != DistributedKv::Status::SUCCESS) {
         if (status == DistributedKv::Status::KEY_NOT_FOUND) {
             TAG_LOGW(AAFwkTag::ABILITYMGR, "GetAbilityRecoverInfo KEY_NOT_FOUND.");
@@ -480,7 +553,11 @@ int32_t AppExitReasonDataManager::GetAbilitySessionId(uint32_t accessTokenId,
 
     DistributedKv::Key key = GetAbilityRecoverInfoKey(accessTokenId);
     DistributedKv::Value value;
-    DistributedKv::Status status = kvStorePtr_->Get(key, value);
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(key, value);
+    }
     if (status != DistributedKv::Status::SUCCESS) {
         if (status == DistributedKv::Status::KEY_NOT_FOUND) {
             TAG_LOGW(AAFwkTag::ABILITYMGR, "GetAbilityRecoverInfo KEY_NOT_FOUND");
@@ -527,7 +604,7 @@ int32_t AppExitReasonDataManager::SetUIExtensionAbilityExitReason(
         DistributedKv::Status status;
         {
             std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-            status = kvStorePtr_->Put(key, value);
+            status = PutEntryLocked(key, value);
         }
 
         if (status != DistributedKv::Status::SUCCESS) {
@@ -550,25 +627,23 @@ bool AppExitReasonDataManager::GetUIExtensionAbilityExitReason(const std::string
         }
     }
 
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
+    DistributedKv::Value value;
+    DistributedKv::Status status;
+    {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        status = GetEntryLocked(DistributedKv::Key(keyEx), value);
+    }
     if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "Get entries error: %{public}d", status);
+        if (status != DistributedKv::Status::KEY_NOT_FOUND) {
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "Get entries error: %{public}d", status);
+        }
         return false;
     }
     std::vector<std::string> abilityList;
     int64_t time_stamp;
-    bool isHaveReason = false;
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == keyEx) {
-            ConvertAppExitReasonInfoFromValue(item.value, exitReason, time_stamp, abilityList);
-            isHaveReason = true;
-            InnerDeleteAppExitReason(keyEx);
-            break;
-        }
-    }
-
-    return isHaveReason;
+    ConvertAppExitReasonInfoFromValue(value, exitReason, time_stamp, abilityList);
+    InnerDeleteAppExitReason(keyEx);
+    return true;
 }
 
 void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
@@ -583,7 +658,7 @@ void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
     DistributedKv::Status status;
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
+        status = DeleteEntryLocked(key);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "delete data from kvStore error: %{public}d", status);
@@ -593,7 +668,7 @@ void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
     DistributedKv::Value value = ConvertAbilityRecoverInfoToValue(recoverInfoList, sessionIdList);
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
+        status = PutEntryLocked(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "insert data to kvStore failed: %{public}d", status);
@@ -653,7 +728,7 @@ void AppExitReasonDataManager::InnerDeleteAbilityRecoverInfo(uint32_t accessToke
     DistributedKv::Status status;
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
+        status = DeleteEntryLocked(key);
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -14,62 +14,187 @@
  */
 
 #include "interceptor/ability_interceptor_executer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+#include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+constexpr size_t MAX_VERDICT_CACHE_SIZE = 256;
+constexpr uint64_t SLOW_INTERCEPTOR_US = 100000;
+}
+
 void AbilityInterceptorExecuter::AddInterceptor(std::string interceptorName,
     const std::shared_ptr<IAbilityInterceptor> &interceptor)
 {
     std::lock_guard lock(interceptorMapLock_);
-    if (interceptor != nullptr) {
-        interceptorMap_[interceptorName] = interceptor;
+    if (interceptor == nullptr) {
+        return;
+    }
+    auto interceptorList = std::make_shared<InterceptorList>(*interceptorList_);
+    for (auto &entry : *interceptorList) {
+        if (entry.name == interceptorName) {
+            entry.interceptor = interceptor;
+            interceptorList_ = interceptorList;
+            return;
+        }
     }
+    interceptorList->push_back(InterceptorEntry { interceptorName, interceptor,
+        std::make_shared<InterceptorCounters>() });
+    interceptorList_ = interceptorList;
 }
 
 void AbilityInterceptorExecuter::RemoveInterceptor(std::string interceptorName)
 {
     std::lock_guard lock(interceptorMapLock_);
-    auto iter = interceptorMap_.find(interceptorName);
-    if (iter != interceptorMap_.end()) {
-        interceptorMap_.erase(interceptorName);
+    auto interceptorList = std::make_shared<InterceptorList>(*interceptorList_);
+    auto iter = std::find_if(interceptorList->begin(), interceptorList->end(),
+        [&interceptorName](const InterceptorEntry &entry) { return entry.name == interceptorName; });
+    if (iter != interceptorList->end()) {
+        interceptorList->erase(iter);
+        interceptorList_ = interceptorList;
     }
 }
 
 ErrCode AbilityInterceptorExecuter::DoProcess(AbilityInterceptorParam param)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
-    int32_t result = ERR_OK;
-    auto interceptorMap = GetInterceptorMapCopy();
-    auto item = interceptorMap.begin();
-    while (item != interceptorMap.end()) {
-        result = (*item).second->DoProcess(param);
+    auto interceptorList = GetInterceptorList();
+    auto verdictKey = GetVerdictKey(param);
+    uint64_t generation = 0;
+    {
+        std::lock_guard lock(verdictLock_);
+        generation = verdictGeneration_;
+    }
+
+    ErrCode result = ERR_OK;
+    for (const auto &entry : *interceptorList) {
+        bool isCacheable = !verdictKey.empty() && entry.interceptor->IsVerdictCacheable(param);
+        if (isCacheable && IsVerdictPassed(verdictKey, entry.name, param)) {
+            entry.counters->verdictHitCount.fetch_add(1, std::memory_order_relaxed);
+            result = ERR_OK;
+        } else {
+            result = ProcessInterceptor(entry, param);
+        }
         if (result != ERR_OK) {
             break;
-        } else {
-            item++;
+        }
+        if (isCacheable) {
+            SetVerdictPassed(verdictKey, entry.name, param, generation);
         }
     }
     return result;
 }
 
+ErrCode AbilityInterceptorExecuter::ProcessInterceptor(const InterceptorEntry &entry,
+    const AbilityInterceptorParam &param)
+{
+    auto begin = std::chrono::steady_clock::now();
+    ErrCode result = entry.interceptor->DoProcess(param);
+    uint64_t costUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count());
+
+    auto &counters = *entry.counters;
+    counters.processCount.fetch_add(1, std::memory_order_relaxed);
+    counters.totalCostUs.fetch_add(costUs, std::memory_order_relaxed);
+    if (result != ERR_OK) {
+        counters.rejectCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    uint64_t maxCostUs = counters.maxCostUs.load(std::memory_order_relaxed);
+    while (costUs > maxCostUs &&
+        !counters.maxCostUs.compare_exchange_weak(maxCostUs, costUs, std::memory_order_relaxed)) {
+    }
+    if (costUs > SLOW_INTERCEPTOR_US) {
+        TAG_LOGW(AAFwkTag::ABILITYMGR, "interceptor %{public}s cost %{public}" PRIu64 "us",
+            entry.name.c_str(), costUs);
+    }
+    return result;
+}
+
+std::string AbilityInterceptorExecuter::GetVerdictKey(const AbilityInterceptorParam &param)
+{
+    if (param.callerToken == nullptr || param.want.GetElement().GetBundleName().empty()) {
+        return "";
+    }
+    return std::to_string(reinterpret_cast<uintptr_t>(param.callerToken.GetRefPtr())) + ":" +
+        param.want.GetElement().GetURI() + ":" + std::to_string(param.userId) + ":" +
+        std::to_string(param.appIndex);
+}
+
+bool AbilityInterceptorExecuter::IsVerdictPassed(const std::string &key, const std::string &name,
+    const AbilityInterceptorParam &param)
+{
+    std::lock_guard lock(verdictLock_);
+    auto iter = verdictCache_.find(key);
+    if (iter == verdictCache_.end()) {
+        return false;
+    }
+    // the key holds the caller address, a verdict of a released caller must not be reused.
+    if (iter->second.caller.promote() != param.callerToken) {
+        verdictCache_.erase(iter);
+        return false;
+    }
+    return iter->second.passedInterceptors.count(name) != 0;
+}
+
+void AbilityInterceptorExecuter::SetVerdictPassed(const std::string &key, const std::string &name,
+    const AbilityInterceptorParam &param, uint64_t generation)
+{
+    std::lock_guard lock(verdictLock_);
+    if (generation != verdictGeneration_) {
+        return;
+    }
+    auto iter = verdictCache_.find(key);
+    if (iter == verdictCache_.end()) {
+        if (verdictCache_.size() >= MAX_VERDICT_CACHE_SIZE) {
+            verdictCache_.clear();
+        }
+        iter = verdictCache_.emplace(key, VerdictEntry { param.callerToken, {} }).first;
+    }
+    iter->second.passedInterceptors.insert(name);
+}
+
+void AbilityInterceptorExecuter::ClearVerdictCache()
+{
+    std::lock_guard lock(verdictLock_);
+    verdictGeneration_++;
+    verdictCache_.clear();
+}
+
+std::map<std::string, InterceptorStats> AbilityInterceptorExecuter::GetInterceptorStats()
+{
+    std::map<std::string, InterceptorStats> stats;
+    auto interceptorList = GetInterceptorList();
+    for (const auto &entry : *interceptorList) {
+        auto &item = stats[entry.name];
+        item.processCount = entry.counters->processCount.load(std::memory_order_relaxed);
+        item.rejectCount = entry.counters->rejectCount.load(std::memory_order_relaxed);
+        item.verdictHitCount = entry.counters->verdictHitCount.load(std::memory_order_relaxed);
+        item.totalCostUs = entry.counters->totalCostUs.load(std::memory_order_relaxed);
+        item.maxCostUs = entry.counters->maxCostUs.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
 void AbilityInterceptorExecuter::SetTaskHandler(std::shared_ptr<AAFwk::TaskHandlerWrap> taskHandler)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     
-    std::lock_guard lock(interceptorMapLock_);
-    for (auto &item : interceptorMap_) {
-        if (item.second == nullptr) {
-            continue;
-        }
-        (item.second)->SetTaskHandler(taskHandler);
+    auto interceptorList = GetInterceptorList();
+    for (const auto &entry : *interceptorList) {
+        entry.interceptor->SetTaskHandler(taskHandler);
     }
 }
 
-InterceptorMap AbilityInterceptorExecuter::GetInterceptorMapCopy()
+std::shared_ptr<const AbilityInterceptorExecuter::InterceptorList> AbilityInterceptorExecuter::GetInterceptorList()
 {
     std::lock_guard lock(interceptorMapLock_);
-    return interceptorMap_;
+    return interceptorList_;
 }
 } // namespace AAFwk
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -81,5 +81,11 @@ ErrCode ExtensionControlInterceptor::DoProcess(AbilityInterceptorParam param)
     TAG_LOGI(AAFwkTag::ABILITYMGR, "other ok.");
     return ERR_OK;
 }
+
+bool ExtensionControlInterceptor::IsVerdictCacheable(const AbilityInterceptorParam &param)
+{
+    // the strict mode of the caller process is fixed, the one carried by the want is per request.
+    return !param.want.HasParameter(STRICT_MODE);
+}
 } // namespace AAFwk
 } // namespace OHOS
\ No newline at end of file
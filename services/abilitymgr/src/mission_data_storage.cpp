@@ -14,7 +14,12 @@
  */
 
 #include "mission_data_storage.h"
+#include <cerrno>
 #include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
 #include "directory_ex.h"
 #include "file_ex.h"
 #include "hilog_tag_wrapper.h"
@@ -33,6 +38,39 @@ namespace AAFwk {
 namespace {
 constexpr const char* IMAGE_FORMAT = "image/jpeg";
 constexpr uint8_t IMAGE_QUALITY = 75;
+constexpr char JOURNAL_OP_SAVE = 'S';
+constexpr char JOURNAL_OP_DELETE = 'D';
+constexpr char JOURNAL_FIELD_SEPARATOR = ' ';
+constexpr char JOURNAL_RECORD_END = '\n';
+constexpr mode_t JOURNAL_FILE_MODE = 0660;
+// compact once the journal holds this many records more than twice the live missions
+constexpr size_t JOURNAL_COMPACT_SLACK = 64;
+
+bool WriteJournalFile(const std::string &filePath, const std::string &content, bool append)
+{
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    int fd = open(filePath.c_str(), flags, JOURNAL_FILE_MODE);
+    if (fd < 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "open journal %{public}s failed.", filePath.c_str());
+        return false;
+    }
+    size_t offset = 0;
+    while (offset < content.size()) {
+        ssize_t written = write(fd, content.data() + offset, content.size() - offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "write journal %{public}s failed.", filePath.c_str());
+            close(fd);
+            return false;
+        }
+        offset += static_cast<size_t>(written);
+    }
+    bool ret = (fsync(fd) == 0);
+    close(fd);
+    return ret;
+}
 }
 #ifdef SUPPORT_GRAPHICS
 constexpr int32_t RGB888_PIXEL_BYTES = 3;
@@ -49,14 +87,143 @@ MissionDataStorage::~MissionDataStorage()
 
 bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList)
 {
-    std::vector<std::string> fileNameVec;
+    HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
+    std::vector<std::string> legacyFiles;
     std::vector<int32_t> tempMissions;
+    {
+        std::lock_guard<ffrt::mutex> lock(journalMutex_);
+        liveRecords_.clear();
+        journalRecordCount_ = 0;
+        LoadLegacyMissionFiles(legacyFiles);
+        ReplayMissionJournal();
+        isJournalLoaded_ = true;
+
+        for (auto iter = liveRecords_.begin(); iter != liveRecords_.end();) {
+            InnerMissionInfo misssionInfo;
+            if (!misssionInfo.FromJsonStr(iter->second)) {
+                TAG_LOGE(AAFwkTag::ABILITYMGR, "parse mission info failed. missionId: %{public}d", iter->first);
+                iter = liveRecords_.erase(iter);
+                continue;
+            }
+            if (misssionInfo.isTemporary) {
+                tempMissions.push_back(iter->first);
+                iter = liveRecords_.erase(iter);
+                continue;
+            }
+            missionInfoList.push_back(misssionInfo);
+            ++iter;
+        }
+
+        // rewrite the journal when it holds anything besides the live missions, this also drops a torn tail.
+        if (!legacyFiles.empty() || journalRecordCount_ != liveRecords_.size()) {
+            if (CompactMissionJournalLocked()) {
+                for (const auto &fileName : legacyFiles) {
+                    OHOS::RemoveFile(fileName);
+                }
+            }
+        }
+    }
+
+    for (auto missionId : tempMissions) {
+        DeleteMissionSnapshot(missionId);
+    }
+    return true;
+}
+
+void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
+{
+    JournalRecord record;
+    record.missionId = missionInfo.missionInfo.id;
+    record.content = missionInfo.ToJsonStr();
+    std::lock_guard<ffrt::mutex> lock(journalMutex_);
+    pendingRecords_.erase(record.missionId);
+    CommitJournalRecordsLocked({ record });
+}
+
+void MissionDataStorage::DeleteMissionInfo(int missionId)
+{
+    JournalRecord record;
+    record.missionId = missionId;
+    record.isDelete = true;
+    {
+        std::lock_guard<ffrt::mutex> lock(journalMutex_);
+        pendingRecords_.erase(missionId);
+        CommitJournalRecordsLocked({ record });
+    }
+    DeleteMissionSnapshot(missionId);
+}
+
+bool MissionDataStorage::EnqueueSaveMissionInfo(const InnerMissionInfo &missionInfo)
+{
+    JournalRecord record;
+    record.missionId = missionInfo.missionInfo.id;
+    record.content = missionInfo.ToJsonStr();
+    std::lock_guard<ffrt::mutex> lock(journalMutex_);
+    pendingRecords_[record.missionId] = std::move(record);
+    if (isFlushScheduled_) {
+        return false;
+    }
+    isFlushScheduled_ = true;
+    return true;
+}
+
+bool MissionDataStorage::EnqueueDeleteMissionInfo(int missionId)
+{
+    JournalRecord record;
+    record.missionId = missionId;
+    record.isDelete = true;
+    std::lock_guard<ffrt::mutex> lock(journalMutex_);
+    pendingRecords_[missionId] = std::move(record);
+    if (isFlushScheduled_) {
+        return false;
+    }
+    isFlushScheduled_ = true;
+    return true;
+}
+
+void MissionDataStorage::FlushPendingMissionInfo()
+{
+    HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
+    std::vector<JournalRecord> records;
+    std::vector<int32_t> deletedMissions;
+    {
+        std::lock_guard<ffrt::mutex> lock(journalMutex_);
+        isFlushScheduled_ = false;
+        if (pendingRecords_.empty()) {
+            return;
+        }
+        records.reserve(pendingRecords_.size());
+        for (auto &item : pendingRecords_) {
+            if (item.second.isDelete) {
+                deletedMissions.push_back(item.first);
+            }
+            records.push_back(std::move(item.second));
+        }
+        pendingRecords_.clear();
+        CommitJournalRecordsLocked(records);
+    }
+    TAG_LOGD(AAFwkTag::ABILITYMGR, "flush %{public}zu mission records.", records.size());
+
+    for (auto missionId : deletedMissions) {
+        DeleteMissionSnapshot(missionId);
+    }
+}
+
+void MissionDataStorage::DiscardPendingMissionInfo()
+{
+    std::lock_guard<ffrt::mutex> lock(journalMutex_);
+    isFlushScheduled_ = false;
+    pendingRecords_.clear();
+}
+
+void MissionDataStorage::LoadLegacyMissionFiles(std::vector<std::string> &legacyFiles)
+{
+    std::vector<std::string> fileNameVec;
     std::string dirPath = GetMissionDataDirPath();
     OHOS::GetDirFiles(dirPath, fileNameVec);
 
     for (auto fileName : fileNameVec) {
         if (!CheckFileNameValid(fileName)) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "load mission info: file name %{public}s invalid.", fileName.c_str());
             continue;
         }
 
@@ -72,50 +239,160 @@ bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &mission
             TAG_LOGE(AAFwkTag::ABILITYMGR, "parse mission info failed. file: %{public}s", fileName.c_str());
             continue;
         }
-        if (misssionInfo.isTemporary) {
-            tempMissions.push_back(misssionInfo.missionInfo.id);
-            continue;
+        liveRecords_[misssionInfo.missionInfo.id] = std::move(content);
+        legacyFiles.push_back(fileName);
+    }
+}
+
+void MissionDataStorage::ReplayMissionJournal()
+{
+    std::ifstream journal(GetMissionJournalFilePath(), std::ios::in | std::ios::binary);
+    if (!journal.is_open()) {
+        return;
+    }
+
+    std::string line;
+    while (std::getline(journal, line)) {
+        JournalRecord record;
+        if (!DecodeJournalRecord(line, record)) {
+            // a crash can only tear the tail, nothing after it was acknowledged.
+            TAG_LOGW(AAFwkTag::ABILITYMGR, "torn mission journal after %{public}zu records.", journalRecordCount_);
+            journalRecordCount_++;
+            break;
+        }
+        journalRecordCount_++;
+        if (record.isDelete) {
+            liveRecords_.erase(record.missionId);
+        } else {
+            liveRecords_[record.missionId] = std::move(record.content);
         }
-        missionInfoList.push_back(misssionInfo);
     }
+}
 
-    for (auto missionId : tempMissions) {
-        DeleteMissionInfo(missionId);
+void MissionDataStorage::CommitJournalRecordsLocked(const std::vector<JournalRecord> &records)
+{
+    if (records.empty() || !EnsureMissionDataDir()) {
+        return;
     }
+
+    std::string buffer;
+    for (const auto &record : records) {
+        buffer += EncodeJournalRecord(record);
+    }
+    if (!WriteJournalFile(GetMissionJournalFilePath(), buffer, true)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "append %{public}zu mission records failed.", records.size());
+        return;
+    }
+    journalRecordCount_ += records.size();
+    if (!isJournalLoaded_) {
+        return;
+    }
+
+    for (const auto &record : records) {
+        if (record.isDelete) {
+            liveRecords_.erase(record.missionId);
+        } else {
+            liveRecords_[record.missionId] = record.content;
+        }
+    }
+    if (journalRecordCount_ > liveRecords_.size() * 2 + JOURNAL_COMPACT_SLACK) {
+        CompactMissionJournalLocked();
+    }
+}
+
+bool MissionDataStorage::CompactMissionJournalLocked()
+{
+    if (!EnsureMissionDataDir()) {
+        return false;
+    }
+
+    std::string buffer;
+    for (const auto &item : liveRecords_) {
+        JournalRecord record;
+        record.missionId = item.first;
+        record.content = item.second;
+        buffer += EncodeJournalRecord(record);
+    }
+
+    std::string journalPath = GetMissionJournalFilePath();
+    std::string tmpPath = journalPath + MISSION_JOURNAL_TMP_SUFFIX;
+    if (!WriteJournalFile(tmpPath, buffer, false)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "write compacted mission journal failed.");
+        OHOS::RemoveFile(tmpPath);
+        return false;
+    }
+    if (rename(tmpPath.c_str(), journalPath.c_str()) != 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "replace mission journal failed.");
+        OHOS::RemoveFile(tmpPath);
+        return false;
+    }
+    journalRecordCount_ = liveRecords_.size();
     return true;
 }
 
-void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
+std::string MissionDataStorage::EncodeJournalRecord(const JournalRecord &record)
 {
-    std::string filePath = GetMissionDataFilePath(missionInfo.missionInfo.id);
-    std::string dirPath = OHOS::ExtractFilePath(filePath);
+    std::string line;
+    line.reserve(record.content.size() + 32);
+    line += record.isDelete ? JOURNAL_OP_DELETE : JOURNAL_OP_SAVE;
+    line += JOURNAL_FIELD_SEPARATOR;
+    line += std::to_string(record.missionId);
+    line += JOURNAL_FIELD_SEPARATOR;
+    line += std::to_string(record.content.size());
+    line += JOURNAL_FIELD_SEPARATOR;
+    line += record.content;
+    line += JOURNAL_RECORD_END;
+    return line;
+}
+
+bool MissionDataStorage::DecodeJournalRecord(const std::string &line, JournalRecord &record)
+{
+    // line layout: <op> <missionId> <length> <content>
+    if (line.size() < 2 || (line[0] != JOURNAL_OP_SAVE && line[0] != JOURNAL_OP_DELETE) ||
+        line[1] != JOURNAL_FIELD_SEPARATOR) {
+        return false;
+    }
+    size_t idEnd = line.find(JOURNAL_FIELD_SEPARATOR, 2);
+    if (idEnd == std::string::npos || idEnd == 2) {
+        return false;
+    }
+    size_t lengthEnd = line.find(JOURNAL_FIELD_SEPARATOR, idEnd + 1);
+    if (lengthEnd == std::string::npos || lengthEnd == idEnd + 1) {
+        return false;
+    }
+
+    std::string missionId = line.substr(2, idEnd - 2);
+    std::string length = line.substr(idEnd + 1, lengthEnd - idEnd - 1);
+    for (auto ch : missionId + length) {
+        if (!isdigit(ch)) {
+            return false;
+        }
+    }
+    size_t contentLength = std::strtoul(length.c_str(), nullptr, 10);
+    if (line.size() - lengthEnd - 1 != contentLength) {
+        return false;
+    }
+
+    record.isDelete = (line[0] == JOURNAL_OP_DELETE);
+    record.missionId = static_cast<int32_t>(std::strtol(missionId.c_str(), nullptr, 10));
+    record.content = line.substr(lengthEnd + 1);
+    return true;
+}
+
+bool MissionDataStorage::EnsureMissionDataDir()
+{
+    std::string dirPath = GetMissionDataDirPath();
     if (!OHOS::FileExists(dirPath)) {
         bool createDir = OHOS::ForceCreateDirectory(dirPath);
         if (!createDir) {
             TAG_LOGE(AAFwkTag::ABILITYMGR, "create dir %{public}s failed.", dirPath.c_str());
-            return;
+            return false;
         }
 #ifdef SUPPORT_GRAPHICS
         chmod(dirPath.c_str(), MODE);
 #endif // SUPPORT_GRAPHICS
     }
-
-    std::string jsonStr = missionInfo.ToJsonStr();
-    bool saveMissionFile = OHOS::SaveStringToFile(filePath, jsonStr, true);
-    if (!saveMissionFile) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "save mission file %{public}s failed.", filePath.c_str());
-    }
-}
-
-void MissionDataStorage::DeleteMissionInfo(int missionId)
-{
-    std::string filePath = GetMissionDataFilePath(missionId);
-    bool removeMissionFile = OHOS::RemoveFile(filePath);
-    if (!removeMissionFile) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "remove mission file %{public}s failed.", filePath.c_str());
-        return;
-    }
-    DeleteMissionSnapshot(missionId);
+    return true;
 }
 
 void MissionDataStorage::SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
@@ -171,6 +448,11 @@ std::string MissionDataStorage::GetMissionDataFilePath(int missionId)
         + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) + JSON_FILE_SUFFIX;
 }
 
+std::string MissionDataStorage::GetMissionJournalFilePath() const
+{
+    return GetMissionDataDirPath() + FILE_SEPARATOR + MISSION_JOURNAL_FILE_NAME;
+}
+
 std::string MissionDataStorage::GetMissionSnapshotPath(int32_t missionId, bool isLowResolution) const
 {
     std::string filePath = GetMissionDataDirPath() + FILE_SEPARATOR + MISSION_JSON_FILE_PREFIX +
@@ -41,6 +41,7 @@ void MissionList::AddMissionToTop(const std::shared_ptr<Mission> &mission)
 
     missions_.remove(mission);
     missions_.push_front(mission);
+    tokenIndex_.Add(mission->GetAbilityRecord());
     mission->SetMissionList(shared_from_this());
 }
 
@@ -49,11 +50,19 @@ void MissionList::RemoveMission(const std::shared_ptr<Mission> &mission)
     for (auto iter = missions_.begin(); iter != missions_.end(); iter++) {
         if (*iter == mission) {
             missions_.erase(iter);
+            RemoveFromTokenIndex(mission);
             return;
         }
     }
 }
 
+void MissionList::RemoveFromTokenIndex(const std::shared_ptr<Mission> &mission)
+{
+    if (mission) {
+        tokenIndex_.Remove(mission->GetAbilityRecord());
+    }
+}
+
 std::shared_ptr<Mission> MissionList::GetTopMission() const
 {
     if (missions_.empty()) {
@@ -116,17 +125,7 @@ std::shared_ptr<Mission> MissionList::GetRecentStandardMission(const std::string
 
 std::shared_ptr<AbilityRecord> MissionList::GetAbilityRecordByToken(const sptr<IRemoteObject> &token) const
 {
-    for (auto mission : missions_) {
-        if (!mission) {
-            continue;
-        }
-        std::shared_ptr<AbilityRecord> abilityRecord = mission->GetAbilityRecord();
-        if (abilityRecord && token == abilityRecord->GetToken()->AsObject()) {
-            return abilityRecord;
-        }
-    }
-
-    return nullptr;
+    return tokenIndex_.Find(token);
 }
 
 void MissionList::RemoveMissionByAbilityRecord(const std::shared_ptr<AbilityRecord> &abilityRecord)
@@ -134,6 +133,7 @@ void MissionList::RemoveMissionByAbilityRecord(const std::shared_ptr<AbilityReco
     for (auto iter = missions_.begin(); iter != missions_.end(); iter++) {
         if ((*iter)->GetAbilityRecord() == abilityRecord) {
             missions_.erase(iter);
+            tokenIndex_.Remove(abilityRecord);
             return;
         }
     }
@@ -323,6 +323,7 @@ void MissionList::HandleUnInstallApp(const std::string &bundleName, int32_t uid)
         auto mission = *it;
         if (MatchedInitialMission(mission, bundleName, uid)) {
             missions_.erase(it++);
+            RemoveFromTokenIndex(mission);
         } else {
             it++;
         }
@@ -1132,10 +1132,9 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByTokenInner(
         return nullptr;
     }
     // first find in terminating list
-    for (auto ability : terminateAbilityList_) {
-        if (ability && token == ability->GetToken()->AsObject()) {
-            return ability;
-        }
+    auto ability = GetAbilityFromTerminateListInner(token);
+    if (ability) {
+        return ability;
     }
 
     return GetAliveAbilityRecordByToken(token);
@@ -1666,6 +1665,7 @@ void MissionListManager::RemoveTerminatingAbility(const std::shared_ptr<AbilityR
     missionList->RemoveMissionByAbilityRecord(abilityRecord);
     DelayedSingleton<AppScheduler>::GetInstance()->PrepareTerminate(abilityRecord->GetToken());
     terminateAbilityList_.push_back(abilityRecord);
+    terminateTokenIndex_.Add(abilityRecord);
 
     if (missionList->IsEmpty()) {
         TAG_LOGD(AAFwkTag::ABILITYMGR, "Remove terminating ability, missionList is empty, remove.");
@@ -1810,6 +1810,7 @@ void MissionListManager::CompleteTerminateAndUpdateMission(const std::shared_ptr
         if (it == abilityRecord) {
             abilityRecord->RevokeUriPermission();
             terminateAbilityList_.remove(it);
+            terminateTokenIndex_.Remove(it);
             // update inner mission info time
             bool excludeFromMissions = abilityRecord->GetAbilityInfo().excludeFromMissions;
             if ((abilityRecord->GetAppIndex() > AbilityRuntime::GlobalConstant::MAX_APP_CLONE_INDEX) ||
@@ -1845,19 +1846,14 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityFromTerminateList(c
     return GetAbilityFromTerminateListInner(token);
 }
 
-std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityFromTerminateListInner(const sptr<IRemoteObject> &token)
+std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityFromTerminateListInner(
+    const sptr<IRemoteObject> &token) const
 {
     if (!token) {
         return nullptr;
     }
 
-    for (auto abilityRecord : terminateAbilityList_) {
-        // token is type of IRemoteObject, abilityRecord->GetToken() is type of Token extending from IRemoteObject.
-        if (abilityRecord && abilityRecord->GetToken() && token == abilityRecord->GetToken()->AsObject()) {
-            return abilityRecord;
-        }
-    }
-    return nullptr;
+    return terminateTokenIndex_.Find(token);
 }
 
 int MissionListManager::ClearMission(int missionId)
@@ -2463,6 +2459,7 @@ void MissionListManager::MoveToTerminateList(const std::shared_ptr<AbilityRecord
     // other remove to terminate list.
     abilityRecord->SetTerminatingState();
     terminateAbilityList_.push_back(abilityRecord);
+    terminateTokenIndex_.Add(abilityRecord);
 
     TAG_LOGI(AAFwkTag::ABILITYMGR, "MoveToDefaultList end");
 }
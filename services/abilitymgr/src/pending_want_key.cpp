@@ -15,8 +15,18 @@
 
 #include "pending_want_key.h"
 
+#include <functional>
+
 namespace OHOS {
 namespace AAFwk {
+namespace {
+template<typename T>
+void HashCombine(size_t &hashCode, const T &value)
+{
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<T>()(value);
+}
+}
+
 void PendingWantKey::SetType(const int32_t type)
 {
     type_ = type;
@@ -142,5 +152,26 @@ bool PendingWantKey::IsEqualsRequestWant(const Want &otherWant)
     std::lock_guard<std::mutex> lock(requestWantMutex_);
     return requestWant_.IsEquals(otherWant);
 }
+
+size_t PendingWantKey::GetHashCode()
+{
+    size_t hashCode = 0;
+    HashCombine(hashCode, type_);
+    HashCombine(hashCode, bundleName_);
+    HashCombine(hashCode, requestWho_);
+    HashCombine(hashCode, requestCode_);
+    HashCombine(hashCode, requestResolvedType_);
+    HashCombine(hashCode, userId_);
+    HashCombine(hashCode, appIndex_);
+    std::lock_guard<std::mutex> lock(requestWantMutex_);
+    const auto &element = requestWant_.GetElement();
+    HashCombine(hashCode, element.GetBundleName());
+    HashCombine(hashCode, element.GetAbilityName());
+    HashCombine(hashCode, element.GetModuleName());
+    HashCombine(hashCode, requestWant_.GetAction());
+    HashCombine(hashCode, requestWant_.GetUriString());
+    HashCombine(hashCode, requestWant_.GetFlags());
+    return hashCode;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
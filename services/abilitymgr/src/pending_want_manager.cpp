@@ -82,17 +82,19 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (ref != nullptr) {
         if (!needCancel) {
             if (needUpdate && wantSenderInfo.allWants.size() > 0) {
+                RemoveKeyIndexLocked(ref->GetKey());
                 ref->GetKey()->SetRequestWant(wantSenderInfo.allWants.back().want);
                 ref->GetKey()->SetRequestResolvedType(wantSenderInfo.allWants.back().resolvedTypes);
                 wantSenderInfo.allWants.back().want = ref->GetKey()->GetRequestWant();
                 wantSenderInfo.allWants.back().resolvedTypes = ref->GetKey()->GetRequestResolvedType();
                 ref->GetKey()->SetAllWantsInfos(wantSenderInfo.allWants);
+                AddKeyIndexLocked(ref->GetKey());
                 ref->SetCallerUid(callingUid);
             }
             return ref;
         }
         MakeWantSenderCanceledLocked(*ref);
-        wantRecords_.erase(ref->GetKey());
+        EraseWantRecordLocked(ref->GetKey());
     }
 
     if (!needCreate) {
@@ -105,7 +107,7 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (rec != nullptr) {
         rec->SetCallerUid(callingUid);
         pendingKey->SetCode(PendingRecordIdCreate());
-        wantRecords_.insert(std::make_pair(pendingKey, rec));
+        InsertWantRecordLocked(pendingKey, rec);
         TAG_LOGI(AAFwkTag::WANTAGENT, "wantRecords_ size %{public}zu", wantRecords_.size());
         return rec;
     }
@@ -125,16 +127,59 @@ void PendingWantManager::MakeWantSenderCanceledLocked(PendingWantRecord &record)
 sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std::shared_ptr<PendingWantKey> &key)
 {
     TAG_LOGD(AAFwkTag::WANTAGENT, "begin");
-    for (const auto &item : wantRecords_) {
-        const auto pendingKey = item.first;
-        const auto pendingRecord = item.second;
-        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingKey, key)) {
+    if (key == nullptr) {
+        return nullptr;
+    }
+    auto range = wantRecordsIndex_.equal_range(key->GetHashCode());
+    for (auto it = range.first; it != range.second; ++it) {
+        auto item = wantRecords_.find(it->second);
+        if (item == wantRecords_.end()) {
+            continue;
+        }
+        const auto &pendingRecord = item->second;
+        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(item->first, key)) {
             return pendingRecord;
         }
     }
     return nullptr;
 }
 
+void PendingWantManager::InsertWantRecordLocked(const std::shared_ptr<PendingWantKey> &key,
+    const sptr<PendingWantRecord> &record)
+{
+    if (wantRecords_.insert(std::make_pair(key, record)).second) {
+        AddKeyIndexLocked(key);
+    }
+}
+
+void PendingWantManager::EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (wantRecords_.erase(key) > 0) {
+        RemoveKeyIndexLocked(key);
+    }
+}
+
+void PendingWantManager::AddKeyIndexLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (key != nullptr) {
+        wantRecordsIndex_.emplace(key->GetHashCode(), key);
+    }
+}
+
+void PendingWantManager::RemoveKeyIndexLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (key == nullptr) {
+        return;
+    }
+    auto range = wantRecordsIndex_.equal_range(key->GetHashCode());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == key) {
+            wantRecordsIndex_.erase(it);
+            return;
+        }
+    }
+}
+
 bool PendingWantManager::CheckPendingWantRecordByKey(
     const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
 {
@@ -228,7 +273,7 @@ void PendingWantManager::CancelWantSenderLocked(PendingWantRecord &record, bool
     std::lock_guard<ffrt::mutex> locker(mutex_);
     MakeWantSenderCanceledLocked(record);
     if (cleanAbility) {
-        wantRecords_.erase(record.GetKey());
+        EraseWantRecordLocked(record.GetKey());
     }
 }
 
@@ -589,6 +634,7 @@ void PendingWantManager::ClearPendingWantRecordTask(const std::string &bundleNam
                 }
             }
             if (hasBundle) {
+                RemoveKeyIndexLocked(iter->first);
                 iter = wantRecords_.erase(iter);
                 TAG_LOGI(AAFwkTag::WANTAGENT, "wantRecords_ size %{public}zu", wantRecords_.size());
             } else {
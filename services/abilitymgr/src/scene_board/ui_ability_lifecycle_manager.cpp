@@ -120,6 +120,7 @@ int UIAbilityLifecycleManager::StartUIAbility(AbilityRequest &abilityRequest, sp
         MoreAbilityNumbersSendEventInfo(
             abilityRequest.userId, abilityInfo.bundleName, abilityInfo.name, abilityInfo.moduleName);
         sessionAbilityMap_.emplace(sessionInfo->persistentId, uiAbilityRecord);
+        sessionTokenIndex_.Add(uiAbilityRecord);
     }
 
     UpdateAbilityRecordLaunchReason(abilityRequest, uiAbilityRecord);
@@ -554,18 +555,11 @@ std::shared_ptr<AbilityRecord> UIAbilityLifecycleManager::GetAbilityRecordByToke
         return nullptr;
     }
 
-    for (auto ability : terminateAbilityList_) {
-        if (ability && token == ability->GetToken()->AsObject()) {
-            return ability;
-        }
+    auto ability = terminateTokenIndex_.Find(token);
+    if (ability) {
+        return ability;
     }
-
-    for (auto iter = sessionAbilityMap_.begin(); iter != sessionAbilityMap_.end(); iter++) {
-        if (iter->second != nullptr && iter->second->GetToken()->AsObject() == token) {
-            return iter->second;
-        }
-    }
-    return nullptr;
+    return sessionTokenIndex_.Find(token);
 }
 
 #ifdef SUPPORT_SCREEN
@@ -619,6 +613,7 @@ void UIAbilityLifecycleManager::EraseAbilityRecord(const std::shared_ptr<Ability
 
     for (auto iter = sessionAbilityMap_.begin(); iter != sessionAbilityMap_.end(); iter++) {
         if (iter->second != nullptr && iter->second->GetToken()->AsObject() == abilityRecord->GetToken()->AsObject()) {
+            sessionTokenIndex_.Remove(iter->second);
             sessionAbilityMap_.erase(iter);
             break;
         }
@@ -922,6 +917,7 @@ void UIAbilityLifecycleManager::CallUIAbilityBySCB(const sptr<SessionInfo> &sess
         sessionInfo->want.GetElement().GetAbilityName(), sessionInfo->want.GetElement().GetModuleName());
 
     sessionAbilityMap_.emplace(sessionInfo->persistentId, uiAbilityRecord);
+    sessionTokenIndex_.Add(uiAbilityRecord);
     tmpAbilityMap_.erase(search);
     uiAbilityRecord->SetSessionInfo(sessionInfo);
 
@@ -1203,6 +1199,7 @@ int UIAbilityLifecycleManager::CloseUIAbilityInner(std::shared_ptr<AbilityRecord
     }
 
     terminateAbilityList_.push_back(abilityRecord);
+    terminateTokenIndex_.Add(abilityRecord);
     abilityRecord->SendResultToCallers();
 
     if (abilityRecord->IsDebug() && isClearSession) {
@@ -1264,6 +1261,7 @@ void UIAbilityLifecycleManager::CompleteTerminate(const std::shared_ptr<AbilityR
     abilityRecord->RevokeUriPermission();
     EraseSpecifiedAbilityRecord(abilityRecord);
     terminateAbilityList_.remove(abilityRecord);
+    terminateTokenIndex_.Remove(abilityRecord);
 }
 
 int32_t UIAbilityLifecycleManager::GetPersistentIdByAbilityRequest(const AbilityRequest &abilityRequest,
@@ -1512,6 +1510,7 @@ void UIAbilityLifecycleManager::OnAbilityDied(std::shared_ptr<AbilityRecord> abi
     }
 
     terminateAbilityList_.push_back(abilityRecord);
+    terminateTokenIndex_.Add(abilityRecord);
     abilityRecord->SetAbilityState(AbilityState::TERMINATING);
     NotifySCBToHandleException(abilityRecord, static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_DIED),
         "onAbilityDied");
@@ -39,6 +39,11 @@ bool TaskDataPersistenceMgr::Init(int userId)
     }
 
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (currentMissionDataStorage_ && currentUserId_ != userId) {
+        // the delayed flush is bound to the previous user, write it out before switching.
+        handler_->CancelTask(FLUSH_MISSION_INFO);
+        currentMissionDataStorage_->FlushPendingMissionInfo();
+    }
     if (missionDataStorageMgr_.find(userId) == missionDataStorageMgr_.end()) {
         currentMissionDataStorage_ = std::make_shared<MissionDataStorage>(userId);
         missionDataStorageMgr_.insert(std::make_pair(userId, currentMissionDataStorage_));
@@ -71,14 +76,9 @@ bool TaskDataPersistenceMgr::SaveMissionInfo(const InnerMissionInfo &missionInfo
         return false;
     }
 
-    std::weak_ptr<MissionDataStorage> weakPtr(currentMissionDataStorage_);
-    std::function<void()> SaveMissionInfoFunc = [weakPtr, missionInfo]() {
-        auto missionDataStorage = weakPtr.lock();
-        if (missionDataStorage) {
-            missionDataStorage->SaveMissionInfo(missionInfo);
-        }
-    };
-    handler_->SubmitTask(SaveMissionInfoFunc, SAVE_MISSION_INFO);
+    if (currentMissionDataStorage_->EnqueueSaveMissionInfo(missionInfo)) {
+        ScheduleFlushMissionInfo();
+    }
     return true;
 }
 
@@ -90,15 +90,22 @@ bool TaskDataPersistenceMgr::DeleteMissionInfo(int missionId)
         return false;
     }
 
+    if (currentMissionDataStorage_->EnqueueDeleteMissionInfo(missionId)) {
+        ScheduleFlushMissionInfo();
+    }
+    return true;
+}
+
+void TaskDataPersistenceMgr::ScheduleFlushMissionInfo()
+{
     std::weak_ptr<MissionDataStorage> weakPtr(currentMissionDataStorage_);
-    std::function<void()> DeleteMissionInfoFunc = [weakPtr, missionId]() {
+    std::function<void()> FlushMissionInfoFunc = [weakPtr]() {
         auto missionDataStorage = weakPtr.lock();
         if (missionDataStorage) {
-            missionDataStorage->DeleteMissionInfo(missionId);
+            missionDataStorage->FlushPendingMissionInfo();
         }
     };
-    handler_->SubmitTask(DeleteMissionInfoFunc, DELETE_MISSION_INFO);
-    return true;
+    handler_->SubmitTask(FlushMissionInfoFunc, FLUSH_MISSION_INFO, FLUSH_MISSION_INFO_DELAY_MS);
 }
 
 bool TaskDataPersistenceMgr::RemoveUserDir(int32_t userId)
@@ -108,6 +115,14 @@ bool TaskDataPersistenceMgr::RemoveUserDir(int32_t userId)
         TAG_LOGE(AAFwkTag::ABILITYMGR, "can not removed current user dir");
         return false;
     }
+    auto iter = missionDataStorageMgr_.find(userId);
+    if (iter != missionDataStorageMgr_.end()) {
+        // a pending flush of the removed user must not recreate the dir.
+        if (iter->second) {
+            iter->second->DiscardPendingMissionInfo();
+        }
+        missionDataStorageMgr_.erase(iter);
+    }
     std::string userDir = std::string(TASK_DATA_FILE_BASE_PATH) + "/" + std::to_string(userId);
     bool ret = OHOS::ForceRemoveDirectory(userDir);
     if (!ret) {
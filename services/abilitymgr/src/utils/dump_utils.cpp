@@ -109,6 +109,15 @@ std::pair<bool, DumpUtils::DumpsysKey> DumpUtils::DumpsysMap(std::string argStri
     } else if (argString.compare("-d") == 0 || argString.compare("--data") == 0) {
         result.first = true;
         result.second = KEY_DUMP_SYS_DATA;
+    } else if (argString.compare("-I") == 0 || argString.compare("--ipc") == 0) {
+        result.first = true;
+        result.second = KEY_DUMP_SYS_IPC;
+    } else if (argString.compare("-T") == 0 || argString.compare("--interceptor") == 0) {
+        result.first = true;
+        result.second = KEY_DUMP_SYS_INTERCEPTOR;
+    } else if (argString.compare("-O") == 0 || argString.compare("--timeout") == 0) {
+        result.first = true;
+        result.second = KEY_DUMP_SYS_TIMEOUT;
     }
     return result;
 }
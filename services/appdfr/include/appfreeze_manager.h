@@ -90,7 +90,7 @@ private:
     AppfreezeManager& operator=(const AppfreezeManager&) = delete;
     AppfreezeManager(const AppfreezeManager&) = delete;
     uint64_t GetMilliseconds();
-    std::map<int, std::set<int>> BinderParser(std::ifstream& fin, std::string& stack) const;
+    std::map<int, std::set<int>> BinderParser(std::istream& fin, std::string& stack) const;
     void ParseBinderPids(const std::map<int, std::set<int>>& binderInfo, std::set<int>& pids, int pid, int layer) const;
     std::set<int> GetBinderPeerPids(std::string& stack, int pid) const;
     void FindStackByPid(std::string& ret, int pid, const std::string& msg) const;
@@ -20,7 +20,9 @@
 #include <sys/types.h>
 #include <sys/syscall.h>
 #include <sys/stat.h>
+#include <charconv>
 #include <fstream>
+#include <string_view>
 
 #include "faultloggerd_client.h"
 #include "file_ex.h"
@@ -54,6 +56,72 @@ constexpr int FREEZE_TIME_LIMIT = 60000;
 static constexpr int64_t NANOSECONDS = 1000000000;  // NANOSECONDS mean 10^9 nano second
 static constexpr int64_t MICROSECONDS = 1000000;    // MICROSECONDS mean 10^6 millias second
 const std::string LOG_FILE_PATH = "data/log/eventlog";
+constexpr size_t BINDER_READ_CHUNK_SIZE = 64 * 1024;
+constexpr size_t BINDER_VALID_FIELD_NUM = 7;
+constexpr size_t BINDER_CLIENT_FIELD = 0;
+constexpr size_t BINDER_SERVER_FIELD = 2;
+constexpr size_t BINDER_WAIT_FIELD = 5;
+constexpr std::string_view BINDER_SPACE_CHARS = " \t\r\v\f";
+
+// the index-th non-empty part of str split by ':'.
+std::string_view GetBinderSubField(std::string_view str, size_t index)
+{
+    size_t pos = 0;
+    while (pos < str.size()) {
+        size_t end = str.find(':', pos);
+        if (end == std::string_view::npos) {
+            end = str.size();
+        }
+        if (end > pos) {
+            if (index == 0) {
+                return str.substr(pos, end - pos);
+            }
+            index--;
+        }
+        pos = end + 1;
+    }
+    return {};
+}
+
+int BinderFieldToInt(std::string_view field)
+{
+    int value = 0;
+    std::from_chars(field.data(), field.data() + field.size(), value);
+    return value;
+}
+
+void ParseBinderLine(std::string_view line, std::map<int, std::set<int>>& binderInfo, bool& isBinderMatchup)
+{
+    if (isBinderMatchup || line.find("async") != std::string_view::npos) {
+        return;
+    }
+
+    std::string_view fields[BINDER_VALID_FIELD_NUM];
+    size_t fieldNum = 0;
+    size_t pos = line.find_first_not_of(BINDER_SPACE_CHARS);
+    while (pos != std::string_view::npos && fieldNum < BINDER_VALID_FIELD_NUM) {
+        size_t end = line.find_first_of(BINDER_SPACE_CHARS, pos);
+        fields[fieldNum++] = line.substr(pos, end == std::string_view::npos ? end : end - pos);
+        pos = (end == std::string_view::npos) ? end : line.find_first_not_of(BINDER_SPACE_CHARS, end);
+    }
+
+    if (fieldNum >= BINDER_VALID_FIELD_NUM) {
+        std::string_view server = GetBinderSubField(fields[BINDER_SERVER_FIELD], 0);
+        std::string_view client = GetBinderSubField(fields[BINDER_CLIENT_FIELD], 0);
+        std::string_view wait = GetBinderSubField(fields[BINDER_WAIT_FIELD], 1);
+        if (server.empty() || client.empty() || wait.empty()) {
+            return;
+        }
+        int serverNum = BinderFieldToInt(server);
+        int clientNum = BinderFieldToInt(client);
+        TAG_LOGD(AAFwkTag::APPDFR, "server:%{public}d, client:%{public}d, wait:%{public}d", serverNum, clientNum,
+            BinderFieldToInt(wait));
+        binderInfo[clientNum].insert(serverNum);
+    }
+    if (line.find("context") != std::string_view::npos) {
+        isBinderMatchup = true;
+    }
+}
 }
 std::shared_ptr<AppfreezeManager> AppfreezeManager::instance_ = nullptr;
 ffrt::mutex AppfreezeManager::singletonMutex_;
@@ -304,61 +372,32 @@ int AppfreezeManager::NotifyANR(const FaultData& faultData, const AppfreezeManag
     return 0;
 }
 
-std::map<int, std::set<int>> AppfreezeManager::BinderParser(std::ifstream& fin, std::string& stack) const
+std::map<int, std::set<int>> AppfreezeManager::BinderParser(std::istream& fin, std::string& stack) const
 {
     std::map<int, std::set<int>> binderInfo;
-    const int decimal = 10;
-    std::string line;
     bool isBinderMatchup = false;
     TAG_LOGI(AAFwkTag::APPDFR, "start");
     stack += "BinderCatcher --\n\n";
-    while (getline(fin, line)) {
-        stack += line + "\n";
-        if (isBinderMatchup) {
-            continue;
-        }
-
-        if (line.find("async") != std::string::npos) {
-            continue;
-        }
-
-        std::istringstream lineStream(line);
-        std::vector<std::string> strList;
-        std::string tmpstr;
-        while (lineStream >> tmpstr) {
-            strList.push_back(tmpstr);
-        }
-
-        auto SplitPhase = [](const std::string& str, uint16_t index) -> std::string {
-            std::vector<std::string> strings;
-            SplitStr(str, ":", strings);
-            if (index < strings.size()) {
-                return strings[index];
-            }
-            return "";
-        };
-
-        if (strList.size() >= 7) { // 7: valid array size
-            // 2: peer id,
-            std::string server = SplitPhase(strList[2], 0);
-            // 0: local id,
-            std::string client = SplitPhase(strList[0], 0);
-            // 5: wait time, s
-            std::string wait = SplitPhase(strList[5], 1);
-            if (server == "" || client == "" || wait == "") {
-                continue;
-            }
-            int serverNum = std::strtol(server.c_str(), nullptr, decimal);
-            int clientNum = std::strtol(client.c_str(), nullptr, decimal);
-            int waitNum = std::strtol(wait.c_str(), nullptr, decimal);
-            TAG_LOGI(AAFwkTag::APPDFR, "server:%{public}d, client:%{public}d, wait:%{public}d", serverNum, clientNum,
-                waitNum);
-            binderInfo[clientNum].insert(serverNum);
-        }
-        if (line.find("context") != line.npos) {
-            isBinderMatchup = true;
+    // the dump is read in chunks straight into stack, complete lines are parsed in place as they arrive.
+    size_t lineStart = stack.size();
+    while (fin) {
+        size_t oldSize = stack.size();
+        stack.resize(oldSize + BINDER_READ_CHUNK_SIZE);
+        fin.read(&stack[oldSize], BINDER_READ_CHUNK_SIZE);
+        stack.resize(oldSize + static_cast<size_t>(fin.gcount()));
+
+        std::string_view content(stack);
+        size_t lineEnd = content.find('\n', oldSize);
+        while (lineEnd != std::string_view::npos) {
+            ParseBinderLine(content.substr(lineStart, lineEnd - lineStart), binderInfo, isBinderMatchup);
+            lineStart = lineEnd + 1;
+            lineEnd = content.find('\n', lineStart);
         }
     }
+    if (lineStart < stack.size()) {
+        ParseBinderLine(std::string_view(stack).substr(lineStart), binderInfo, isBinderMatchup);
+        stack += "\n";
+    }
     TAG_LOGI(AAFwkTag::APPDFR, "binderInfo size: %{public}zu", binderInfo.size());
     return binderInfo;
 }
@@ -398,16 +437,24 @@ std::set<int> AppfreezeManager::GetBinderPeerPids(std::string& stack, int pid) c
 void AppfreezeManager::ParseBinderPids(const std::map<int, std::set<int>>& binderInfo,
     std::set<int>& pids, int pid, int layer) const
 {
-    auto it = binderInfo.find(pid);
-    layer++;
-    if (layer >= MAX_LAYER) {
-        return;
-    }
-    if (it != binderInfo.end()) {
-        for (auto& each : it->second) {
-            pids.insert(each);
-            ParseBinderPids(binderInfo, pids, each, layer);
+    // breadth first, so that every pid is expanded once on the lowest layer it is reached on.
+    std::set<int> visited = { pid };
+    std::vector<int> currentLayer = { pid };
+    for (layer++; layer < MAX_LAYER && !currentLayer.empty(); layer++) {
+        std::vector<int> nextLayer;
+        for (auto each : currentLayer) {
+            auto it = binderInfo.find(each);
+            if (it == binderInfo.end()) {
+                continue;
+            }
+            for (auto peer : it->second) {
+                pids.insert(peer);
+                if (visited.insert(peer).second) {
+                    nextLayer.push_back(peer);
+                }
+            }
         }
+        currentLayer.swap(nextLayer);
     }
 }
 
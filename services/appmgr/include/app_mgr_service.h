@@ -644,6 +644,10 @@ private:
 
     int DumpFfrt(const std::vector<std::u16string>& args, std::string& result);
 
+    int DumpProcessCache(const std::vector<std::u16string>& args, std::string& result);
+
+    int DumpObserverDelivery(const std::vector<std::u16string>& args, std::string& result);
+
     bool JudgeAppSelfCalled(int32_t recordId);
 
     /**
@@ -1368,7 +1368,16 @@ private:
 
     void KillRenderProcess(const std::shared_ptr<AppRunningRecord> &appRecord);
 
-    void SetOverlayInfo(const std::string& bundleName, const int32_t userId, AppSpawnStartMsg& startMsg);
+    // bundle manager query results a spawn of the bundle depends on, cached per bundle and user.
+    struct SpawnDescriptor {
+        HspList hspList;
+        DataGroupInfoList dataGroupInfoList;
+        std::string overlayInfo;
+    };
+
+    std::string QueryOverlayInfo(const std::string &bundleName, const int32_t userId);
+    int32_t GetSpawnDescriptor(const std::string &bundleName, const int32_t userId, SpawnDescriptor &descriptor);
+    void ClearSpawnDescriptorCache();
     void SetAppEnvInfo(const BundleInfo &bundleInfo, AppSpawnStartMsg& startMsg);
 
     void TimeoutNotifyApp(int32_t pid, int32_t uid, const std::string& bundleName, const FaultData &faultData);
@@ -1525,6 +1534,11 @@ private:
 
     std::mutex loadTaskListMutex_;
     std::vector<LoabAbilityTaskFunc> loadAbilityTaskFuncList_;
+
+    ffrt::mutex spawnDescriptorLock_;
+    // bumped on every bundle event, the result of a query racing with it is not cached.
+    uint64_t spawnDescriptorGeneration_ = 0;
+    std::unordered_map<std::string, SpawnDescriptor> spawnDescriptorCache_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -20,6 +20,8 @@
 #include <mutex>
 #include <regex>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "ability_info.h"
 #include "app_debug_listener_interface.h"
@@ -352,9 +354,30 @@ private:
         std::shared_ptr<AppRunningRecord> appRecord, AppExecFwk::RunningProcessInfo &info) const;
     bool isCollaboratorReserveType(const std::shared_ptr<AppRunningRecord> &appRecord);
 
+    using RecordIndex = std::unordered_map<std::string, std::set<int32_t>>;
+    // The following *Locked functions require runningRecordMapMutex_ to be held by the caller.
+    void AddRecordIndexLocked(int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord);
+    void RemoveRecordIndexLocked(int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord);
+    void ClearRecordIndexLocked();
+    std::vector<std::shared_ptr<AppRunningRecord>> GetRecordsByBundleNameLocked(const std::string &bundleName);
+    std::vector<std::shared_ptr<AppRunningRecord>> GetRecordsByProcessNameLocked(const std::string &processName);
+    std::vector<std::shared_ptr<AppRunningRecord>> GetRecordsByIndexLocked(const RecordIndex &index,
+        const std::string &key);
+    std::shared_ptr<AppRunningRecord> GetCachedRecordLocked(std::unordered_map<uintptr_t, int32_t> &cache,
+        uintptr_t key);
+    void UpdateCachedRecord(std::unordered_map<uintptr_t, int32_t> &cache, uintptr_t key, int32_t recordId);
+
 private:
-    std::mutex runningRecordMapMutex_;
+    // read-mostly, lookups take a shared lock and only record creation and removal take it exclusively
+    std::shared_mutex runningRecordMapMutex_;
     std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> appRunningRecordMap_;
+    // secondary indexes of appRunningRecordMap_ over keys fixed at record creation, every record is in them
+    RecordIndex bundleNameIndex_;
+    RecordIndex processNameIndex_;
+    // pid and ability token change after creation, so they are cached and verified on every hit
+    std::mutex lookupCacheMutex_;
+    std::unordered_map<uintptr_t, int32_t> pidCache_;
+    std::unordered_map<uintptr_t, int32_t> abilityTokenCache_;
 
     std::mutex uiExtensionMapLock_;
     std::map<int32_t, std::pair<pid_t, pid_t>> uiExtensionLauncherMap_;
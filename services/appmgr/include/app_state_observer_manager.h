@@ -16,10 +16,14 @@
 #ifndef OHOS_ABILITY_RUNTIME_APP_STATE_OBSERVER_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_APP_STATE_OBSERVER_MANAGER_H
 
+#include <deque>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ability_foreground_state_observer_interface.h"
 #include "app_foreground_state_observer_interface.h"
@@ -41,6 +45,16 @@ using AppStateObserverMap = std::map<sptr<IApplicationStateObserver>, std::vecto
 using AppForegroundStateObserverSet = std::set<sptr<IAppForegroundStateObserver>>;
 using AbilityforegroundObserverSet = std::set<sptr<IAbilityForegroundStateObserver>>;
 
+struct AppStateObserverDeliveryStats {
+    uint64_t deliveredCount = 0;
+    uint64_t droppedCount = 0;
+    uint64_t coalescedCount = 0;
+    // events queued beyond the cap because nothing pending could be dropped.
+    uint64_t overflowCount = 0;
+    int64_t maxLatencyMs = 0;
+    int64_t totalLatencyMs = 0;
+};
+
 enum class ObserverType {
     APPLICATION_STATE_OBSERVER,
     APP_FOREGROUND_STATE_OBSERVER,
@@ -72,7 +86,25 @@ public:
     void OnPageShow(const PageStateData pageStateData);
     void OnPageHide(const PageStateData pageStateData);
     void OnAppCacheStateChanged(const std::shared_ptr<AppRunningRecord> &appRecord, ApplicationState state);
+    std::map<sptr<IApplicationStateObserver>, AppStateObserverDeliveryStats> GetObserverDeliveryStats();
+    void DumpObserverDelivery(std::string &result);
 private:
+    struct ObserverDeliveryEvent {
+        std::function<void()> notify;
+        // pending events with the same non empty key are coalesced, only the latest one is delivered.
+        std::string coalesceKey;
+        int64_t enqueueTime = 0;
+    };
+    // events of one observer are delivered in order, different observers are delivered in parallel.
+    struct ObserverDeliveryQueue {
+        ffrt::mutex mutex;
+        std::deque<ObserverDeliveryEvent> events;
+        bool isDraining = false;
+        bool isRemoved = false;
+        AppStateObserverDeliveryStats stats;
+    };
+    using AppStateObserverNotify = std::function<void(const sptr<IApplicationStateObserver> &)>;
+
     void HandleAppStateChanged(const std::shared_ptr<AppRunningRecord> &appRecord, const ApplicationState state,
         bool needNotifyApp, bool isFromWindowFocusChanged);
     void HandleOnAppStarted(const std::shared_ptr<AppRunningRecord> &appRecord);
@@ -88,7 +120,14 @@ private:
     bool IsAbilityForegroundObserverExist(const sptr<IRemoteBroker> &observer);
     void AddObserverDeathRecipient(const sptr<IRemoteBroker> &observer, const ObserverType &type);
     void RemoveObserverDeathRecipient(const sptr<IRemoteBroker> &observer);
-    AppStateObserverMap GetAppStateObserverMapCopy();
+    void AddAppStateObserverIndex(const sptr<IApplicationStateObserver> &observer,
+        const std::vector<std::string> &bundleNameList);
+    void RemoveAppStateObserverIndex(const sptr<IApplicationStateObserver> &observer);
+    void NotifyAppStateObservers(const std::string &bundleName, const AppStateObserverNotify &notify,
+        const std::string &coalesceKey = "");
+    void EnqueueObserverEvent(const std::shared_ptr<ObserverDeliveryQueue> &queue, ObserverDeliveryEvent &&event);
+    void SubmitDrainTask(const std::shared_ptr<ObserverDeliveryQueue> &queue);
+    void DrainObserverQueue(const std::shared_ptr<ObserverDeliveryQueue> &queue);
     AppForegroundStateObserverSet GetAppForegroundStateObserverSetCopy();
     AbilityforegroundObserverSet GetAbilityforegroundObserverSetCopy();
     ProcessData WrapProcessData(const std::shared_ptr<AppRunningRecord> &appRecord);
@@ -110,6 +149,11 @@ private:
     ffrt::mutex observerLock_;
     std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>> recipientMap_;
     AppStateObserverMap appStateObserverMap_;
+    // index of appStateObserverMap_, guarded by observerLock_ as well.
+    std::unordered_map<std::string, std::vector<sptr<IApplicationStateObserver>>> bundleObserverIndex_;
+    std::vector<sptr<IApplicationStateObserver>> wildcardObservers_;
+    std::map<sptr<IApplicationStateObserver>, std::shared_ptr<ObserverDeliveryQueue>> observerQueues_;
+    std::shared_ptr<AAFwk::TaskHandlerWrap> deliveryHandler_;
     ffrt::mutex appForegroundObserverLock_;
     AppForegroundStateObserverSet appForegroundStateObserverSet_;
     ffrt::mutex abilityforegroundObserverLock_;
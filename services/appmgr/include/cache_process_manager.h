@@ -16,17 +16,99 @@
 #ifndef OHOS_ABILITY_RUNTIME_CACHE_PROCESS_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_CACHE_PROCESS_MANAGER_H
 
+#include <list>
 #include <memory>
-#include <deque>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "singleton.h"
 #include "app_running_record.h"
 #include "cpp/mutex.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+/**
+ * @class CachedProcessQueue
+ * Cached records from the oldest to the newest, indexed by record so that lookup and removal are O(1).
+ */
+class CachedProcessQueue {
+public:
+    using const_iterator = std::list<std::shared_ptr<AppRunningRecord>>::const_iterator;
+
+    // appends the record, returns false if it is already queued.
+    bool push_back(const std::shared_ptr<AppRunningRecord> &appRecord);
+    // moves a queued record to the newest end, returns false if it is not queued.
+    bool move_to_back(const std::shared_ptr<AppRunningRecord> &appRecord);
+    bool erase(const std::shared_ptr<AppRunningRecord> &appRecord);
+    size_t count(const std::shared_ptr<AppRunningRecord> &appRecord) const;
+    const std::shared_ptr<AppRunningRecord> &front() const;
+    void pop_front();
+    void clear();
+    size_t size() const;
+    bool empty() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    std::list<std::shared_ptr<AppRunningRecord>> records_;
+    std::unordered_map<std::shared_ptr<AppRunningRecord>, const_iterator> index_;
+};
+
+struct ProcessCacheCandidate {
+    std::shared_ptr<AppRunningRecord> appRecord;
+    // resident memory of the process, 0 if it is not sampled.
+    int64_t memoryKb = 0;
+    // times the processes of the bundle were reused from the cache.
+    uint64_t reuseCount = 0;
+};
+
+/**
+ * @class ProcessCacheEvictPolicy
+ * Decides which cached process is killed first when the cache exceeds its count or memory limit.
+ */
+class ProcessCacheEvictPolicy {
+public:
+    virtual ~ProcessCacheEvictPolicy() = default;
+    virtual std::string GetName() const = 0;
+    // whether a cached process goes to the newest end of the queue each time it is used.
+    virtual bool IsReorderedOnUse() const
+    {
+        return false;
+    }
+    // whether the candidates must carry their memory size.
+    virtual bool IsMemoryWeighted() const
+    {
+        return false;
+    }
+    /**
+     * @param candidates the cached processes from the oldest to the newest, not empty.
+     * @return the index of the candidate to evict.
+     */
+    virtual size_t SelectVictim(const std::vector<ProcessCacheCandidate> &candidates) = 0;
+};
+
+class FifoProcessCacheEvictPolicy : public ProcessCacheEvictPolicy {
+public:
+    std::string GetName() const override;
+    size_t SelectVictim(const std::vector<ProcessCacheCandidate> &candidates) override;
+};
+
+class LruProcessCacheEvictPolicy : public FifoProcessCacheEvictPolicy {
+public:
+    std::string GetName() const override;
+    bool IsReorderedOnUse() const override;
+};
+
+// evicts the process holding the most memory per reuse of its bundle, the least recently used one on a tie.
+class CostWeightedProcessCacheEvictPolicy : public ProcessCacheEvictPolicy {
+public:
+    std::string GetName() const override;
+    bool IsReorderedOnUse() const override;
+    bool IsMemoryWeighted() const override;
+    size_t SelectVictim(const std::vector<ProcessCacheCandidate> &candidates) override;
+};
 
 class CacheProcessManager {
     DECLARE_DELAYED_SINGLETON(CacheProcessManager);
@@ -43,6 +125,9 @@ public:
     void RefreshCacheNum();
     std::string PrintCacheQueue();
     void PrepareActivateCache(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void OnProcessCreated(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void SetEvictPolicy(const std::shared_ptr<ProcessCacheEvictPolicy> &evictPolicy);
+    void DumpProcessCache(std::string &result);
 private:
     bool IsAppAbilitiesEmpty(const std::shared_ptr<AppRunningRecord> &appRecord);
     int GetCurrentCachedProcNum();
@@ -54,8 +139,15 @@ private:
     bool CheckAndNotifyCachedState(const std::shared_ptr<AppRunningRecord> &appRecord);
     bool IsAppContainsSrvExt(const std::shared_ptr<AppRunningRecord> &appRecord);
     bool IsAppSupportProcessCacheInnerFirst(const std::shared_ptr<AppRunningRecord> &appRecord);
+    std::vector<ProcessCacheCandidate> GetEvictCandidates(bool isMemoryWeighted);
+    void RecordEvicted(const std::shared_ptr<AppRunningRecord> &appRecord);
+    static std::string GetEvictedKey(const std::string &bundleName, const std::string &processName, int32_t uid);
+    static int64_t GetProcessMemoryKb(const std::shared_ptr<AppRunningRecord> &appRecord);
     int32_t maxProcCacheNum_ = 0;
-    std::deque<std::shared_ptr<AppRunningRecord>> cachedAppRecordQueue_;
+    // total resident memory allowed for cached processes, 0 means no limit.
+    int64_t maxProcCacheMemoryKb_ = 0;
+    CachedProcessQueue cachedAppRecordQueue_;
+    std::shared_ptr<ProcessCacheEvictPolicy> evictPolicy_;
     ffrt::recursive_mutex cacheQueueMtx;
     std::weak_ptr<AppMgrServiceInner> appMgr_;
     bool shouldCheckApi = true;
@@ -67,6 +159,13 @@ private:
     std::set<std::shared_ptr<AppRunningRecord>> srvExtRecords;
     // stores records that has been checked service extension
     std::unordered_set<std::shared_ptr<AppRunningRecord>> srvExtCheckedFlag;
+    // bundleName->times its processes were reused from the cache
+    std::unordered_map<std::string, uint64_t> bundleReuseCounts_;
+    // processes evicted for overload and not started again yet, a later start of one is a cache miss
+    std::unordered_set<std::string> evictedProcesses_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t evictCount_ = 0;
 };
 } // namespace OHOS
 } // namespace AppExecFwk
@@ -37,6 +37,7 @@
 #include "base/security/access_token/interfaces/innerkits/accesstoken/include/accesstoken_kit.h"
 #include "app_mgr_service_const.h"
 #include "app_mgr_service_dump_error_code.h"
+#include "app_state_observer_manager.h"
 #include "cache_process_manager.h"
 
 namespace OHOS {
@@ -44,6 +45,8 @@ namespace AppExecFwk {
 constexpr const char* OPTION_KEY_HELP = "-h";
 constexpr const char* OPTION_KEY_DUMP_IPC = "--ipc";
 constexpr const char* OPTION_KEY_DUMP_FFRT = "--ffrt";
+constexpr const char* OPTION_KEY_DUMP_CACHE = "--cache";
+constexpr const char* OPTION_KEY_DUMP_OBSERVER = "--observer";
 const int32_t HIDUMPER_SERVICE_UID = 1212;
 constexpr const int INDEX_PID = 1;
 constexpr const int INDEX_CMD = 2;
@@ -661,6 +664,12 @@ int AppMgrService::Dump(const std::vector<std::u16string>& args, std::string& re
     if (optionKey == OPTION_KEY_DUMP_FFRT) {
         return DumpFfrt(args, result);
     }
+    if (optionKey == OPTION_KEY_DUMP_CACHE) {
+        return DumpProcessCache(args, result);
+    }
+    if (optionKey == OPTION_KEY_DUMP_OBSERVER) {
+        return DumpObserverDelivery(args, result);
+    }
     result.append("error: unkown option.\n");
     TAG_LOGE(AAFwkTag::APPMGR, "option key %{public}s does not exist", optionKey.c_str());
     return DumpErrorCode::ERR_UNKNOWN_OPTION_ERROR;
@@ -672,7 +681,11 @@ int AppMgrService::ShowHelp(const std::vector<std::u16string>& args, std::string
         .append("-h                          ")
         .append("help text for the tool\n")
         .append("--ffrt pid1[,pid2,pid3]     ")
-        .append("dump ffrt info\n");
+        .append("dump ffrt info\n")
+        .append("--cache                     ")
+        .append("dump process cache info\n")
+        .append("--observer                  ")
+        .append("dump app state observer delivery info\n");
 
     return ERR_OK;
 }
@@ -845,6 +858,34 @@ int AppMgrService::DumpFfrt(const std::vector<std::u16string>& args, std::string
     return DumpFfrtInner(pidsRaw, result);
 }
 
+int AppMgrService::DumpProcessCache(const std::vector<std::u16string>& args, std::string& result)
+{
+    TAG_LOGD(AAFwkTag::APPMGR, "called");
+    auto isHidumperServiceCall = (IPCSkeleton::GetCallingUid() == HIDUMPER_SERVICE_UID);
+    if (!isHidumperServiceCall) {
+        result.append(MSG_DUMP_FAIL, strlen(MSG_DUMP_FAIL))
+            .append(MSG_DUMP_FAIL_REASON_PERMISSION_DENY, strlen(MSG_DUMP_FAIL_REASON_PERMISSION_DENY));
+        TAG_LOGE(AAFwkTag::APPMGR, "Permission deny.");
+        return DumpErrorCode::ERR_PERMISSION_DENY_ERROR;
+    }
+    DelayedSingleton<CacheProcessManager>::GetInstance()->DumpProcessCache(result);
+    return ERR_OK;
+}
+
+int AppMgrService::DumpObserverDelivery(const std::vector<std::u16string>& args, std::string& result)
+{
+    TAG_LOGD(AAFwkTag::APPMGR, "called");
+    auto isHidumperServiceCall = (IPCSkeleton::GetCallingUid() == HIDUMPER_SERVICE_UID);
+    if (!isHidumperServiceCall) {
+        result.append(MSG_DUMP_FAIL, strlen(MSG_DUMP_FAIL))
+            .append(MSG_DUMP_FAIL_REASON_PERMISSION_DENY, strlen(MSG_DUMP_FAIL_REASON_PERMISSION_DENY));
+        TAG_LOGE(AAFwkTag::APPMGR, "Permission deny.");
+        return DumpErrorCode::ERR_PERMISSION_DENY_ERROR;
+    }
+    DelayedSingleton<AppStateObserverManager>::GetInstance()->DumpObserverDelivery(result);
+    return ERR_OK;
+}
+
 int AppMgrService::DumpIpcAllStart(std::string& result)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
@@ -243,6 +243,7 @@ constexpr int32_t NO_ABILITY_RECORD_ID = -1;
 constexpr int32_t EXIT_REASON_UNKNOWN = 0;
 
 constexpr int32_t MAX_SPECIFIED_PROCESS_NAME_LENGTH = 255;
+constexpr size_t SPAWN_DESCRIPTOR_CACHE_MAX_SIZE = 128;
 
 int32_t GetUserIdByUid(int32_t uid)
 {
@@ -1158,6 +1159,8 @@ int32_t AppMgrServiceInner::UpdateApplicationInfoInstalled(const std::string &bu
         TAG_LOGE(AAFwkTag::APPMGR, "The bundleMgrHelper is nullptr.");
         return ERR_NO_INIT;
     }
+    // shared bundles, data groups and overlays of other bundles may depend on this one.
+    ClearSpawnDescriptorCache();
     auto userId = GetUserIdByUid(uid);
     ApplicationInfo appInfo;
     HITRACE_METER_NAME(HITRACE_TAG_APP, "BMS->GetApplicationInfo");
@@ -2637,18 +2640,17 @@ int32_t AppMgrServiceInner::StartPerfProcess(const std::shared_ptr<AppRunningRec
     return StartPerfProcessByStartMsg(startMsg, perfCmd, debugCmd, isSandboxApp);
 }
 
-void AppMgrServiceInner::SetOverlayInfo(const std::string &bundleName,
-                                        const int32_t userId,
-                                        AppSpawnStartMsg &startMsg)
+std::string AppMgrServiceInner::QueryOverlayInfo(const std::string &bundleName, const int32_t userId)
 {
+    std::string overlayInfoPaths;
     if (remoteClientManager_ == nullptr) {
         TAG_LOGE(AAFwkTag::APPMGR, "The remoteClientManager_ is nullptr.");
-        return;
+        return overlayInfoPaths;
     }
     auto bundleMgrHelper = remoteClientManager_->GetBundleManagerHelper();
     if (bundleMgrHelper == nullptr) {
         TAG_LOGE(AAFwkTag::APPMGR, "The bundleMgrHelper is nullptr.");
-        return;
+        return overlayInfoPaths;
     }
     auto overlayMgrProxy = bundleMgrHelper->GetOverlayManagerProxy();
     if (overlayMgrProxy !=  nullptr) {
@@ -2658,15 +2660,74 @@ void AppMgrServiceInner::SetOverlayInfo(const std::string &bundleName,
         auto targetRet = IN_PROCESS_CALL(overlayMgrProxy->GetOverlayModuleInfoForTarget(
             bundleName, "", overlayModuleInfo, userId));
         if (targetRet == ERR_OK && overlayModuleInfo.size() != 0) {
-            TAG_LOGD(AAFwkTag::APPMGR, "Start an overlay app process.");
-            startMsg.flags = startMsg.flags | APP_OVERLAY_FLAG;
-            std::string overlayInfoPaths;
             for (auto it : overlayModuleInfo) {
                 overlayInfoPaths += (it.hapPath + "|");
             }
-            startMsg.overlayInfo = overlayInfoPaths;
         }
     }
+    return overlayInfoPaths;
+}
+
+int32_t AppMgrServiceInner::GetSpawnDescriptor(const std::string &bundleName, const int32_t userId,
+    SpawnDescriptor &descriptor)
+{
+    std::string key = bundleName + ":" + std::to_string(userId);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(spawnDescriptorLock_);
+        auto iter = spawnDescriptorCache_.find(key);
+        if (iter != spawnDescriptorCache_.end()) {
+            descriptor = iter->second;
+            return ERR_OK;
+        }
+        generation = spawnDescriptorGeneration_;
+    }
+
+    if (remoteClientManager_ == nullptr) {
+        TAG_LOGE(AAFwkTag::APPMGR, "remoteClientManager_ is nullptr.");
+        return ERR_NO_INIT;
+    }
+    auto bundleMgrHelper = remoteClientManager_->GetBundleManagerHelper();
+    if (!bundleMgrHelper) {
+        TAG_LOGE(AAFwkTag::APPMGR, "Get bundle manager helper failed.");
+        return ERR_NO_INIT;
+    }
+    // the queries are independent, the data group and overlay ones run beside the shared bundle one.
+    auto ffrtHandler = AAFwk::TaskHandlerWrap::GetFfrtHandler();
+    AAFwk::AutoSyncTaskHandle dataGroupSync(ffrtHandler->SubmitTask([&]() {
+        bool result = bundleMgrHelper->QueryDataGroupInfos(bundleName, userId, descriptor.dataGroupInfoList);
+        if (!result || descriptor.dataGroupInfoList.empty()) {
+            TAG_LOGD(AAFwkTag::APPMGR, "the bundle has no groupInfos.");
+        }
+    }));
+    AAFwk::AutoSyncTaskHandle overlaySync(ffrtHandler->SubmitTask([&]() {
+        descriptor.overlayInfo = QueryOverlayInfo(bundleName, userId);
+    }));
+    auto ret = bundleMgrHelper->GetBaseSharedBundleInfos(bundleName, descriptor.hspList,
+        AppExecFwk::GetDependentBundleInfoFlag::GET_ALL_DEPENDENT_BUNDLE_INFO);
+    dataGroupSync.Sync();
+    overlaySync.Sync();
+    if (ret != ERR_OK) {
+        TAG_LOGE(AAFwkTag::APPMGR, "GetBaseSharedBundleInfos failed: %{public}d.", ret);
+        return ret;
+    }
+
+    std::lock_guard<ffrt::mutex> lock(spawnDescriptorLock_);
+    if (generation != spawnDescriptorGeneration_) {
+        return ERR_OK;
+    }
+    if (spawnDescriptorCache_.size() >= SPAWN_DESCRIPTOR_CACHE_MAX_SIZE) {
+        spawnDescriptorCache_.clear();
+    }
+    spawnDescriptorCache_[key] = descriptor;
+    return ERR_OK;
+}
+
+void AppMgrServiceInner::ClearSpawnDescriptorCache()
+{
+    std::lock_guard<ffrt::mutex> lock(spawnDescriptorLock_);
+    spawnDescriptorGeneration_++;
+    spawnDescriptorCache_.clear();
 }
 
 void AppMgrServiceInner::SetAppEnvInfo(const BundleInfo &bundleInfo, AppSpawnStartMsg& startMsg)
@@ -2837,26 +2898,21 @@ int32_t AppMgrServiceInner::CreateStartMsg(const std::string &processName, uint3
         return ERR_NO_INIT;
     }
 
+    HITRACE_METER_NAME(HITRACE_TAG_APP, __PRETTY_FUNCTION__);
+    int64_t startTime = AbilityRuntime::TimeUtil::SystemTimeMillisecond();
     AAFwk::AutoSyncTaskHandle autoSync(otherTaskHandler_->SubmitTask([&]() {
         AddMountPermission(bundleInfo.applicationInfo.accessTokenId, startMsg.permissions);
     }));
 
-    HspList hspList;
-    auto ret = bundleMgrHelper->GetBaseSharedBundleInfos(bundleInfo.name, hspList,
-        AppExecFwk::GetDependentBundleInfoFlag::GET_ALL_DEPENDENT_BUNDLE_INFO);
+    auto userId = GetUserIdByUid(uid);
+    SpawnDescriptor descriptor;
+    auto ret = GetSpawnDescriptor(bundleInfo.name, userId, descriptor);
     if (ret != ERR_OK) {
-        TAG_LOGE(AAFwkTag::APPMGR, "GetBaseSharedBundleInfos failed: %{public}d.", ret);
         return ret;
     }
-    startMsg.hspList = hspList;
-
-    auto userId = GetUserIdByUid(uid);
-    DataGroupInfoList dataGroupInfoList;
-    bool result = bundleMgrHelper->QueryDataGroupInfos(bundleInfo.name, userId, dataGroupInfoList);
-    if (!result || dataGroupInfoList.empty()) {
-        TAG_LOGD(AAFwkTag::APPMGR, "the bundle has no groupInfos.");
-    }
-    QueryExtensionSandBox(moduleName, abilityName, bundleInfo, startMsg, dataGroupInfoList, strictMode, want);
+    startMsg.hspList = std::move(descriptor.hspList);
+    QueryExtensionSandBox(moduleName, abilityName, bundleInfo, startMsg, descriptor.dataGroupInfoList, strictMode,
+        want);
     startMsg.bundleName = bundleInfo.name;
     startMsg.renderParam = RENDER_PARAM;
     startMsg.flags = startFlags;
@@ -2864,13 +2920,17 @@ int32_t AppMgrServiceInner::CreateStartMsg(const std::string &processName, uint3
     startMsg.procName = processName;
 
     SetAtomicServiceInfo(bundleType, startMsg);
-    SetOverlayInfo(bundleInfo.name, userId, startMsg);
+    if (!descriptor.overlayInfo.empty()) {
+        TAG_LOGD(AAFwkTag::APPMGR, "Start an overlay app process.");
+        startMsg.flags = startMsg.flags | APP_OVERLAY_FLAG;
+        startMsg.overlayInfo = descriptor.overlayInfo;
+    }
     SetAppInfo(bundleInfo, startMsg);
 
-    TAG_LOGI(AAFwkTag::APPMGR, "apl is %{public}s, bundleName is %{public}s, startFlags is %{public}d",
-        startMsg.apl.c_str(), bundleInfo.name.c_str(), startFlags);
-
     autoSync.Sync();
+    TAG_LOGI(AAFwkTag::APPMGR, "apl is %{public}s, bundleName is %{public}s, startFlags is %{public}d, "
+        "cost: %{public}" PRId64 "ms", startMsg.apl.c_str(), bundleInfo.name.c_str(), startFlags,
+        AbilityRuntime::TimeUtil::SystemTimeMillisecond() - startTime);
     return ERR_OK;
 }
 
@@ -94,9 +94,12 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CreateAppRunningRecord(
     appRecord->SetSingleton(bundleInfo.singleton);
     appRecord->SetSignCode(signCode);
     appRecord->SetJointUserId(bundleInfo.jointUserId);
+    DelayedSingleton<CacheProcessManager>::GetInstance()->OnProcessCreated(appRecord);
     {
         std::lock_guard guard(runningRecordMapMutex_);
-        appRunningRecordMap_.emplace(recordId, appRecord);
+        if (appRunningRecordMap_.emplace(recordId, appRecord).second) {
+            AddRecordIndexLocked(recordId, appRecord);
+        }
     }
     {
         std::lock_guard guard(updateConfigurationDelayedLock_);
@@ -119,21 +122,24 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
     TAG_LOGD(AAFwkTag::APPMGR, "jointUserId : %{public}s", jointUserId.c_str());
     ClipStringContent(rule, bundleInfo.appId, signCode);
 
-    auto FindSameProcess = [signCode, specifiedProcessFlag, processName, jointUserId](const auto &pair) {
-        return (pair.second != nullptr) &&
-            (specifiedProcessFlag.empty() || pair.second->GetSpecifiedProcessFlag() == specifiedProcessFlag) &&
-            (pair.second->GetSignCode() == signCode) && (pair.second->GetProcessName() == processName) &&
-            (pair.second->GetJointUserId() == jointUserId) && !(pair.second->IsTerminating()) &&
-            !(pair.second->IsKilling()) && !(pair.second->GetRestartAppFlag());
+    auto FindSameProcess = [signCode, specifiedProcessFlag, processName, jointUserId](const auto &appRecord) {
+        return (appRecord != nullptr) &&
+            (specifiedProcessFlag.empty() || appRecord->GetSpecifiedProcessFlag() == specifiedProcessFlag) &&
+            (appRecord->GetSignCode() == signCode) && (appRecord->GetProcessName() == processName) &&
+            (appRecord->GetJointUserId() == jointUserId) && !(appRecord->IsTerminating()) &&
+            !(appRecord->IsKilling()) && !(appRecord->GetRestartAppFlag());
     };
 
-    auto appRunningMap = GetAppRunningRecordMap();
+    std::vector<std::shared_ptr<AppRunningRecord>> sameProcessRecords;
+    {
+        std::shared_lock guard(runningRecordMapMutex_);
+        sameProcessRecords = GetRecordsByProcessNameLocked(processName);
+    }
     if (!jointUserId.empty()) {
-        auto iter = std::find_if(appRunningMap.begin(), appRunningMap.end(), FindSameProcess);
-        return ((iter == appRunningMap.end()) ? nullptr : iter->second);
+        auto iter = std::find_if(sameProcessRecords.begin(), sameProcessRecords.end(), FindSameProcess);
+        return ((iter == sameProcessRecords.end()) ? nullptr : *iter);
     }
-    for (const auto &item : appRunningMap) {
-        const auto &appRecord = item.second;
+    for (const auto &appRecord : sameProcessRecords) {
         if (appRecord && appRecord->GetProcessName() == processName &&
             (specifiedProcessFlag.empty() || appRecord->GetSpecifiedProcessFlag() == specifiedProcessFlag) &&
             !(appRecord->IsTerminating()) && !(appRecord->IsKilling()) && !(appRecord->GetRestartAppFlag()) &&
@@ -164,18 +170,11 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
 #ifdef APP_NO_RESPONSE_DIALOG
 bool AppRunningManager::CheckAppRunningRecordIsExist(const std::string &bundleName, const std::string &ablityName)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     if (appRunningRecordMap_.empty()) {
         return false;
     }
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (!appRecord) {
-            continue;
-        }
-        if (appRecord->GetBundleName() != bundleName) {
-            continue;
-        }
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
         const auto &abilityRunningRecordMap = appRecord->GetAbilities();
         for (const auto &abilityItem : abilityRunningRecordMap) {
             const auto &abilityRunning = abilityItem.second;
@@ -190,13 +189,12 @@ bool AppRunningManager::CheckAppRunningRecordIsExist(const std::string &bundleNa
 
 bool AppRunningManager::CheckAppRunningRecordIsExistByBundleName(const std::string &bundleName)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     if (appRunningRecordMap_.empty()) {
         return false;
     }
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetBundleName() == bundleName && !(appRecord->GetRestartAppFlag())) {
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
+        if (!(appRecord->GetRestartAppFlag())) {
             return true;
         }
     }
@@ -205,7 +203,7 @@ bool AppRunningManager::CheckAppRunningRecordIsExistByBundleName(const std::stri
 
 bool AppRunningManager::CheckAppRunningRecordIsExistByUid(int32_t uid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     if (appRunningRecordMap_.empty()) {
         return false;
     }
@@ -221,11 +219,9 @@ bool AppRunningManager::CheckAppRunningRecordIsExistByUid(int32_t uid)
 int32_t AppRunningManager::CheckAppCloneRunningRecordIsExistByBundleName(const std::string &bundleName,
     int32_t appCloneIndex, bool &isRunning)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetBundleName() == bundleName && !(appRecord->GetRestartAppFlag()) &&
-            appRecord->GetAppIndex() == appCloneIndex) {
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
+        if (!(appRecord->GetRestartAppFlag()) && appRecord->GetAppIndex() == appCloneIndex) {
             isRunning = true;
             break;
         }
@@ -235,35 +231,42 @@ int32_t AppRunningManager::CheckAppCloneRunningRecordIsExistByBundleName(const s
 
 int32_t AppRunningManager::GetAllAppRunningRecordCountByBundleName(const std::string &bundleName)
 {
-    int32_t count = 0;
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetBundleName() == bundleName) {
-            count++;
-        }
-    }
-
-    return count;
+    std::shared_lock guard(runningRecordMapMutex_);
+    return static_cast<int32_t>(GetRecordsByBundleNameLocked(bundleName).size());
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByPid(const pid_t pid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
+    auto cacheKey = static_cast<uintptr_t>(pid);
+    auto appRecord = GetCachedRecordLocked(pidCache_, cacheKey);
+    if (appRecord != nullptr && appRecord->GetPriorityObject()->GetPid() == pid) {
+        return appRecord;
+    }
     auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
         return pair.second->GetPriorityObject()->GetPid() == pid;
     });
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    if (iter == appRunningRecordMap_.end()) {
+        return nullptr;
+    }
+    UpdateCachedRecord(pidCache_, cacheKey, iter->first);
+    return iter->second;
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByAbilityToken(
     const sptr<IRemoteObject> &abilityToken)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
+    auto cacheKey = reinterpret_cast<uintptr_t>(abilityToken.GetRefPtr());
+    auto cachedRecord = GetCachedRecordLocked(abilityTokenCache_, cacheKey);
+    if (cachedRecord != nullptr && cachedRecord->GetAbilityRunningRecordByToken(abilityToken)) {
+        return cachedRecord;
+    }
     for (const auto &item : appRunningRecordMap_) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetAbilityRunningRecordByToken(abilityToken)) {
+            UpdateCachedRecord(abilityTokenCache_, cacheKey, item.first);
             return appRecord;
         }
     }
@@ -425,6 +428,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
             return nullptr;
         }
         appRecord = iter->second;
+        RemoveRecordIndexLocked(iter->first, appRecord);
         appRunningRecordMap_.erase(iter);
     }
     if (appRecord != nullptr) {
@@ -452,7 +456,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
 
 std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> AppRunningManager::GetAppRunningRecordMap()
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     return appRunningRecordMap_;
 }
 
@@ -464,6 +468,7 @@ void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
         auto it = appRunningRecordMap_.find(recordId);
         if (it != appRunningRecordMap_.end()) {
             appRecord = it->second;
+            RemoveRecordIndexLocked(recordId, appRecord);
             appRunningRecordMap_.erase(it);
         }
     }
@@ -481,6 +486,7 @@ void AppRunningManager::ClearAppRunningRecordMap()
 {
     std::lock_guard guard(runningRecordMapMutex_);
     appRunningRecordMap_.clear();
+    ClearRecordIndexLocked();
 }
 
 void AppRunningManager::HandleTerminateTimeOut(int64_t eventId)
@@ -503,7 +509,7 @@ void AppRunningManager::HandleTerminateTimeOut(int64_t eventId)
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetTerminatingAppRunningRecord(
     const sptr<IRemoteObject> &abilityToken)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     for (const auto &item : appRunningRecordMap_) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetAbilityByTerminateLists(abilityToken)) {
@@ -516,7 +522,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::GetTerminatingAppRunningRec
 std::shared_ptr<AbilityRunningRecord> AppRunningManager::GetAbilityRunningRecord(const int64_t eventId)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     for (auto &item : appRunningRecordMap_) {
         if (item.second) {
             auto abilityRecord = item.second->GetAbilityRunningRecord(eventId);
@@ -531,7 +537,7 @@ std::shared_ptr<AbilityRunningRecord> AppRunningManager::GetAbilityRunningRecord
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecord(const int64_t eventId)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&eventId](const auto &pair) {
         return pair.second->GetEventId() == eventId;
     });
@@ -744,7 +750,7 @@ void AppRunningManager::ClipStringContent(const std::regex &re, const std::strin
 
 void AppRunningManager::GetForegroundApplications(std::vector<AppStateData> &list)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     for (const auto &item : appRunningRecordMap_) {
         const auto &appRecord = item.second;
         if (!appRecord) {
@@ -892,7 +898,7 @@ int32_t AppRunningManager::DumpHeapMemory(const int32_t pid, OHOS::AppExecFwk::M
 {
     std::shared_ptr<AppRunningRecord> appRecord;
     {
-        std::lock_guard guard(runningRecordMapMutex_);
+        std::shared_lock guard(runningRecordMapMutex_);
         TAG_LOGI(AAFwkTag::APPMGR, "current app size %{public}zu", appRunningRecordMap_.size());
         auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
             auto priorityObject = pair.second->GetPriorityObject();
@@ -926,7 +932,7 @@ int32_t AppRunningManager::DumpJsHeapMemory(OHOS::AppExecFwk::JsHeapDumpInfo &in
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByRenderPid(const pid_t pid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
         auto renderRecordMap = pair.second->GetRenderRecordMap();
         if (renderRecordMap.empty()) {
@@ -994,19 +1000,18 @@ bool AppRunningManager::GetAppRunningStateByBundleName(const std::string &bundle
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetBundleName() == bundleName) {
-            TAG_LOGD(AAFwkTag::APPMGR, "Process of [%{public}s] is running, processName: %{public}s.",
-                bundleName.c_str(), appRecord->GetProcessName().c_str());
-            if (IPCSkeleton::GetCallingUid() == QUICKFIX_UID && appRecord->GetPriorityObject() != nullptr) {
-                TAG_LOGI(AAFwkTag::APPMGR, "pid: %{public}d.", appRecord->GetPriorityObject()->GetPid());
-            }
-            return true;
-        }
+    std::shared_lock guard(runningRecordMapMutex_);
+    auto appRecords = GetRecordsByBundleNameLocked(bundleName);
+    if (appRecords.empty()) {
+        return false;
     }
-    return false;
+    const auto &appRecord = appRecords.front();
+    TAG_LOGD(AAFwkTag::APPMGR, "Process of [%{public}s] is running, processName: %{public}s.",
+        bundleName.c_str(), appRecord->GetProcessName().c_str());
+    if (IPCSkeleton::GetCallingUid() == QUICKFIX_UID && appRecord->GetPriorityObject() != nullptr) {
+        TAG_LOGI(AAFwkTag::APPMGR, "pid: %{public}d.", appRecord->GetPriorityObject()->GetPid());
+    }
+    return true;
 }
 
 int32_t AppRunningManager::NotifyLoadRepairPatch(const std::string &bundleName, const sptr<IQuickFixCallback> &callback)
@@ -1111,11 +1116,9 @@ bool AppRunningManager::IsApplicationFirstForeground(const AppRunningRecord &for
         return false;
     }
 
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr || appRecord->GetBundleName() != foregroundingRecord.GetBundleName()
-            || AAFwk::UIExtensionUtils::IsUIExtension(appRecord->GetExtensionType())
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(foregroundingRecord.GetBundleName())) {
+        if (AAFwk::UIExtensionUtils::IsUIExtension(appRecord->GetExtensionType())
             || AAFwk::UIExtensionUtils::IsWindowExtension(appRecord->GetExtensionType())) {
             continue;
         }
@@ -1131,7 +1134,7 @@ bool AppRunningManager::IsApplicationFirstForeground(const AppRunningRecord &for
 bool AppRunningManager::IsApplicationBackground(const std::string &bundleName)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     for (const auto &item : appRunningRecordMap_) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
@@ -1178,12 +1181,8 @@ void AppRunningManager::OnWindowVisibilityChanged(
 bool AppRunningManager::IsApplicationFirstFocused(const AppRunningRecord &focusedRecord)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr || appRecord->GetBundleName() != focusedRecord.GetBundleName()) {
-            continue;
-        }
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(focusedRecord.GetBundleName())) {
         if (appRecord->GetFocusFlag() && appRecord->GetRecordId() != focusedRecord.GetRecordId()) {
             return false;
         }
@@ -1194,10 +1193,9 @@ bool AppRunningManager::IsApplicationFirstFocused(const AppRunningRecord &focuse
 bool AppRunningManager::IsApplicationUnfocused(const std::string &bundleName)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "check is application unfocused.");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetBundleName() == bundleName && appRecord->GetFocusFlag()) {
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
+        if (appRecord->GetFocusFlag()) {
             return false;
         }
     }
@@ -1207,16 +1205,14 @@ bool AppRunningManager::IsApplicationUnfocused(const std::string &bundleName)
 void AppRunningManager::SetAttachAppDebug(const std::string &bundleName, const bool &isAttachDebug)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr) {
-            continue;
-        }
-        if (appRecord->GetBundleName() == bundleName) {
-            TAG_LOGD(AAFwkTag::APPMGR, "The application: %{public}s will be set debug mode.", bundleName.c_str());
-            appRecord->SetAttachDebug(isAttachDebug);
-        }
+    std::vector<std::shared_ptr<AppRunningRecord>> appRecords;
+    {
+        std::shared_lock guard(runningRecordMapMutex_);
+        appRecords = GetRecordsByBundleNameLocked(bundleName);
+    }
+    for (const auto &appRecord : appRecords) {
+        TAG_LOGD(AAFwkTag::APPMGR, "The application: %{public}s will be set debug mode.", bundleName.c_str());
+        appRecord->SetAttachDebug(isAttachDebug);
     }
 }
 
@@ -1224,12 +1220,10 @@ std::vector<AppDebugInfo> AppRunningManager::GetAppDebugInfosByBundleName(
     const std::string &bundleName, const bool &isDetachDebug)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     std::vector<AppDebugInfo> debugInfos;
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr || appRecord->GetBundleName() != bundleName ||
-            (isDetachDebug && (appRecord->IsDebugApp() || appRecord->IsAssertionPause()))) {
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
+        if (isDetachDebug && (appRecord->IsDebugApp() || appRecord->IsAssertionPause())) {
             continue;
         }
 
@@ -1250,13 +1244,8 @@ void AppRunningManager::GetAbilityTokensByBundleName(
     const std::string &bundleName, std::vector<sptr<IRemoteObject>> &abilityTokens)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr || appRecord->GetBundleName() != bundleName) {
-            continue;
-        }
-
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : GetRecordsByBundleNameLocked(bundleName)) {
         for (const auto &token : appRecord->GetAbilities()) {
             abilityTokens.emplace_back(token.first);
         }
@@ -1265,7 +1254,7 @@ void AppRunningManager::GetAbilityTokensByBundleName(
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByChildProcessPid(const pid_t pid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
         auto childProcessRecordMap = pair.second->GetChildProcessRecordMap();
         return childProcessRecordMap.find(pid) != childProcessRecordMap.end();
@@ -1327,13 +1316,10 @@ int32_t AppRunningManager::SignRestartAppFlag(const std::string &bundleName)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
     std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord == nullptr || appRecord->GetBundleName() != bundleName) {
-            continue;
-        }
+    auto appRecords = GetRecordsByBundleNameLocked(bundleName);
+    if (!appRecords.empty()) {
         TAG_LOGD(AAFwkTag::APPMGR, "sign");
-        appRecord->SetRestartAppFlag(true);
+        appRecords.front()->SetRestartAppFlag(true);
         return ERR_OK;
     }
     TAG_LOGE(AAFwkTag::APPMGR, "Not find apprecord.");
@@ -1587,13 +1573,9 @@ bool AppRunningManager::IsAppProcessesAllCached(const std::string &bundleName, i
         TAG_LOGI(AAFwkTag::APPMGR, "empty cache set.");
         return false;
     }
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        auto &itemRecord = item.second;
-        if (itemRecord == nullptr) {
-            continue;
-        }
-        if (itemRecord->GetBundleName() == bundleName && itemRecord->GetUid() == uid) {
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &itemRecord : GetRecordsByBundleNameLocked(bundleName)) {
+        if (itemRecord->GetUid() == uid) {
             auto supportCache =
                 DelayedSingleton<CacheProcessManager>::GetInstance()->IsAppSupportProcessCache(itemRecord);
             // need wait for unsupported processes
@@ -1616,5 +1598,102 @@ int32_t AppRunningManager::UpdateConfigurationDelayed(const std::shared_ptr<AppR
     }
     return result;
 }
+
+void AppRunningManager::AddRecordIndexLocked(int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRecord == nullptr) {
+        return;
+    }
+    bundleNameIndex_[appRecord->GetBundleName()].insert(recordId);
+    processNameIndex_[appRecord->GetProcessName()].insert(recordId);
+}
+
+void AppRunningManager::RemoveRecordIndexLocked(int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRecord != nullptr) {
+        auto eraseFromIndex = [recordId](RecordIndex &index, const std::string &key) {
+            auto iter = index.find(key);
+            if (iter == index.end()) {
+                return;
+            }
+            iter->second.erase(recordId);
+            if (iter->second.empty()) {
+                index.erase(iter);
+            }
+        };
+        eraseFromIndex(bundleNameIndex_, appRecord->GetBundleName());
+        eraseFromIndex(processNameIndex_, appRecord->GetProcessName());
+    }
+
+    std::lock_guard guard(lookupCacheMutex_);
+    for (auto cache : { &pidCache_, &abilityTokenCache_ }) {
+        for (auto iter = cache->begin(); iter != cache->end();) {
+            iter = (iter->second == recordId) ? cache->erase(iter) : std::next(iter);
+        }
+    }
+}
+
+void AppRunningManager::ClearRecordIndexLocked()
+{
+    bundleNameIndex_.clear();
+    processNameIndex_.clear();
+    std::lock_guard guard(lookupCacheMutex_);
+    pidCache_.clear();
+    abilityTokenCache_.clear();
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetRecordsByBundleNameLocked(
+    const std::string &bundleName)
+{
+    return GetRecordsByIndexLocked(bundleNameIndex_, bundleName);
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetRecordsByProcessNameLocked(
+    const std::string &processName)
+{
+    return GetRecordsByIndexLocked(processNameIndex_, processName);
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetRecordsByIndexLocked(const RecordIndex &index,
+    const std::string &key)
+{
+    // results are in record id order, the same order a scan of appRunningRecordMap_ yields
+    std::vector<std::shared_ptr<AppRunningRecord>> appRecords;
+    auto indexIter = index.find(key);
+    if (indexIter == index.end()) {
+        return appRecords;
+    }
+    appRecords.reserve(indexIter->second.size());
+    for (auto recordId : indexIter->second) {
+        auto iter = appRunningRecordMap_.find(recordId);
+        if (iter != appRunningRecordMap_.end() && iter->second != nullptr) {
+            appRecords.emplace_back(iter->second);
+        }
+    }
+    return appRecords;
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManager::GetCachedRecordLocked(
+    std::unordered_map<uintptr_t, int32_t> &cache, uintptr_t key)
+{
+    int32_t recordId = 0;
+    {
+        std::lock_guard guard(lookupCacheMutex_);
+        auto cacheIter = cache.find(key);
+        if (cacheIter == cache.end()) {
+            return nullptr;
+        }
+        recordId = cacheIter->second;
+    }
+    auto iter = appRunningRecordMap_.find(recordId);
+    return (iter == appRunningRecordMap_.end()) ? nullptr : iter->second;
+}
+
+void AppRunningManager::UpdateCachedRecord(std::unordered_map<uintptr_t, int32_t> &cache, uintptr_t key,
+    int32_t recordId)
+{
+    std::lock_guard guard(lookupCacheMutex_);
+    cache[key] = recordId;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
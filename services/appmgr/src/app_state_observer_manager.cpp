@@ -15,6 +15,11 @@
 
 #include "app_state_observer_manager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <sstream>
+
 #include "ability_foreground_state_observer_stub.h"
 #include "app_foreground_state_observer_stub.h"
 #include "application_state_observer_stub.h"
@@ -32,6 +37,17 @@ const std::string THREAD_NAME = "AppStateObserverManager";
 const std::string XIAOYI_BUNDLE_NAME = "com.huawei.hmos.vassistant";
 const int BUNDLE_NAME_LIST_MAX_SIZE = 128;
 constexpr char DEVELOPER_MODE_STATE[] = "const.security.developermode.state";
+constexpr size_t OBSERVER_QUEUE_MAX_SIZE = 256;
+constexpr int32_t OBSERVER_DRAIN_BATCH_SIZE = 32;
+constexpr int64_t SLOW_DELIVERY_MILLIS = 1000;
+constexpr uint64_t DROP_LOG_INTERVAL = 100;
+const std::string PROCESS_STATE_COALESCE_KEY = "processState:";
+
+int64_t GetSteadyTimeMillis()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
 } // namespace
 AppStateObserverManager::AppStateObserverManager()
 {
@@ -48,6 +64,9 @@ void AppStateObserverManager::Init()
     if (!handler_) {
         handler_ = AAFwk::TaskHandlerWrap::CreateQueueHandler("app_state_task_queue");
     }
+    if (!deliveryHandler_) {
+        deliveryHandler_ = AAFwk::TaskHandlerWrap::GetFfrtHandler();
+    }
 }
 
 int32_t AppStateObserverManager::RegisterApplicationStateObserver(
@@ -72,6 +91,7 @@ int32_t AppStateObserverManager::RegisterApplicationStateObserver(
     }
     std::lock_guard<ffrt::mutex> lockRegister(observerLock_);
     appStateObserverMap_.emplace(observer, bundleNameList);
+    AddAppStateObserverIndex(observer, bundleNameList);
     TAG_LOGD(AAFwkTag::APPMGR, "appStateObserverMap_ size:%{public}zu", appStateObserverMap_.size());
     AddObserverDeathRecipient(observer, ObserverType::APPLICATION_STATE_OBSERVER);
     return ERR_OK;
@@ -93,6 +113,7 @@ int32_t AppStateObserverManager::UnregisterApplicationStateObserver(const sptr<I
     std::map<sptr<IApplicationStateObserver>, std::vector<std::string>>::iterator it;
     for (it = appStateObserverMap_.begin(); it != appStateObserverMap_.end(); ++it) {
         if (it->first->AsObject() == observer->AsObject()) {
+            RemoveAppStateObserverIndex(it->first);
             appStateObserverMap_.erase(it);
             TAG_LOGD(AAFwkTag::APPMGR, "appStateObserverMap_ size:%{public}zu", appStateObserverMap_.size());
             RemoveObserverDeathRecipient(observer);
@@ -403,14 +424,9 @@ void AppStateObserverManager::HandleOnAppStarted(const std::shared_ptr<AppRunnin
     data.isSpecifyTokenId = appRecord->GetAssignTokenId() > 0 ? true : false;
     TAG_LOGD(AAFwkTag::APPMGR, "HandleOnAppStarted, bundle:%{public}s, uid:%{public}d, state:%{public}d",
         data.bundleName.c_str(), data.uid, data.state);
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnAppStarted(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnAppStarted(data);
+    });
 }
 
 void AppStateObserverManager::HandleOnAppStopped(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -423,14 +439,9 @@ void AppStateObserverManager::HandleOnAppStopped(const std::shared_ptr<AppRunnin
     AppStateData data = WrapAppStateData(appRecord, ApplicationState::APP_STATE_TERMINATED);
     TAG_LOGD(AAFwkTag::APPMGR, "HandleOnAppStopped, bundle:%{public}s, uid:%{public}d, state:%{public}d",
         data.bundleName.c_str(), data.uid, data.state);
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnAppStopped(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnAppStopped(data);
+    });
 }
 
 void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRunningRecord> &appRecord,
@@ -459,18 +470,13 @@ void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRun
             TAG_LOGD(AAFwkTag::APPMGR, "name:%{public}s, uid:%{public}d, state:%{public}d, notify:%{public}d",
                 data.bundleName.c_str(), data.uid, data.state, needNotifyApp);
             dummyCode_ = __LINE__;
-            auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-            for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-                std::vector<std::string>::iterator iter =
-                    std::find(it->second.begin(), it->second.end(), data.bundleName);
-                bool valid = (it->second.empty() || iter != it->second.end()) && it->first != nullptr;
-                if (valid) {
-                    it->first->OnForegroundApplicationChanged(data);
-                }
-                if (valid && needNotifyApp) {
-                    it->first->OnAppStateChanged(data);
-                }
-            }
+            NotifyAppStateObservers(data.bundleName,
+                [data, needNotifyApp](const sptr<IApplicationStateObserver> &observer) {
+                    observer->OnForegroundApplicationChanged(data);
+                    if (needNotifyApp) {
+                        observer->OnAppStateChanged(data);
+                    }
+                });
         }
     }
     dummyCode_ = __LINE__;
@@ -479,14 +485,9 @@ void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRun
         TAG_LOGD(AAFwkTag::APPMGR, "OnApplicationStateChanged, name:%{public}s, uid:%{public}d, state:%{public}d",
             data.bundleName.c_str(), data.uid, data.state);
         dummyCode_ = __LINE__;
-        auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-        for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-            std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-                it->second.end(), data.bundleName);
-            if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-                it->first->OnApplicationStateChanged(data);
-            }
-        }
+        NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+            observer->OnApplicationStateChanged(data);
+        });
     }
 }
 
@@ -502,18 +503,14 @@ void AppStateObserverManager::HandleStateChangedNotifyObserver(
         abilityStateData.pid, abilityStateData.uid, abilityStateData.abilityType, isAbility,
         abilityStateData.callerBundleName.c_str(), abilityStateData.callerAbilityName.c_str(),
         abilityStateData.isAtomicService);
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), abilityStateData.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
+    NotifyAppStateObservers(abilityStateData.bundleName,
+        [abilityStateData, isAbility](const sptr<IApplicationStateObserver> &observer) {
             if (isAbility) {
-                it->first->OnAbilityStateChanged(abilityStateData);
+                observer->OnAbilityStateChanged(abilityStateData);
             } else {
-                it->first->OnExtensionStateChanged(abilityStateData);
+                observer->OnExtensionStateChanged(abilityStateData);
             }
-        }
-    }
+        });
 
     if ((abilityStateData.abilityState == static_cast<int32_t>(AbilityState::ABILITY_STATE_FOREGROUND) ||
             abilityStateData.abilityState == static_cast<int32_t>(AbilityState::ABILITY_STATE_BACKGROUND)) &&
@@ -556,14 +553,9 @@ void AppStateObserverManager::HandleOnProcessResued(const std::shared_ptr<AppRun
     TAG_LOGD(AAFwkTag::APPMGR, "Process Resued, bundle:%{public}s, pid:%{public}d, uid:%{public}d",
         data.bundleName.c_str(), data.pid, data.uid);
 
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnProcessReused(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnProcessReused(data);
+    });
 }
 
 void AppStateObserverManager::HandleOnRenderProcessCreated(const std::shared_ptr<RenderRecord> &renderRecord)
@@ -582,14 +574,9 @@ void AppStateObserverManager::HandleOnRenderProcessCreated(const std::shared_ptr
 
 void AppStateObserverManager::HandleOnProcessCreated(const ProcessData &data)
 {
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnProcessCreated(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnProcessCreated(data);
+    });
 }
 
 void AppStateObserverManager::HandleOnProcessStateChanged(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -607,14 +594,9 @@ void AppStateObserverManager::HandleOnProcessStateChanged(const std::shared_ptr<
         "bundle:%{public}s, pid:%{public}d, uid:%{public}d, state:%{public}d, "
         "isContinuousTask:%{public}d, gpuPid:%{public}d",
         data.bundleName.c_str(), data.pid, data.uid, data.state, data.isContinuousTask, data.gpuPid);
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnProcessStateChanged(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnProcessStateChanged(data);
+    }, PROCESS_STATE_COALESCE_KEY + std::to_string(data.pid));
 }
 
 void AppStateObserverManager::HandleOnAppProcessDied(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -645,14 +627,9 @@ void AppStateObserverManager::HandleOnRenderProcessDied(const std::shared_ptr<Re
 
 void AppStateObserverManager::HandleOnProcessDied(const ProcessData &data)
 {
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnProcessDied(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnProcessDied(data);
+    });
 }
 
 ProcessData AppStateObserverManager::WrapProcessData(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -799,10 +776,195 @@ void AppStateObserverManager::RemoveObserverDeathRecipient(const sptr<IRemoteBro
     }
 }
 
-AppStateObserverMap AppStateObserverManager::GetAppStateObserverMapCopy()
+void AppStateObserverManager::AddAppStateObserverIndex(const sptr<IApplicationStateObserver> &observer,
+    const std::vector<std::string> &bundleNameList)
 {
+    if (bundleNameList.empty()) {
+        wildcardObservers_.emplace_back(observer);
+    }
+    for (const auto &bundleName : bundleNameList) {
+        auto &observers = bundleObserverIndex_[bundleName];
+        if (std::find(observers.begin(), observers.end(), observer) == observers.end()) {
+            observers.emplace_back(observer);
+        }
+    }
+    observerQueues_.emplace(observer, std::make_shared<ObserverDeliveryQueue>());
+}
+
+void AppStateObserverManager::RemoveAppStateObserverIndex(const sptr<IApplicationStateObserver> &observer)
+{
+    wildcardObservers_.erase(std::remove(wildcardObservers_.begin(), wildcardObservers_.end(), observer),
+        wildcardObservers_.end());
+    for (auto it = bundleObserverIndex_.begin(); it != bundleObserverIndex_.end();) {
+        auto &observers = it->second;
+        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+        if (observers.empty()) {
+            it = bundleObserverIndex_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    auto queueIter = observerQueues_.find(observer);
+    if (queueIter == observerQueues_.end()) {
+        return;
+    }
+    auto queue = queueIter->second;
+    observerQueues_.erase(queueIter);
+    std::lock_guard<ffrt::mutex> lock(queue->mutex);
+    queue->isRemoved = true;
+    queue->events.clear();
+}
+
+void AppStateObserverManager::NotifyAppStateObservers(const std::string &bundleName,
+    const AppStateObserverNotify &notify, const std::string &coalesceKey)
+{
+    std::vector<std::pair<sptr<IApplicationStateObserver>, std::shared_ptr<ObserverDeliveryQueue>>> targets;
+    {
+        std::lock_guard<ffrt::mutex> lock(observerLock_);
+        auto collect = [this, &targets](const sptr<IApplicationStateObserver> &observer) {
+            auto queueIter = observerQueues_.find(observer);
+            if (observer != nullptr && queueIter != observerQueues_.end()) {
+                targets.emplace_back(observer, queueIter->second);
+            }
+        };
+        std::for_each(wildcardObservers_.begin(), wildcardObservers_.end(), collect);
+        auto indexIter = bundleObserverIndex_.find(bundleName);
+        if (indexIter != bundleObserverIndex_.end()) {
+            std::for_each(indexIter->second.begin(), indexIter->second.end(), collect);
+        }
+    }
+
+    for (const auto &[observer, queue] : targets) {
+        if (deliveryHandler_ == nullptr) {
+            notify(observer);
+            continue;
+        }
+        EnqueueObserverEvent(queue, ObserverDeliveryEvent {
+            .notify = [observer = observer, notify]() { notify(observer); },
+            .coalesceKey = coalesceKey,
+            .enqueueTime = GetSteadyTimeMillis() });
+    }
+}
+
+void AppStateObserverManager::EnqueueObserverEvent(const std::shared_ptr<ObserverDeliveryQueue> &queue,
+    ObserverDeliveryEvent &&event)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(queue->mutex);
+        if (queue->isRemoved) {
+            return;
+        }
+        if (!event.coalesceKey.empty()) {
+            auto iter = std::find_if(queue->events.begin(), queue->events.end(),
+                [&event](const ObserverDeliveryEvent &pending) { return pending.coalesceKey == event.coalesceKey; });
+            if (iter != queue->events.end()) {
+                // the pending one is superseded, the latest data is delivered after the events queued before it.
+                queue->events.erase(iter);
+                queue->stats.coalescedCount++;
+            }
+        }
+        if (queue->events.size() >= OBSERVER_QUEUE_MAX_SIZE) {
+            // only state updates may be dropped, events such as app stopped and process died never are.
+            auto iter = std::find_if(queue->events.begin(), queue->events.end(),
+                [](const ObserverDeliveryEvent &pending) { return !pending.coalesceKey.empty(); });
+            if (iter != queue->events.end()) {
+                queue->events.erase(iter);
+                if (queue->stats.droppedCount++ % DROP_LOG_INTERVAL == 0) {
+                    TAG_LOGW(AAFwkTag::APPMGR, "observer queue full, dropped:%{public}" PRIu64,
+                        queue->stats.droppedCount);
+                }
+            } else if (queue->stats.overflowCount++ % DROP_LOG_INTERVAL == 0) {
+                // the subscription is kept, the queue grows past the cap until the observer catches up.
+                TAG_LOGW(AAFwkTag::APPMGR, "observer queue full, overflow:%{public}" PRIu64,
+                    queue->stats.overflowCount);
+            }
+        }
+        queue->events.emplace_back(std::move(event));
+        if (queue->isDraining) {
+            return;
+        }
+        queue->isDraining = true;
+    }
+
+    SubmitDrainTask(queue);
+}
+
+void AppStateObserverManager::SubmitDrainTask(const std::shared_ptr<ObserverDeliveryQueue> &queue)
+{
+    auto task = [weak = weak_from_this(), queue]() {
+        auto self = weak.lock();
+        if (self == nullptr) {
+            TAG_LOGE(AAFwkTag::APPMGR, "self is nullptr, DrainObserverQueue failed.");
+            return;
+        }
+        self->DrainObserverQueue(queue);
+    };
+    deliveryHandler_->SubmitTask(task);
+}
+
+void AppStateObserverManager::DrainObserverQueue(const std::shared_ptr<ObserverDeliveryQueue> &queue)
+{
+    for (int32_t count = 0; count < OBSERVER_DRAIN_BATCH_SIZE; count++) {
+        ObserverDeliveryEvent event;
+        {
+            std::lock_guard<ffrt::mutex> lock(queue->mutex);
+            if (queue->events.empty()) {
+                queue->isDraining = false;
+                return;
+            }
+            event = std::move(queue->events.front());
+            queue->events.pop_front();
+        }
+        event.notify();
+        int64_t latency = GetSteadyTimeMillis() - event.enqueueTime;
+        if (latency > SLOW_DELIVERY_MILLIS) {
+            TAG_LOGW(AAFwkTag::APPMGR, "slow observer delivery, latency:%{public}" PRId64 "ms", latency);
+        }
+        std::lock_guard<ffrt::mutex> lock(queue->mutex);
+        queue->stats.deliveredCount++;
+        queue->stats.totalLatencyMs += latency;
+        queue->stats.maxLatencyMs = std::max(queue->stats.maxLatencyMs, latency);
+    }
+
+    // give the worker back to other observers, the rest is drained by the next task.
+    SubmitDrainTask(queue);
+}
+
+std::map<sptr<IApplicationStateObserver>, AppStateObserverDeliveryStats>
+    AppStateObserverManager::GetObserverDeliveryStats()
+{
+    std::map<sptr<IApplicationStateObserver>, AppStateObserverDeliveryStats> result;
     std::lock_guard<ffrt::mutex> lock(observerLock_);
-    return appStateObserverMap_;
+    for (const auto &[observer, queue] : observerQueues_) {
+        std::lock_guard<ffrt::mutex> queueLock(queue->mutex);
+        result.emplace(observer, queue->stats);
+    }
+    return result;
+}
+
+void AppStateObserverManager::DumpObserverDelivery(std::string &result)
+{
+    auto deliveryStats = GetObserverDeliveryStats();
+    std::lock_guard<ffrt::mutex> lock(observerLock_);
+    std::stringstream ss;
+    ss << "application state observers: " << deliveryStats.size() << "\n";
+    for (const auto &[observer, stats] : deliveryStats) {
+        ss << "  bundles:";
+        auto it = appStateObserverMap_.find(observer);
+        if (it == appStateObserverMap_.end() || it->second.empty()) {
+            ss << " *";
+        } else {
+            for (const auto &bundleName : it->second) {
+                ss << " " << bundleName;
+            }
+        }
+        int64_t averageLatencyMs = stats.deliveredCount == 0 ? 0 :
+            stats.totalLatencyMs / static_cast<int64_t>(stats.deliveredCount);
+        ss << "\n    delivered: " << stats.deliveredCount << ", dropped: " << stats.droppedCount
+            << ", coalesced: " << stats.coalescedCount << ", overflow: " << stats.overflowCount
+            << ", latency avg: " << averageLatencyMs << "ms, max: " << stats.maxLatencyMs << "ms\n";
+    }
+    result.append(ss.str());
 }
 
 AppForegroundStateObserverSet AppStateObserverManager::GetAppForegroundStateObserverSetCopy()
@@ -922,26 +1084,18 @@ void AppStateObserverManager::OnPageHide(const PageStateData pageStateData)
 
 void AppStateObserverManager::HandleOnPageShow(const PageStateData pageStateData)
 {
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), pageStateData.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnPageShow(pageStateData);
-        }
-    }
+    NotifyAppStateObservers(pageStateData.bundleName,
+        [pageStateData](const sptr<IApplicationStateObserver> &observer) {
+            observer->OnPageShow(pageStateData);
+        });
 }
 
 void AppStateObserverManager::HandleOnPageHide(const PageStateData pageStateData)
 {
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), pageStateData.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnPageHide(pageStateData);
-        }
-    }
+    NotifyAppStateObservers(pageStateData.bundleName,
+        [pageStateData](const sptr<IApplicationStateObserver> &observer) {
+            observer->OnPageHide(pageStateData);
+        });
 }
 
 void AppStateObserverManager::OnAppCacheStateChanged(const std::shared_ptr<AppRunningRecord> &appRecord,
@@ -976,14 +1130,9 @@ void AppStateObserverManager::HandleOnAppCacheStateChanged(const std::shared_ptr
     data.isSpecifyTokenId = appRecord->GetAssignTokenId() > 0 ? true : false;
     TAG_LOGD(AAFwkTag::APPMGR, "HandleOnAppCacheStateChanged, bundle:%{public}s, uid:%{public}d, state:%{public}d",
         data.bundleName.c_str(), data.uid, data.state);
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        std::vector<std::string>::iterator iter = std::find(it->second.begin(),
-            it->second.end(), data.bundleName);
-        if ((it->second.empty() || iter != it->second.end()) && it->first != nullptr) {
-            it->first->OnAppCacheStateChanged(data);
-        }
-    }
+    NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &observer) {
+        observer->OnAppCacheStateChanged(data);
+    });
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -13,8 +13,12 @@
  * limitations under the License.
  */
 
-#include <vector>
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
 #include <sstream>
+#include <unistd.h>
+#include <vector>
 #include "hitrace_meter.h"
 #include "parameters.h"
 #include "hilog_tag_wrapper.h"
@@ -28,6 +32,12 @@ namespace {
 const std::string MAX_PROC_CACHE_NUM = "persist.sys.abilityms.maxProcessCacheNum";
 const std::string PROCESS_CACHE_API_CHECK_CONFIG = "persist.sys.abilityms.processCacheApiCheck";
 const std::string PROCESS_CACHE_SET_SUPPORT_CHECK_CONFIG = "persist.sys.abilityms.processCacheSetSupportCheck";
+const std::string MAX_PROC_CACHE_MEMORY_KB = "persist.sys.abilityms.maxProcessCacheMemoryKb";
+const std::string PROCESS_CACHE_EVICT_POLICY = "persist.sys.abilityms.processCacheEvictPolicy";
+constexpr const char *EVICT_POLICY_LRU = "lru";
+constexpr const char *EVICT_POLICY_COST_WEIGHTED = "cost";
+constexpr size_t MAX_EVICTED_PROCESS_NUM = 64;
+constexpr int64_t BYTES_PER_KB = 1024;
 constexpr int32_t API12 = 12;
 constexpr int32_t API_VERSION_MOD = 100;
 constexpr const char *EVENT_KEY_VERSION_NAME = "VERSION_NAME";
@@ -38,13 +48,144 @@ constexpr const char *EVENT_KEY_CACHE_STATE = "CACHE_STATE";
 
 namespace OHOS {
 namespace AppExecFwk {
+bool CachedProcessQueue::push_back(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (index_.find(appRecord) != index_.end()) {
+        return false;
+    }
+    index_.emplace(appRecord, records_.insert(records_.end(), appRecord));
+    return true;
+}
+
+bool CachedProcessQueue::move_to_back(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    auto iter = index_.find(appRecord);
+    if (iter == index_.end()) {
+        return false;
+    }
+    records_.splice(records_.end(), records_, iter->second);
+    return true;
+}
+
+bool CachedProcessQueue::erase(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    auto iter = index_.find(appRecord);
+    if (iter == index_.end()) {
+        return false;
+    }
+    records_.erase(iter->second);
+    index_.erase(iter);
+    return true;
+}
+
+size_t CachedProcessQueue::count(const std::shared_ptr<AppRunningRecord> &appRecord) const
+{
+    return index_.count(appRecord);
+}
+
+const std::shared_ptr<AppRunningRecord> &CachedProcessQueue::front() const
+{
+    return records_.front();
+}
+
+void CachedProcessQueue::pop_front()
+{
+    index_.erase(records_.front());
+    records_.pop_front();
+}
+
+void CachedProcessQueue::clear()
+{
+    index_.clear();
+    records_.clear();
+}
+
+size_t CachedProcessQueue::size() const
+{
+    return records_.size();
+}
+
+bool CachedProcessQueue::empty() const
+{
+    return records_.empty();
+}
+
+CachedProcessQueue::const_iterator CachedProcessQueue::begin() const
+{
+    return records_.begin();
+}
+
+CachedProcessQueue::const_iterator CachedProcessQueue::end() const
+{
+    return records_.end();
+}
+
+std::string FifoProcessCacheEvictPolicy::GetName() const
+{
+    return "fifo";
+}
+
+size_t FifoProcessCacheEvictPolicy::SelectVictim(const std::vector<ProcessCacheCandidate> &candidates)
+{
+    return 0;
+}
+
+std::string LruProcessCacheEvictPolicy::GetName() const
+{
+    return EVICT_POLICY_LRU;
+}
+
+bool LruProcessCacheEvictPolicy::IsReorderedOnUse() const
+{
+    return true;
+}
+
+std::string CostWeightedProcessCacheEvictPolicy::GetName() const
+{
+    return EVICT_POLICY_COST_WEIGHTED;
+}
+
+bool CostWeightedProcessCacheEvictPolicy::IsReorderedOnUse() const
+{
+    return true;
+}
+
+bool CostWeightedProcessCacheEvictPolicy::IsMemoryWeighted() const
+{
+    return true;
+}
+
+size_t CostWeightedProcessCacheEvictPolicy::SelectVictim(const std::vector<ProcessCacheCandidate> &candidates)
+{
+    size_t victim = 0;
+    for (size_t i = 1; i < candidates.size(); i++) {
+        // compares memoryKb / (reuseCount + 1) without division, strictly greater keeps the older one on a tie.
+        const auto &current = candidates[i];
+        const auto &selected = candidates[victim];
+        if (static_cast<long double>(current.memoryKb) * (selected.reuseCount + 1) >
+            static_cast<long double>(selected.memoryKb) * (current.reuseCount + 1)) {
+            victim = i;
+        }
+    }
+    return victim;
+}
 
 CacheProcessManager::CacheProcessManager()
 {
     maxProcCacheNum_ = OHOS::system::GetIntParameter<int>(MAX_PROC_CACHE_NUM, 0);
+    maxProcCacheMemoryKb_ = OHOS::system::GetIntParameter<int64_t>(MAX_PROC_CACHE_MEMORY_KB, 0);
     shouldCheckApi = OHOS::system::GetBoolParameter(PROCESS_CACHE_API_CHECK_CONFIG, true);
     shouldCheckSupport = OHOS::system::GetBoolParameter(PROCESS_CACHE_SET_SUPPORT_CHECK_CONFIG, true);
-    TAG_LOGW(AAFwkTag::APPMGR, "maxProcCacheNum is =%{public}d", maxProcCacheNum_);
+    auto evictPolicy = OHOS::system::GetParameter(PROCESS_CACHE_EVICT_POLICY, "");
+    if (evictPolicy == EVICT_POLICY_LRU) {
+        evictPolicy_ = std::make_shared<LruProcessCacheEvictPolicy>();
+    } else if (evictPolicy == EVICT_POLICY_COST_WEIGHTED) {
+        evictPolicy_ = std::make_shared<CostWeightedProcessCacheEvictPolicy>();
+    } else {
+        evictPolicy_ = std::make_shared<FifoProcessCacheEvictPolicy>();
+    }
+    TAG_LOGW(AAFwkTag::APPMGR, "maxProcCacheNum is =%{public}d, maxProcCacheMemoryKb is =%{public}" PRId64
+        ", evict policy is %{public}s", maxProcCacheNum_, maxProcCacheMemoryKb_, evictPolicy_->GetName().c_str());
 }
 
 CacheProcessManager::~CacheProcessManager()
@@ -60,7 +201,18 @@ void CacheProcessManager::SetAppMgr(const std::weak_ptr<AppMgrServiceInner> &app
 void CacheProcessManager::RefreshCacheNum()
 {
     maxProcCacheNum_ = OHOS::system::GetIntParameter<int>(MAX_PROC_CACHE_NUM, 0);
-    TAG_LOGW(AAFwkTag::APPMGR, "maxProcCacheNum is =%{public}d", maxProcCacheNum_);
+    maxProcCacheMemoryKb_ = OHOS::system::GetIntParameter<int64_t>(MAX_PROC_CACHE_MEMORY_KB, 0);
+    TAG_LOGW(AAFwkTag::APPMGR, "maxProcCacheNum is =%{public}d, maxProcCacheMemoryKb is =%{public}" PRId64,
+        maxProcCacheNum_, maxProcCacheMemoryKb_);
+}
+
+void CacheProcessManager::SetEvictPolicy(const std::shared_ptr<ProcessCacheEvictPolicy> &evictPolicy)
+{
+    if (evictPolicy == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+    evictPolicy_ = evictPolicy;
 }
 
 bool CacheProcessManager::QueryEnableProcessCache()
@@ -85,7 +237,9 @@ bool CacheProcessManager::PenddingCacheProcess(const std::shared_ptr<AppRunningR
     }
     {
         std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
-        cachedAppRecordQueue_.push_back(appRecord);
+        if (!cachedAppRecordQueue_.push_back(appRecord) && evictPolicy_->IsReorderedOnUse()) {
+            cachedAppRecordQueue_.move_to_back(appRecord);
+        }
         AddToApplicationSet(appRecord);
     }
     ShrinkAndKillCache();
@@ -113,6 +267,12 @@ bool CacheProcessManager::CheckAndCacheProcess(const std::shared_ptr<AppRunningR
             appRecord->GetName().c_str());
         return true;
     }
+    {
+        std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+        if (evictPolicy_->IsReorderedOnUse()) {
+            cachedAppRecordQueue_.move_to_back(appRecord);
+        }
+    }
     appRecord->ScheduleCacheProcess();
     auto appInfo = appRecord->GetApplicationInfo();
     HiSysEventWrite(HiSysEvent::Domain::AAFWK, "CACHE_START_APP", HiSysEvent::EventType::BEHAVIOR,
@@ -172,12 +332,7 @@ bool CacheProcessManager::IsCachedProcess(const std::shared_ptr<AppRunningRecord
         return false;
     }
     std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
-    for (auto& tmpAppRecord : cachedAppRecordQueue_) {
-        if (tmpAppRecord == appRecord) {
-            return true;
-        }
-    }
-    return false;
+    return cachedAppRecordQueue_.count(appRecord) != 0;
 }
 
 void CacheProcessManager::OnProcessKilled(const std::shared_ptr<AppRunningRecord> &appRecord)
@@ -223,6 +378,11 @@ bool CacheProcessManager::ReuseCachedProcess(const std::shared_ptr<AppRunningRec
         return false;
     }
     RemoveCacheRecord(appRecord);
+    {
+        std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+        hitCount_++;
+        bundleReuseCounts_[appRecord->GetBundleName()]++;
+    }
     HiSysEventWrite(HiSysEvent::Domain::AAFWK, "CACHE_START_APP", HiSysEvent::EventType::BEHAVIOR,
         EVENT_KEY_VERSION_CODE, appInfo->versionCode, EVENT_KEY_VERSION_NAME, appInfo->versionName,
         EVENT_KEY_BUNDLE_NAME, appInfo->bundleName, EVENT_KEY_CACHE_STATE, "exitCacheNormal");
@@ -354,13 +514,8 @@ int CacheProcessManager::GetCurrentCachedProcNum()
 void CacheProcessManager::RemoveCacheRecord(const std::shared_ptr<AppRunningRecord> &appRecord)
 {
     std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
-    for (auto it = cachedAppRecordQueue_.begin(); it != cachedAppRecordQueue_.end();) {
-        if (appRecord == *it) {
-            RemoveFromApplicationSet(*it);
-            it = cachedAppRecordQueue_.erase(it);
-        } else {
-            it++;
-        }
+    if (cachedAppRecordQueue_.erase(appRecord)) {
+        RemoveFromApplicationSet(appRecord);
     }
 }
 
@@ -371,19 +526,41 @@ void CacheProcessManager::ShrinkAndKillCache()
         TAG_LOGI(AAFwkTag::APPMGR, "Cache disabled.");
         return;
     }
+    std::shared_ptr<ProcessCacheEvictPolicy> evictPolicy;
+    {
+        std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+        evictPolicy = evictPolicy_;
+    }
+    // the memory is sampled from procfs without holding the queue lock.
+    auto candidates = GetEvictCandidates(maxProcCacheMemoryKb_ > 0 || evictPolicy->IsMemoryWeighted());
     std::vector<std::shared_ptr<AppRunningRecord>> cleanList;
     {
         std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
-        while (GetCurrentCachedProcNum() > maxProcCacheNum_) {
-            const auto& tmpAppRecord = cachedAppRecordQueue_.front();
-            cachedAppRecordQueue_.pop_front();
+        int64_t totalMemoryKb = 0;
+        for (auto it = candidates.begin(); it != candidates.end();) {
+            if (cachedAppRecordQueue_.count(it->appRecord) == 0) {
+                it = candidates.erase(it);
+                continue;
+            }
+            totalMemoryKb += it->memoryKb;
+            it++;
+        }
+        while (!candidates.empty() && (GetCurrentCachedProcNum() > maxProcCacheNum_ ||
+            (maxProcCacheMemoryKb_ > 0 && totalMemoryKb > maxProcCacheMemoryKb_))) {
+            auto index = std::min(evictPolicy->SelectVictim(candidates), candidates.size() - 1);
+            auto tmpAppRecord = candidates[index].appRecord;
+            totalMemoryKb -= candidates[index].memoryKb;
+            candidates.erase(candidates.begin() + index);
+            cachedAppRecordQueue_.erase(tmpAppRecord);
             RemoveFromApplicationSet(tmpAppRecord);
             if (tmpAppRecord == nullptr) {
                 continue;
             }
+            evictCount_++;
+            RecordEvicted(tmpAppRecord);
             cleanList.push_back(tmpAppRecord);
-            TAG_LOGI(AAFwkTag::APPMGR, "need clean record %{public}s, current =%{public}d",
-                tmpAppRecord->GetName().c_str(), GetCurrentCachedProcNum());
+            TAG_LOGI(AAFwkTag::APPMGR, "need clean record %{public}s, current =%{public}d, memory =%{public}" PRId64
+                "KB", tmpAppRecord->GetName().c_str(), GetCurrentCachedProcNum(), totalMemoryKb);
         }
     }
     for (auto& tmpAppRecord : cleanList) {
@@ -395,6 +572,109 @@ void CacheProcessManager::ShrinkAndKillCache()
     }
 }
 
+std::vector<ProcessCacheCandidate> CacheProcessManager::GetEvictCandidates(bool isMemoryWeighted)
+{
+    std::vector<ProcessCacheCandidate> candidates;
+    {
+        std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+        candidates.reserve(cachedAppRecordQueue_.size());
+        for (const auto &record : cachedAppRecordQueue_) {
+            ProcessCacheCandidate candidate;
+            candidate.appRecord = record;
+            if (record != nullptr) {
+                auto iter = bundleReuseCounts_.find(record->GetBundleName());
+                candidate.reuseCount = iter == bundleReuseCounts_.end() ? 0 : iter->second;
+            }
+            candidates.emplace_back(candidate);
+        }
+    }
+    if (isMemoryWeighted) {
+        for (auto &candidate : candidates) {
+            candidate.memoryKb = GetProcessMemoryKb(candidate.appRecord);
+        }
+    }
+    return candidates;
+}
+
+int64_t CacheProcessManager::GetProcessMemoryKb(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRecord == nullptr || appRecord->GetPriorityObject() == nullptr) {
+        return 0;
+    }
+    auto pid = appRecord->GetPriorityObject()->GetPid();
+    if (pid <= 0) {
+        return 0;
+    }
+    // the second field of statm is the resident set size in pages.
+    std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+    int64_t sizePages = 0;
+    int64_t residentPages = 0;
+    if (!(statm >> sizePages >> residentPages)) {
+        return 0;
+    }
+    return residentPages * static_cast<int64_t>(sysconf(_SC_PAGESIZE)) / BYTES_PER_KB;
+}
+
+std::string CacheProcessManager::GetEvictedKey(const std::string &bundleName, const std::string &processName,
+    int32_t uid)
+{
+    return bundleName + ":" + processName + ":" + std::to_string(uid);
+}
+
+void CacheProcessManager::RecordEvicted(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    auto appInfo = appRecord->GetApplicationInfo();
+    if (appInfo == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+    if (evictedProcesses_.size() >= MAX_EVICTED_PROCESS_NUM) {
+        evictedProcesses_.clear();
+    }
+    evictedProcesses_.insert(GetEvictedKey(appRecord->GetBundleName(), appRecord->GetProcessName(), appInfo->uid));
+}
+
+void CacheProcessManager::OnProcessCreated(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (!QueryEnableProcessCache() || appRecord == nullptr) {
+        return;
+    }
+    auto appInfo = appRecord->GetApplicationInfo();
+    if (appInfo == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+    if (evictedProcesses_.erase(GetEvictedKey(appRecord->GetBundleName(), appRecord->GetProcessName(),
+        appInfo->uid)) != 0) {
+        missCount_++;
+    }
+}
+
+void CacheProcessManager::DumpProcessCache(std::string &result)
+{
+    std::shared_ptr<ProcessCacheEvictPolicy> evictPolicy;
+    {
+        std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+        evictPolicy = evictPolicy_;
+    }
+    auto candidates = GetEvictCandidates(true);
+    std::lock_guard<ffrt::recursive_mutex> queueLock(cacheQueueMtx);
+    std::stringstream ss;
+    ss << "process cache:\n"
+        << "  policy: " << evictPolicy->GetName() << "\n"
+        << "  max count: " << maxProcCacheNum_ << ", max memory: " << maxProcCacheMemoryKb_ << "KB\n"
+        << "  hit: " << hitCount_ << ", miss: " << missCount_ << ", evict: " << evictCount_ << "\n"
+        << "  cached: " << candidates.size() << "\n";
+    for (const auto &candidate : candidates) {
+        if (candidate.appRecord == nullptr) {
+            continue;
+        }
+        ss << "    " << candidate.appRecord->GetName() << ", memory: " << candidate.memoryKb << "KB, reuse: "
+            << candidate.reuseCount << "\n";
+    }
+    result.append(ss.str());
+}
+
 bool CacheProcessManager::KillProcessByRecord(const std::shared_ptr<AppRunningRecord> &appRecord)
 {
     if (appRecord == nullptr) {
@@ -17,6 +17,7 @@
 #define OHOS_ABILITY_RUNTIME_TASK_HANDLER_WRAP_H
 
 #include <string>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <functional>
@@ -31,6 +32,7 @@ namespace OHOS {
 namespace AAFwk {
 class TaskHandlerWrap;
 class InnerTaskHandle;
+class TimeoutTaskWheel;
 class TaskHandle {
 friend class TaskHandlerWrap;
 public:
@@ -74,6 +76,8 @@ public:
     TaskHandle SubmitTask(const std::function<void()> &task, const std::string &name);
     TaskHandle SubmitTask(const std::function<void()> &task, int64_t delayMillis);
     TaskHandle SubmitTask(const std::function<void()> &task, TaskQoS taskQos);
+    // Named delayed tasks are kept in a timing wheel and could only be canceled by name,
+    // the returned TaskHandle is empty for them.
     TaskHandle SubmitTask(const std::function<void()> &task, const std::string &name,
         int64_t delayMillis, bool forceSubmit = true);
     TaskHandle SubmitTask(const std::function<void()> &task, const TaskAttribute &taskAttr);
@@ -83,6 +87,9 @@ public:
     // This is only used for compatibility and could be be wrong if multi tasks with same name submited.
     // TaskHandle::Cancel is prefered.
     bool CancelTask(const std::string &name);
+    // Pending named delayed tasks, per category the task name without ids.
+    size_t GetPendingTimeoutCount();
+    std::map<std::string, size_t> GetPendingTimeoutCountByCategory();
 protected:
     TaskHandlerWrap();
     virtual std::shared_ptr<InnerTaskHandle> SubmitTaskInner(std::function<void()> &&task,
@@ -94,6 +101,7 @@ protected:
     // this is used only for compatibility
     std::unordered_map<std::string, TaskHandle> tasks_;
     std::unique_ptr<ffrt::mutex> tasksMutex_;
+    std::unique_ptr<TimeoutTaskWheel> timeoutWheel_;
 };
 
 class AutoSyncTaskHandle {
@@ -21,6 +21,7 @@
 #include "ffrt_task_utils_wrap.h"
 #include "queue_task_handler_wrap.h"
 #include "ffrt_task_handler_wrap.h"
+#include "timeout_task_wheel.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -72,6 +73,18 @@ std::shared_ptr<TaskHandlerWrap> TaskHandlerWrap::GetFfrtHandler()
 TaskHandlerWrap::TaskHandlerWrap()
 {
     tasksMutex_ = std::make_unique<ffrt::mutex>();
+    timeoutWheel_ = std::make_unique<TimeoutTaskWheel>([this](std::function<void()> &&drive, int64_t delayMillis) {
+        // the wheel is owned by this handler, it is alive as long as the handler is.
+        auto taskHandle = SubmitTask([whandler = weak_from_this(), drive = std::move(drive)]() {
+            auto handler = whandler.lock();
+            if (handler) {
+                drive();
+            }
+        }, delayMillis);
+        return [taskHandle]() {
+            return taskHandle.Cancel();
+        };
+    });
 }
 
 TaskHandlerWrap::~TaskHandlerWrap() = default;
@@ -103,7 +116,15 @@ TaskHandle TaskHandlerWrap::SubmitTask(const std::function<void()> &task,
     TaskAttribute atskAttr{name, delayMillis};
     std::lock_guard<ffrt::mutex> guard(*tasksMutex_);
     auto it = tasks_.find(name);
-    if (it != tasks_.end()) {
+    if (delayMillis > 0 && !name.empty()) {
+        // named timeouts are mostly canceled before they expire, keep them off the task queue.
+        if (it == tasks_.end() && timeoutWheel_->Arm(name, task, delayMillis)) {
+            return TaskHandle();
+        }
+        TAG_LOGD(AAFwkTag::DEFAULT, "SubmitTask repeated timeout task: %{public}s", name.c_str());
+        return forceSubmit ? SubmitTask(task, atskAttr) : TaskHandle();
+    }
+    if (it != tasks_.end() || timeoutWheel_->Contains(name)) {
         TAG_LOGD(AAFwkTag::DEFAULT, "SubmitTask repeated task: %{public}s", name.c_str());
         if (forceSubmit) {
             return SubmitTask(task, atskAttr);
@@ -144,6 +165,9 @@ TaskHandle TaskHandlerWrap::SubmitTask(const std::function<void()> &task, const
 bool TaskHandlerWrap::CancelTask(const std::string &name)
 {
     TAG_LOGD(AAFwkTag::DEFAULT, "CancelTask task: %{public}s", name.c_str());
+    if (timeoutWheel_->Cancel(name)) {
+        return true;
+    }
     std::lock_guard<ffrt::mutex> guard(*tasksMutex_);
     auto it = tasks_.find(name);
     if (it == tasks_.end()) {
@@ -155,6 +179,16 @@ bool TaskHandlerWrap::CancelTask(const std::string &name)
     return taskHandle.Cancel();
 }
 
+size_t TaskHandlerWrap::GetPendingTimeoutCount()
+{
+    return timeoutWheel_->GetPendingCount();
+}
+
+std::map<std::string, size_t> TaskHandlerWrap::GetPendingTimeoutCountByCategory()
+{
+    return timeoutWheel_->GetPendingCountByCategory();
+}
+
 bool TaskHandlerWrap::RemoveTask(const std::string &name, const TaskHandle &taskHandle)
 {
     std::lock_guard<ffrt::mutex> guard(*tasksMutex_);
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timeout_task_wheel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace OHOS {
+namespace AAFwk {
+TimeoutTaskWheel::TimeoutTaskWheel(DriveSubmitter submitter) : submitter_(std::move(submitter))
+{}
+
+int64_t TimeoutTaskWheel::GetNowMillis()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
+
+std::string TimeoutTaskWheel::GetCategory(const std::string &name)
+{
+    std::string category;
+    for (auto c : name) {
+        if (c == ':') {
+            break;
+        }
+        if (c < '0' || c > '9') {
+            category.push_back(c);
+        }
+    }
+    return category;
+}
+
+bool TimeoutTaskWheel::Arm(const std::string &name, const std::function<void()> &task, int64_t delayMillis)
+{
+    return ArmAt(name, task, GetNowMillis(), delayMillis);
+}
+
+bool TimeoutTaskWheel::ArmAt(const std::string &name, const std::function<void()> &task, int64_t nowMillis,
+    int64_t delayMillis)
+{
+    if (name.empty() || !task) {
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> guard(mutex_);
+    if (positions_.find(name) != positions_.end()) {
+        return false;
+    }
+
+    uint64_t nowTick = static_cast<uint64_t>(nowMillis / TICK_MILLIS);
+    if (positions_.empty()) {
+        // nothing is pending, the wheel can jump to now without expiring anything.
+        currentTick_ = std::max(currentTick_, nowTick);
+    }
+    uint64_t expireTick = static_cast<uint64_t>((nowMillis + std::max<int64_t>(delayMillis, 0) + TICK_MILLIS - 1) /
+        TICK_MILLIS);
+    expireTick = std::max(expireTick, currentTick_ + 1);
+
+    Slot staging;
+    staging.push_back(TimeoutTask { name, GetCategory(name), task, expireTick });
+    categoryCounts_[staging.front().category]++;
+    Place(staging, staging.begin());
+    ScheduleDrive(expireTick, nowMillis);
+    return true;
+}
+
+bool TimeoutTaskWheel::Cancel(const std::string &name)
+{
+    std::lock_guard<ffrt::mutex> guard(mutex_);
+    auto it = positions_.find(name);
+    if (it == positions_.end()) {
+        return false;
+    }
+    DecreaseCategory(it->second.iter->category);
+    it->second.slot->erase(it->second.iter);
+    positions_.erase(it);
+    return true;
+}
+
+bool TimeoutTaskWheel::Contains(const std::string &name)
+{
+    std::lock_guard<ffrt::mutex> guard(mutex_);
+    return positions_.find(name) != positions_.end();
+}
+
+size_t TimeoutTaskWheel::GetPendingCount()
+{
+    std::lock_guard<ffrt::mutex> guard(mutex_);
+    return positions_.size();
+}
+
+std::map<std::string, size_t> TimeoutTaskWheel::GetPendingCountByCategory()
+{
+    std::lock_guard<ffrt::mutex> guard(mutex_);
+    return std::map<std::string, size_t>(categoryCounts_.begin(), categoryCounts_.end());
+}
+
+void TimeoutTaskWheel::DecreaseCategory(const std::string &category)
+{
+    auto it = categoryCounts_.find(category);
+    if (it == categoryCounts_.end()) {
+        return;
+    }
+    if (--it->second == 0) {
+        categoryCounts_.erase(it);
+    }
+}
+
+void TimeoutTaskWheel::Place(Slot &from, Slot::iterator iter)
+{
+    uint64_t expireTick = iter->expireTick;
+    uint64_t delta = expireTick > currentTick_ ? expireTick - currentTick_ : 0;
+    if (delta > MAX_TICK_DELTA) {
+        // beyond the top level, parked in the farthest slot and placed again when it is cascaded.
+        delta = MAX_TICK_DELTA;
+        expireTick = currentTick_ + MAX_TICK_DELTA;
+    }
+
+    Slot *slot = nullptr;
+    if (delta < ROOT_SLOT_NUM) {
+        slot = &rootSlots_[expireTick & (ROOT_SLOT_NUM - 1)];
+    } else {
+        uint32_t level = 1;
+        while (level < LEVEL_NUM - 1 && delta >= (1ULL << (ROOT_SLOT_BITS + level * SLOT_BITS))) {
+            level++;
+        }
+        uint64_t index = (expireTick >> (ROOT_SLOT_BITS + (level - 1) * SLOT_BITS)) & (SLOT_NUM - 1);
+        slot = &slots_[level - 1][index];
+    }
+    slot->splice(slot->end(), from, iter);
+    positions_[iter->name] = Position { slot, iter };
+}
+
+void TimeoutTaskWheel::Cascade(uint32_t level, uint64_t index)
+{
+    Slot cascaded;
+    cascaded.splice(cascaded.end(), slots_[level - 1][index]);
+    while (!cascaded.empty()) {
+        Place(cascaded, cascaded.begin());
+    }
+}
+
+void TimeoutTaskWheel::AdvanceTo(uint64_t tick, Slot &expired)
+{
+    while (currentTick_ < tick) {
+        currentTick_++;
+        uint64_t index = currentTick_ & (ROOT_SLOT_NUM - 1);
+        if (index == 0) {
+            for (uint32_t level = 1; level < LEVEL_NUM; level++) {
+                uint64_t levelIndex = (currentTick_ >> (ROOT_SLOT_BITS + (level - 1) * SLOT_BITS)) & (SLOT_NUM - 1);
+                Cascade(level, levelIndex);
+                if (levelIndex != 0) {
+                    break;
+                }
+            }
+        }
+
+        auto &slot = rootSlots_[index];
+        for (const auto &timeoutTask : slot) {
+            positions_.erase(timeoutTask.name);
+            DecreaseCategory(timeoutTask.category);
+        }
+        expired.splice(expired.end(), slot);
+    }
+}
+
+bool TimeoutTaskWheel::GetNextTick(uint64_t &tick) const
+{
+    if (positions_.empty()) {
+        return false;
+    }
+    // the earliest of the next busy root slot and the next cascade of a busy upper slot.
+    bool found = false;
+    for (uint64_t delta = 1; delta <= ROOT_SLOT_NUM; delta++) {
+        if (!rootSlots_[(currentTick_ + delta) & (ROOT_SLOT_NUM - 1)].empty()) {
+            tick = currentTick_ + delta;
+            found = true;
+            break;
+        }
+    }
+    for (uint32_t level = 1; level < LEVEL_NUM; level++) {
+        uint32_t shift = ROOT_SLOT_BITS + (level - 1) * SLOT_BITS;
+        uint64_t index = (currentTick_ >> shift) & (SLOT_NUM - 1);
+        for (uint64_t delta = 1; delta <= SLOT_NUM; delta++) {
+            if (slots_[level - 1][(index + delta) & (SLOT_NUM - 1)].empty()) {
+                continue;
+            }
+            uint64_t cascadeTick = ((currentTick_ >> shift) + delta) << shift;
+            if (!found || cascadeTick < tick) {
+                tick = cascadeTick;
+                found = true;
+            }
+            break;
+        }
+    }
+    return found;
+}
+
+void TimeoutTaskWheel::ScheduleDrive(uint64_t tick, int64_t nowMillis)
+{
+    if (driveTick_ != 0 && driveTick_ <= tick) {
+        return;
+    }
+    if (driveTick_ != 0 && driveCanceller_) {
+        // the later drive task is superseded, it does nothing if it could not be canceled in time.
+        driveCanceller_();
+    }
+    driveTick_ = tick;
+    int64_t delayMillis = std::max<int64_t>(static_cast<int64_t>(tick) * TICK_MILLIS - nowMillis, 0);
+    driveCanceller_ = submitter_([this, tick]() {
+        Drive(tick, GetNowMillis());
+    }, delayMillis);
+}
+
+void TimeoutTaskWheel::Drive(uint64_t driveTick, int64_t nowMillis)
+{
+    Slot expired;
+    {
+        std::lock_guard<ffrt::mutex> guard(mutex_);
+        if (driveTick_ != driveTick) {
+            return;
+        }
+        driveTick_ = 0;
+        driveCanceller_ = nullptr;
+        AdvanceTo(static_cast<uint64_t>(nowMillis / TICK_MILLIS), expired);
+        uint64_t nextTick = 0;
+        if (GetNextTick(nextTick)) {
+            ScheduleDrive(nextTick, nowMillis);
+        }
+    }
+    for (auto &timeoutTask : expired) {
+        timeoutTask.task();
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
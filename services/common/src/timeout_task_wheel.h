@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_TIMEOUT_TASK_WHEEL_H
+#define OHOS_ABILITY_RUNTIME_TIMEOUT_TASK_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "cpp/mutex.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class TimeoutTaskWheel
+ * Hierarchical timing wheel holding the named timeout tasks of one TaskHandlerWrap.
+ * Arm and cancel are O(1), expired tasks are run in a batch by one drive task submitted on the handler.
+ */
+class TimeoutTaskWheel {
+public:
+    // cancel a submitted drive task, returns false if it is already running or finished.
+    using DriveCanceller = std::function<bool()>;
+    // submit the drive task on the owner handler after delayMillis.
+    using DriveSubmitter = std::function<DriveCanceller(std::function<void()> &&drive, int64_t delayMillis)>;
+
+    explicit TimeoutTaskWheel(DriveSubmitter submitter);
+    ~TimeoutTaskWheel() = default;
+
+    bool Arm(const std::string &name, const std::function<void()> &task, int64_t delayMillis);
+    bool Cancel(const std::string &name);
+    bool Contains(const std::string &name);
+    size_t GetPendingCount();
+    std::map<std::string, size_t> GetPendingCountByCategory();
+
+    // the category of a task name, i.e. the name before ':' without the record and mission ids.
+    static std::string GetCategory(const std::string &name);
+
+private:
+    static constexpr int64_t TICK_MILLIS = 10;
+    static constexpr uint32_t LEVEL_NUM = 4;
+    static constexpr uint32_t ROOT_SLOT_BITS = 8;
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint64_t ROOT_SLOT_NUM = 1ULL << ROOT_SLOT_BITS;
+    static constexpr uint64_t SLOT_NUM = 1ULL << SLOT_BITS;
+    static constexpr uint64_t MAX_TICK_DELTA = (1ULL << (ROOT_SLOT_BITS + (LEVEL_NUM - 1) * SLOT_BITS)) - 1;
+
+    struct TimeoutTask {
+        std::string name;
+        std::string category;
+        std::function<void()> task;
+        uint64_t expireTick = 0;
+    };
+    using Slot = std::list<TimeoutTask>;
+    struct Position {
+        Slot *slot = nullptr;
+        Slot::iterator iter;
+    };
+
+    static int64_t GetNowMillis();
+    bool ArmAt(const std::string &name, const std::function<void()> &task, int64_t nowMillis, int64_t delayMillis);
+    void Drive(uint64_t driveTick, int64_t nowMillis);
+    void Place(Slot &from, Slot::iterator iter);
+    void Cascade(uint32_t level, uint64_t index);
+    void AdvanceTo(uint64_t tick, Slot &expired);
+    bool GetNextTick(uint64_t &tick) const;
+    void ScheduleDrive(uint64_t tick, int64_t nowMillis);
+    void DecreaseCategory(const std::string &category);
+
+    DriveSubmitter submitter_;
+    ffrt::mutex mutex_;
+    uint64_t currentTick_ = 0;
+    // tick of the only live drive task, 0 means none. A drive task for another tick is stale and does nothing.
+    uint64_t driveTick_ = 0;
+    DriveCanceller driveCanceller_;
+    std::array<Slot, ROOT_SLOT_NUM> rootSlots_;
+    std::array<std::array<Slot, SLOT_NUM>, LEVEL_NUM - 1> slots_;
+    std::unordered_map<std::string, Position> positions_;
+    std::unordered_map<std::string, size_t> categoryCounts_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_TIMEOUT_TASK_WHEEL_H
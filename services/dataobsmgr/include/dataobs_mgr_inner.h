@@ -25,6 +25,7 @@
 #include "cpp/mutex.h"
 
 #include "data_ability_observer_interface.h"
+#include "task_handler_wrap.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -40,17 +41,34 @@ public:
     int HandleUnregisterObserver(const Uri &uri, sptr<IDataAbilityObserver> dataObserver);
     int HandleNotifyChange(const Uri &uri);
     void OnCallBackDied(const wptr<IRemoteObject> &remote);
+    /**
+     * @brief Set the handler used to fan out OnChange callbacks. Callbacks run inline when it is not set.
+     */
+    void SetHandler(const std::shared_ptr<TaskHandlerWrap> &handler);
 
 private:
+    struct DispatchState {
+        int64_t startTime = 0;
+        uint32_t inflight = 0;
+    };
+
+    void DispatchOnChange(const sptr<IDataAbilityObserver> &dataObserver);
+    bool BeginDispatch(const sptr<IRemoteObject> &obj);
+    void EndDispatch(const sptr<IRemoteObject> &obj);
     void AddObsDeathRecipient(sptr<IDataAbilityObserver> dataObserver);
     void RemoveObsDeathRecipient(sptr<IRemoteObject> dataObserver);
     void RemoveObs(sptr<IRemoteObject> dataObserver);
     bool HaveRegistered(sptr<IDataAbilityObserver> dataObserver);
 
     static constexpr uint32_t OBS_NUM_MAX = 50;
+    // an observer whose callback has not returned within this time is skipped until it recovers
+    static constexpr int64_t OBS_DISPATCH_TIMEOUT_MS = 3000;
     ffrt::mutex innerMutex_;
     ObsMapType observers_;
     ObsRecipientMapType obsRecipient_;
+    ffrt::mutex dispatchMutex_;
+    std::map<sptr<IRemoteObject>, DispatchState> dispatching_;
+    std::shared_ptr<TaskHandlerWrap> handler_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -63,29 +63,36 @@ private:
     using ObsMap = std::map<sptr<IDataAbilityObserver>, std::list<Uri>>;
     using EntryList = std::list<Entry>;
 
+    // Nodes are immutable once published, writers rebuild the modified path and share the untouched subtrees.
     class Node {
     public:
         Node(const std::string &name);
-        void GetObs(const std::vector<std::string> &path, uint32_t index, Uri &uri, ObsMap &obsMap);
-        bool AddObserver(const std::vector<std::string> &path, uint32_t index, const Entry &entry);
+        void GetObs(const std::vector<std::string> &path, uint32_t index, Uri &uri, ObsMap &obsMap) const;
+        bool AddObserver(const std::vector<std::string> &path, uint32_t index, const Entry &entry,
+            std::shared_ptr<const Node> &result) const;
         bool RemoveObserver(const std::vector<std::string> &path, uint32_t index,
-            sptr<IDataAbilityObserver> dataObserver);
-        inline bool RemoveObserver(sptr<IDataAbilityObserver> dataObserver);
-        bool RemoveObserver(sptr<IRemoteObject> dataObserver);
+            sptr<IDataAbilityObserver> dataObserver, std::shared_ptr<const Node> &result) const;
+        inline bool RemoveObserver(sptr<IDataAbilityObserver> dataObserver, std::shared_ptr<const Node> &result) const;
+        bool RemoveObserver(sptr<IRemoteObject> dataObserver, std::shared_ptr<const Node> &result) const;
+        inline bool IsEmpty() const;
 
     private:
         std::string name_;
         EntryList entrys_;
-        std::map<std::string, std::shared_ptr<Node>> childrens_;
+        std::map<std::string, std::shared_ptr<const Node>> childrens_;
     };
 
+    std::shared_ptr<const Node> GetRoot() const;
+    void PublishRoot(std::shared_ptr<const Node> root);
+
     std::shared_ptr<DeathRecipientRef> AddObsDeathRecipient(const sptr<IRemoteObject> &dataObserver);
     void RemoveObsDeathRecipient(const sptr<IRemoteObject> &dataObserver, bool isForce = false);
 
     static constexpr uint32_t OBS_NUM_MAX = 50;
 
+    // nodeMutex_ serializes writers, HandleNotifyChange reads root_ through GetRoot without locking.
     ffrt::mutex nodeMutex_;
-    std::shared_ptr<Node> root_;
+    std::shared_ptr<const Node> root_;
     std::map<sptr<IRemoteObject>, std::shared_ptr<DeathRecipientRef>> obsRecipientRefs;
 };
 }  // namespace AAFwk
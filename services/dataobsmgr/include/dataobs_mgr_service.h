@@ -16,10 +16,12 @@
 #ifndef OHOS_ABILITY_RUNTIME_DATAOBS_MGR_SERVICE_H
 #define OHOS_ABILITY_RUNTIME_DATAOBS_MGR_SERVICE_H
 
+#include <atomic>
 #include <memory>
 #include <singleton.h>
 #include <thread_ex.h>
 #include <unordered_map>
+#include <vector>
 #include "cpp/mutex.h"
 
 #include "dataobs_mgr_inner.h"
@@ -66,13 +68,45 @@ public:
      */
     int Dump(int fd, const std::vector<std::u16string>& args) override;
 
+    /**
+     * @brief Set the window in which notifications of the same uri are merged.
+     * Init reads it from persist.sys.abilityms.dataObsCoalesceWindowMs.
+     * @param windowMs Indicates the window in milliseconds, 0 (the default) means notify immediately.
+     */
+    void SetCoalesceWindow(int64_t windowMs);
+
 private:
+    struct PendingChange {
+        ChangeInfo::ChangeType changeType;
+        Uri uri;
+        bool isPref = false;
+    };
+    struct PendingChanges {
+        // in arrival order, a change only merges into the last pending change of its uri.
+        std::vector<PendingChange> changes;
+        std::unordered_map<std::string, size_t> lastIndexes;
+        bool isFlushScheduled = false;
+    };
+
     bool Init();
     void Dump(const std::vector<std::u16string>& args, std::string& result) const;
     void ShowHelp(std::string& result) const;
+    void DumpStatistics(std::string& result) const;
     Status DeepCopyChangeInfo(const ChangeInfo &src, ChangeInfo &dst) const;
+    bool IsCoalesceEnabled() const;
+    Status CoalesceChange(const std::list<Uri> &uris, ChangeInfo::ChangeType changeType, bool isExt);
+    std::vector<PendingChange> TakePendingChanges();
+    void DeliverPendingChanges(const std::vector<PendingChange> &changes);
+    void FlushPendingChanges();
 private:
     static constexpr std::uint32_t TASK_COUNT_MAX = 50;
+    static constexpr int64_t DEFAULT_COALESCE_WINDOW_MS = 0;
+    ffrt::mutex pendingMutex_;
+    PendingChanges pendingChanges_;
+    std::atomic<int64_t> coalesceWindowMs_ = DEFAULT_COALESCE_WINDOW_MS;
+    std::atomic<uint64_t> receivedCount_ = 0;
+    std::atomic<uint64_t> coalescedCount_ = 0;
+    std::atomic<uint64_t> deliveredCount_ = 0;
     ffrt::mutex taskCountMutex_;
     std::uint32_t taskCount_ = 0;
     std::shared_ptr<TaskHandlerWrap> handler_;
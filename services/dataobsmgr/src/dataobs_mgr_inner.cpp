@@ -14,6 +14,9 @@
  */
 #include "dataobs_mgr_inner.h"
 
+#include <chrono>
+#include <cinttypes>
+
 #include "data_ability_observer_stub.h"
 #include "dataobs_mgr_errors.h"
 #include "hilog_tag_wrapper.h"
@@ -21,6 +24,13 @@
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+int64_t GetCurrentTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
 
 DataObsMgrInner::DataObsMgrInner() {}
 
@@ -92,8 +102,9 @@ int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, sptr<IDataAbilityO
 int DataObsMgrInner::HandleNotifyChange(const Uri &uri)
 {
     std::list<sptr<IDataAbilityObserver>> obsList;
-    std::lock_guard<ffrt::mutex> lock(innerMutex_);
+    std::shared_ptr<TaskHandlerWrap> handler;
     {
+        std::lock_guard<ffrt::mutex> lock(innerMutex_);
         auto obsPair = observers_.find(uri.ToString());
         if (obsPair == observers_.end()) {
             TAG_LOGD(AAFwkTag::DBOBSMGR, "there is no obs on the uri : %{public}s",
@@ -101,12 +112,24 @@ int DataObsMgrInner::HandleNotifyChange(const Uri &uri)
             return NO_OBS_FOR_URI;
         }
         obsList = obsPair->second;
+        handler = handler_;
     }
 
     for (auto &obs : obsList) {
-        if (obs != nullptr) {
-            obs->OnChange();
+        if (obs == nullptr) {
+            continue;
         }
+        if (handler == nullptr || obsList.size() == 1) {
+            DispatchOnChange(obs);
+            continue;
+        }
+        std::weak_ptr<DataObsMgrInner> thisWeakPtr(shared_from_this());
+        handler->SubmitTask([thisWeakPtr, obs]() {
+            auto dataObsMgrInner = thisWeakPtr.lock();
+            if (dataObsMgrInner) {
+                dataObsMgrInner->DispatchOnChange(obs);
+            }
+        });
     }
 
     TAG_LOGD(AAFwkTag::DBOBSMGR, "called end on the uri : %{public}s,obs num: %{public}zu",
@@ -114,6 +137,60 @@ int DataObsMgrInner::HandleNotifyChange(const Uri &uri)
     return NO_ERROR;
 }
 
+void DataObsMgrInner::SetHandler(const std::shared_ptr<TaskHandlerWrap> &handler)
+{
+    std::lock_guard<ffrt::mutex> lock(innerMutex_);
+    handler_ = handler;
+}
+
+void DataObsMgrInner::DispatchOnChange(const sptr<IDataAbilityObserver> &dataObserver)
+{
+    auto obj = dataObserver->AsObject();
+    if (!BeginDispatch(obj)) {
+        return;
+    }
+    dataObserver->OnChange();
+    EndDispatch(obj);
+}
+
+bool DataObsMgrInner::BeginDispatch(const sptr<IRemoteObject> &obj)
+{
+    if (obj == nullptr) {
+        return true;
+    }
+    std::lock_guard<ffrt::mutex> lock(dispatchMutex_);
+    auto &state = dispatching_[obj];
+    auto now = GetCurrentTimeMs();
+    if (state.inflight > 0 && now - state.startTime > OBS_DISPATCH_TIMEOUT_MS) {
+        TAG_LOGW(AAFwkTag::DBOBSMGR, "obs blocked for %{public}" PRId64 "ms, skip, inflight:%{public}u",
+            now - state.startTime, state.inflight);
+        return false;
+    }
+    if (state.inflight == 0) {
+        state.startTime = now;
+    }
+    state.inflight++;
+    return true;
+}
+
+void DataObsMgrInner::EndDispatch(const sptr<IRemoteObject> &obj)
+{
+    if (obj == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(dispatchMutex_);
+    auto it = dispatching_.find(obj);
+    if (it == dispatching_.end()) {
+        return;
+    }
+    if (it->second.inflight <= 1) {
+        dispatching_.erase(it);
+        return;
+    }
+    it->second.inflight--;
+    it->second.startTime = GetCurrentTimeMs();
+}
+
 void DataObsMgrInner::AddObsDeathRecipient(sptr<IDataAbilityObserver> dataObserver)
 {
     if ((dataObserver == nullptr) || dataObserver->AsObject() == nullptr) {
@@ -150,8 +227,9 @@ void DataObsMgrInner::RemoveObsDeathRecipient(sptr<IRemoteObject> dataObserver)
     if (it != obsRecipient_.end()) {
         it->first->RemoveDeathRecipient(it->second);
         obsRecipient_.erase(it);
-        return;
     }
+    std::lock_guard<ffrt::mutex> lock(dispatchMutex_);
+    dispatching_.erase(dataObserver);
 }
 
 void DataObsMgrInner::OnCallBackDied(const wptr<IRemoteObject> &remote)
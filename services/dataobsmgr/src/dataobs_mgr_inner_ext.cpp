@@ -14,6 +14,8 @@
  */
 #include "dataobs_mgr_inner_ext.h"
 
+#include <algorithm>
+
 #include "data_ability_observer_stub.h"
 #include "dataobs_mgr_errors.h"
 #include "hilog_tag_wrapper.h"
@@ -22,7 +24,7 @@
 namespace OHOS {
 namespace AAFwk {
 
-DataObsMgrInnerExt::DataObsMgrInnerExt() : root_(std::make_shared<Node>("root")) {}
+DataObsMgrInnerExt::DataObsMgrInnerExt() : root_(std::make_shared<const Node>("root")) {}
 
 DataObsMgrInnerExt::~DataObsMgrInnerExt() {}
 
@@ -39,13 +41,15 @@ Status DataObsMgrInnerExt::HandleRegisterObserver(Uri &uri, sptr<IDataAbilityObs
 
     std::vector<std::string> path = { uri.GetScheme(), uri.GetAuthority() };
     uri.GetPathSegments(path);
-    if (root_ != nullptr && !root_->AddObserver(path, 0, Entry(dataObserver, deathRecipientRef, isDescendants))) {
+    std::shared_ptr<const Node> newRoot;
+    if (!GetRoot()->AddObserver(path, 0, Entry(dataObserver, deathRecipientRef, isDescendants), newRoot)) {
         TAG_LOGE(AAFwkTag::DBOBSMGR,
             "The number of subscribers for this uri : %{public}s has reached the upper limits.",
             CommonUtils::Anonymous(uri.ToString()).c_str());
         RemoveObsDeathRecipient(dataObserver->AsObject());
         return DATAOBS_SERVICE_OBS_LIMMIT;
     }
+    PublishRoot(newRoot);
     return SUCCESS;
 }
 
@@ -59,8 +63,9 @@ Status DataObsMgrInnerExt::HandleUnregisterObserver(Uri &uri, sptr<IDataAbilityO
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
     std::vector<std::string> path = { uri.GetScheme(), uri.GetAuthority() };
     uri.GetPathSegments(path);
-    if (root_ != nullptr) {
-        root_->RemoveObserver(path, 0, dataObserver);
+    std::shared_ptr<const Node> newRoot;
+    if (GetRoot()->RemoveObserver(path, 0, dataObserver, newRoot)) {
+        PublishRoot(newRoot);
     }
     RemoveObsDeathRecipient(dataObserver->AsObject());
     return SUCCESS;
@@ -73,8 +78,9 @@ Status DataObsMgrInnerExt::HandleUnregisterObserver(sptr<IDataAbilityObserver> d
         return DATA_OBSERVER_IS_NULL;
     }
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-    if (root_ != nullptr) {
-        root_->RemoveObserver(dataObserver);
+    std::shared_ptr<const Node> newRoot;
+    if (GetRoot()->RemoveObserver(dataObserver, newRoot)) {
+        PublishRoot(newRoot);
     }
     RemoveObsDeathRecipient(dataObserver->AsObject(), true);
     return SUCCESS;
@@ -84,15 +90,13 @@ Status DataObsMgrInnerExt::HandleNotifyChange(const ChangeInfo &changeInfo)
 {
     ObsMap changeRes;
     std::vector<std::string> path;
-    {
-        std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-        for (auto &uri : changeInfo.uris_) {
-            path.clear();
-            path.emplace_back(uri.GetScheme());
-            path.emplace_back(uri.GetAuthority());
-            uri.GetPathSegments(path);
-            root_->GetObs(path, 0, uri, changeRes);
-        }
+    auto root = GetRoot();
+    for (auto &uri : changeInfo.uris_) {
+        path.clear();
+        path.emplace_back(uri.GetScheme());
+        path.emplace_back(uri.GetAuthority());
+        uri.GetPathSegments(path);
+        root->GetObs(path, 0, uri, changeRes);
     }
     if (changeRes.empty()) {
         TAG_LOGD(AAFwkTag::DBOBSMGR,
@@ -161,18 +165,33 @@ void DataObsMgrInnerExt::OnCallBackDied(const wptr<IRemoteObject> &remote)
         return;
     }
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-    if (root_ != nullptr) {
-        root_->RemoveObserver(dataObserver);
+    std::shared_ptr<const Node> newRoot;
+    if (GetRoot()->RemoveObserver(dataObserver, newRoot)) {
+        PublishRoot(newRoot);
     }
     RemoveObsDeathRecipient(dataObserver, true);
 }
 
+std::shared_ptr<const DataObsMgrInnerExt::Node> DataObsMgrInnerExt::GetRoot() const
+{
+    return std::atomic_load(&root_);
+}
+
+void DataObsMgrInnerExt::PublishRoot(std::shared_ptr<const Node> root)
+{
+    if (root == nullptr) {
+        root = std::make_shared<const Node>("root");
+    }
+    std::atomic_store(&root_, std::move(root));
+}
+
 DataObsMgrInnerExt::Node::Node(const std::string &name) : name_(name) {}
 
-void DataObsMgrInnerExt::Node::GetObs(const std::vector<std::string> &path, uint32_t index, Uri &uri, ObsMap &obsRes)
+void DataObsMgrInnerExt::Node::GetObs(const std::vector<std::string> &path, uint32_t index, Uri &uri,
+    ObsMap &obsRes) const
 {
     if (path.size() == index) {
-        for (auto entry : entrys_) {
+        for (const auto &entry : entrys_) {
             obsRes.try_emplace(entry.observer, std::list<Uri>()).first->second.push_back(uri);
         }
         return;
@@ -193,63 +212,118 @@ void DataObsMgrInnerExt::Node::GetObs(const std::vector<std::string> &path, uint
     return;
 }
 
-bool DataObsMgrInnerExt::Node::AddObserver(const std::vector<std::string> &path, uint32_t index, const Entry &entry)
+bool DataObsMgrInnerExt::Node::AddObserver(const std::vector<std::string> &path, uint32_t index,
+    const Entry &entry, std::shared_ptr<const Node> &result) const
 {
     if (path.size() == index) {
         if (entrys_.size() >= OBS_NUM_MAX) {
             return false;
         }
+        auto node = std::make_shared<Node>(*this);
         entry.deathRecipientRef->ref++;
-        entrys_.emplace_back(entry);
+        node->entrys_.emplace_back(entry);
+        result = node;
         return true;
     }
-    auto it = childrens_.try_emplace(path[index], std::make_shared<Node>(path[index])).first;
-    return it->second->AddObserver(path, ++index, entry);
+    std::shared_ptr<const Node> child;
+    auto it = childrens_.find(path[index]);
+    bool isAdded = (it != childrens_.end()) ? it->second->AddObserver(path, index + 1, entry, child) :
+        Node(path[index]).AddObserver(path, index + 1, entry, child);
+    if (!isAdded) {
+        return false;
+    }
+    auto node = std::make_shared<Node>(*this);
+    node->childrens_[path[index]] = child;
+    result = node;
+    return true;
 }
 
 bool DataObsMgrInnerExt::Node::RemoveObserver(const std::vector<std::string> &path, uint32_t index,
-    sptr<IDataAbilityObserver> dataObserver)
+    sptr<IDataAbilityObserver> dataObserver, std::shared_ptr<const Node> &result) const
 {
+    auto isTarget = [dataObserver](const Entry &entry) {
+        return entry.observer->AsObject() == dataObserver->AsObject();
+    };
+    std::shared_ptr<Node> node;
     if (index == path.size()) {
-        entrys_.remove_if([dataObserver](const Entry &entry) {
-            if (entry.observer->AsObject() != dataObserver->AsObject()) {
+        if (std::none_of(entrys_.begin(), entrys_.end(), isTarget)) {
+            return false;
+        }
+        node = std::make_shared<Node>(*this);
+        node->entrys_.remove_if([&isTarget](const Entry &entry) {
+            if (!isTarget(entry)) {
                 return false;
             }
             entry.deathRecipientRef->ref--;
             return true;
         });
-        return entrys_.empty() && childrens_.empty();
-    }
-    auto child = childrens_.find(path[index]);
-    if (child != childrens_.end() && child->second->RemoveObserver(path, ++index, dataObserver)) {
-        childrens_.erase(child);
+    } else {
+        auto it = childrens_.find(path[index]);
+        std::shared_ptr<const Node> child;
+        if (it == childrens_.end() || !it->second->RemoveObserver(path, index + 1, dataObserver, child)) {
+            return false;
+        }
+        node = std::make_shared<Node>(*this);
+        if (child == nullptr) {
+            node->childrens_.erase(path[index]);
+        } else {
+            node->childrens_[path[index]] = child;
+        }
     }
-    return entrys_.empty() && childrens_.empty();
+    result = node->IsEmpty() ? nullptr : node;
+    return true;
 }
 
-bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IRemoteObject> dataObserver)
+bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IRemoteObject> dataObserver,
+    std::shared_ptr<const Node> &result) const
 {
-    for (auto child = childrens_.begin(); child != childrens_.end();) {
-        if (child->second->RemoveObserver(dataObserver)) {
-            child = childrens_.erase(child);
+    std::shared_ptr<Node> node;
+    for (const auto &[name, child] : childrens_) {
+        std::shared_ptr<const Node> newChild;
+        if (!child->RemoveObserver(dataObserver, newChild)) {
+            continue;
+        }
+        if (node == nullptr) {
+            node = std::make_shared<Node>(*this);
+        }
+        if (newChild == nullptr) {
+            node->childrens_.erase(name);
         } else {
-            child++;
+            node->childrens_[name] = newChild;
         }
     }
-    entrys_.remove_if([dataObserver](const Entry &entry) {
-        if (entry.observer->AsObject() != dataObserver) {
-            return false;
+    auto isTarget = [dataObserver](const Entry &entry) {
+        return entry.observer->AsObject() == dataObserver;
+    };
+    if (std::any_of(entrys_.begin(), entrys_.end(), isTarget)) {
+        if (node == nullptr) {
+            node = std::make_shared<Node>(*this);
         }
-        entry.deathRecipientRef->ref--;
-        return true;
-    });
-    return entrys_.empty() && childrens_.empty();
+        node->entrys_.remove_if([&isTarget](const Entry &entry) {
+            if (!isTarget(entry)) {
+                return false;
+            }
+            entry.deathRecipientRef->ref--;
+            return true;
+        });
+    }
+    if (node == nullptr) {
+        return false;
+    }
+    result = node->IsEmpty() ? nullptr : node;
+    return true;
 }
 
-inline bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IDataAbilityObserver> dataObserver)
+inline bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IDataAbilityObserver> dataObserver,
+    std::shared_ptr<const Node> &result) const
 {
     auto obs = dataObserver->AsObject();
-    return obs != nullptr && RemoveObserver(obs);
+    return obs != nullptr && RemoveObserver(obs, result);
+}
+
+inline bool DataObsMgrInnerExt::Node::IsEmpty() const
+{
+    return entrys_.empty() && childrens_.empty();
 }
 
 } // namespace AAFwk
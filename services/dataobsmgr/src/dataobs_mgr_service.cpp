@@ -15,22 +15,29 @@
 
 #include "dataobs_mgr_service.h"
 
+#include <cinttypes>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unistd.h>
+#include <unordered_set>
 #include "string_ex.h"
 
 #include "dataobs_mgr_errors.h"
 #include "hilog_tag_wrapper.h"
 #include "if_system_ability_manager.h"
 #include "ipc_skeleton.h"
+#include "parameters.h"
 #include "system_ability_definition.h"
 #include "common_utils.h"
 #include "securec.h"
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+const std::string COALESCE_WINDOW_MS = "persist.sys.abilityms.dataObsCoalesceWindowMs";
+}
+
 const bool REGISTER_RESULT =
     SystemAbility::MakeAndRegisterAbility(DelayedSingleton<DataObsMgrService>::GetInstance().get());
 
@@ -70,12 +77,20 @@ void DataObsMgrService::OnStart()
 bool DataObsMgrService::Init()
 {
     handler_ = TaskHandlerWrap::GetFfrtHandler();
+    if (dataObsMgrInner_ != nullptr) {
+        dataObsMgrInner_->SetHandler(handler_);
+    }
+    SetCoalesceWindow(OHOS::system::GetIntParameter<int64_t>(COALESCE_WINDOW_MS, DEFAULT_COALESCE_WINDOW_MS));
+    TAG_LOGI(AAFwkTag::DBOBSMGR, "coalesce window:%{public}" PRId64 "ms", coalesceWindowMs_.load());
     return true;
 }
 
 void DataObsMgrService::OnStop()
 {
     TAG_LOGI(AAFwkTag::DBOBSMGR, "stop service");
+    if (dataObsMgrInner_ != nullptr) {
+        dataObsMgrInner_->SetHandler(nullptr);
+    }
     handler_.reset();
     state_ = DataObsServiceRunningState::STATE_NOT_START;
 }
@@ -157,6 +172,12 @@ int DataObsMgrService::NotifyChange(const Uri &uri)
         return DATAOBS_SERVICE_INNER_IS_NULL;
     }
 
+    ChangeInfo changeInfo = { ChangeInfo::ChangeType::OTHER, { uri } };
+    receivedCount_++;
+    if (IsCoalesceEnabled()) {
+        return CoalesceChange(changeInfo.uris_, changeInfo.changeType_, false);
+    }
+
     {
         std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
         if (taskCount_ >= TASK_COUNT_MAX) {
@@ -167,8 +188,11 @@ int DataObsMgrService::NotifyChange(const Uri &uri)
         ++taskCount_;
     }
 
-    ChangeInfo changeInfo = { ChangeInfo::ChangeType::OTHER, { uri } };
-    handler_->SubmitTask([this, uri, changeInfo]() {
+    // the changes merged before this one are delivered ahead of it.
+    auto pendingChanges = TakePendingChanges();
+    deliveredCount_++;
+    handler_->SubmitTask([this, uri, changeInfo, pendingChanges]() {
+        DeliverPendingChanges(pendingChanges);
         if (const_cast<Uri &>(uri).GetScheme() == SHARE_PREFERENCES) {
             dataObsMgrInnerPref_->HandleNotifyChange(uri);
         } else {
@@ -266,6 +290,12 @@ Status DataObsMgrService::NotifyChangeExt(const ChangeInfo &changeInfo)
             dataObsMgrInner_ == nullptr);
         return DATAOBS_SERVICE_INNER_IS_NULL;
     }
+    receivedCount_++;
+    if (IsCoalesceEnabled() && changeInfo.data_ == nullptr && changeInfo.size_ == 0 &&
+        changeInfo.valueBuckets_.empty()) {
+        return CoalesceChange(changeInfo.uris_, changeInfo.changeType_, true);
+    }
+
     ChangeInfo changes;
     Status result = DeepCopyChangeInfo(changeInfo, changes);
     if (result != SUCCESS) {
@@ -288,7 +318,10 @@ Status DataObsMgrService::NotifyChangeExt(const ChangeInfo &changeInfo)
         ++taskCount_;
     }
 
-    handler_->SubmitTask([this, changes]() {
+    auto pendingChanges = TakePendingChanges();
+    deliveredCount_ += changes.uris_.size();
+    handler_->SubmitTask([this, changes, pendingChanges]() {
+        DeliverPendingChanges(pendingChanges);
         dataObsMgrInnerExt_->HandleNotifyChange(changes);
         for (auto &uri : changes.uris_) {
             dataObsMgrInner_->HandleNotifyChange(uri);
@@ -300,6 +333,129 @@ Status DataObsMgrService::NotifyChangeExt(const ChangeInfo &changeInfo)
     return SUCCESS;
 }
 
+void DataObsMgrService::SetCoalesceWindow(int64_t windowMs)
+{
+    coalesceWindowMs_ = windowMs < 0 ? 0 : windowMs;
+}
+
+bool DataObsMgrService::IsCoalesceEnabled() const
+{
+    return coalesceWindowMs_ > 0;
+}
+
+Status DataObsMgrService::CoalesceChange(const std::list<Uri> &uris, ChangeInfo::ChangeType changeType, bool isExt)
+{
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    std::vector<PendingChange> newChanges;
+    std::unordered_set<std::string> keys;
+    uint64_t coalescedCount = 0;
+    for (auto &uri : uris) {
+        auto key = uri.ToString();
+        bool isPref = !isExt && const_cast<Uri &>(uri).GetScheme() == SHARE_PREFERENCES;
+        auto iter = pendingChanges_.lastIndexes.find(key);
+        if (!keys.insert(key).second || (iter != pendingChanges_.lastIndexes.end() &&
+            pendingChanges_.changes[iter->second].changeType == changeType &&
+            pendingChanges_.changes[iter->second].isPref == isPref)) {
+            coalescedCount++;
+            continue;
+        }
+        newChanges.push_back({ changeType, uri, isPref });
+    }
+    if (pendingChanges_.changes.size() + newChanges.size() > ChangeInfo::LIST_MAX_COUNT) {
+        TAG_LOGE(AAFwkTag::DBOBSMGR, "The number of pending uris has reached the upper limit, num:%{public}zu",
+            pendingChanges_.changes.size());
+        return DATAOBS_SERVICE_TASK_LIMMIT;
+    }
+    bool needFlush = !pendingChanges_.isFlushScheduled && !newChanges.empty();
+    if (needFlush) {
+        std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
+        if (taskCount_ >= TASK_COUNT_MAX) {
+            TAG_LOGE(AAFwkTag::DBOBSMGR, "The number of task has reached the upper limit, num of uris:%{public}zu",
+                uris.size());
+            return DATAOBS_SERVICE_TASK_LIMMIT;
+        }
+        ++taskCount_;
+    }
+
+    for (auto &change : newChanges) {
+        pendingChanges_.lastIndexes[change.uri.ToString()] = pendingChanges_.changes.size();
+        pendingChanges_.changes.push_back(std::move(change));
+    }
+    coalescedCount_ += coalescedCount;
+
+    if (needFlush) {
+        pendingChanges_.isFlushScheduled = true;
+        std::weak_ptr<DataObsMgrService> weak = weak_from_this();
+        handler_->SubmitTask([weak]() {
+            auto service = weak.lock();
+            if (service != nullptr) {
+                service->FlushPendingChanges();
+            }
+        }, coalesceWindowMs_.load());
+    }
+    return SUCCESS;
+}
+
+std::vector<DataObsMgrService::PendingChange> DataObsMgrService::TakePendingChanges()
+{
+    std::vector<PendingChange> changes;
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    changes.swap(pendingChanges_.changes);
+    pendingChanges_.lastIndexes.clear();
+    return changes;
+}
+
+void DataObsMgrService::DeliverPendingChanges(const std::vector<PendingChange> &changes)
+{
+    if (changes.empty()) {
+        return;
+    }
+    // observers without a change type are notified once per uri, ext observers get the changes in
+    // arrival order with the adjacent ones of the same type in one batch.
+    std::unordered_set<std::string> notifiedUris;
+    ChangeInfo changeInfo = { changes.front().changeType, {} };
+    for (auto &change : changes) {
+        if (change.isPref) {
+            dataObsMgrInnerPref_->HandleNotifyChange(change.uri);
+            continue;
+        }
+        if (notifiedUris.insert(change.uri.ToString()).second) {
+            dataObsMgrInner_->HandleNotifyChange(change.uri);
+        }
+        if (change.changeType != changeInfo.changeType_ && !changeInfo.uris_.empty()) {
+            dataObsMgrInnerExt_->HandleNotifyChange(changeInfo);
+            changeInfo.uris_.clear();
+        }
+        changeInfo.changeType_ = change.changeType;
+        changeInfo.uris_.push_back(change.uri);
+    }
+    if (!changeInfo.uris_.empty()) {
+        dataObsMgrInnerExt_->HandleNotifyChange(changeInfo);
+    }
+    deliveredCount_ += changes.size();
+    TAG_LOGD(AAFwkTag::DBOBSMGR, "deliver pending changes, num of uris:%{public}zu", changes.size());
+}
+
+void DataObsMgrService::FlushPendingChanges()
+{
+    std::vector<PendingChange> changes;
+    bool isFlushScheduled = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+        changes.swap(pendingChanges_.changes);
+        pendingChanges_.lastIndexes.clear();
+        isFlushScheduled = pendingChanges_.isFlushScheduled;
+        pendingChanges_.isFlushScheduled = false;
+    }
+    DeliverPendingChanges(changes);
+
+    // the scheduled flush holds a task slot, an explicit or stale flush must not release it twice.
+    if (isFlushScheduled) {
+        std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
+        --taskCount_;
+    }
+}
+
 int DataObsMgrService::Dump(int fd, const std::vector<std::u16string>& args)
 {
     std::string result;
@@ -321,6 +477,10 @@ void DataObsMgrService::Dump(const std::vector<std::u16string>& args, std::strin
     }
 
     std::string optionKey = Str16ToStr8(args[0]);
+    if (optionKey == "-s") {
+        DumpStatistics(result);
+        return;
+    }
     if (optionKey != "-h") {
         result.append("error: unkown option.\n");
     }
@@ -331,7 +491,17 @@ void DataObsMgrService::ShowHelp(std::string& result) const
 {
     result.append("Usage:\n")
         .append("-h                          ")
-        .append("help text for the tool\n");
+        .append("help text for the tool\n")
+        .append("-s                          ")
+        .append("statistics of the notifications\n");
+}
+
+void DataObsMgrService::DumpStatistics(std::string& result) const
+{
+    result.append("coalesce window(ms): ").append(std::to_string(coalesceWindowMs_.load())).append("\n")
+        .append("received: ").append(std::to_string(receivedCount_.load())).append("\n")
+        .append("coalesced: ").append(std::to_string(coalescedCount_.load())).append("\n")
+        .append("delivered: ").append(std::to_string(deliveredCount_.load())).append("\n");
 }
 }  // namespace AAFwk
 }  // namespace OHOS
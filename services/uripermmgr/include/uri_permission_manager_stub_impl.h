@@ -18,7 +18,10 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "app_mgr_interface.h"
@@ -147,6 +150,12 @@ private:
 
     bool IsDistributedSubDirUri(const std::string &inputUri, const std::string &cachedUri);
 
+    void SyncUriIndex(const std::string &uri);
+
+    void AddDistributedUriIndex(const std::string &uri);
+
+    void RemoveDistributedUriIndex(const std::string &uri);
+
     class ProxyDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
         explicit ProxyDeathRecipient(ClearProxyCallback&& proxy) : proxy_(proxy) {}
@@ -157,8 +166,19 @@ private:
         ClearProxyCallback proxy_;
     };
 
+    struct UriTrieNode {
+        std::map<std::string, std::unique_ptr<UriTrieNode>> children;
+        std::set<std::string> uris;
+    };
+
 private:
     std::map<std::string, std::list<GrantInfo>> uriMap_;
+    // secondary indexes of uriMap_, kept in sync by SyncUriIndex
+    std::unordered_map<uint32_t, std::unordered_set<std::string>> tokenUriIndex_;
+    std::unordered_map<std::string, std::unordered_set<uint32_t>> uriTokenIndex_;
+    std::unordered_map<std::string, std::unordered_set<std::string>> authorityUriIndex_;
+    // distributed uris by path segment, used to find the granted ancestor directory
+    UriTrieNode distributedUriTrie_;
     std::mutex mutex_;
     std::mutex mgrMutex_;
     sptr<AppExecFwk::IAppMgr> appMgr_ = nullptr;
@@ -45,6 +45,21 @@ constexpr uint32_t FLAG_READ_WRITE_URI = Want::FLAG_AUTH_READ_URI_PERMISSION | W
 constexpr uint32_t FLAG_WRITE_URI = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
 constexpr uint32_t FLAG_READ_URI = Want::FLAG_AUTH_READ_URI_PERMISSION;
 constexpr const char* CLOUND_DOCS_URI_MARK = "?networkid=";
+constexpr char URI_PATH_SEPARATOR = '/';
+
+std::vector<std::string> SplitUriPath(const std::string &uriPath)
+{
+    std::vector<std::string> segments;
+    size_t begin = 0;
+    size_t end = uriPath.find(URI_PATH_SEPARATOR);
+    while (end != std::string::npos) {
+        segments.emplace_back(uriPath.substr(begin, end - begin));
+        begin = end + 1;
+        end = uriPath.find(URI_PATH_SEPARATOR, begin);
+    }
+    segments.emplace_back(uriPath.substr(begin));
+    return segments;
+}
 }
 
 bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, uint32_t flag, uint32_t tokenId)
@@ -90,10 +105,22 @@ bool UriPermissionManagerStubImpl::VerifySubDirUriPermission(const std::string &
         return false;
     }
 
-    for (auto search = uriMap_.rbegin(); search != uriMap_.rend(); ++search) {
-        if (!IsDistributedSubDirUri(uriStr, search->first)) {
+    // the shallowest granted ancestor has the greatest uri string, and decides the result as before
+    auto segments = SplitUriPath(uriStr.substr(0, iPos));
+    const UriTrieNode *node = &distributedUriTrie_;
+    for (size_t index = 0; index + 1 < segments.size(); index++) {
+        auto child = node->children.find(segments[index]);
+        if (child == node->children.end()) {
+            break;
+        }
+        node = child->second.get();
+        if (node->uris.empty()) {
             continue;
         }
+        auto search = uriMap_.find(*node->uris.rbegin());
+        if (search == uriMap_.end()) {
+            break;
+        }
         auto& list = search->second;
         for (auto it = list.begin(); it != list.end(); it++) {
             if ((it->targetTokenId == tokenId) && ((it->flag | FLAG_READ_URI) & newFlag) != 0) {
@@ -274,6 +301,7 @@ int UriPermissionManagerStubImpl::AddTempUriPermission(const std::string &uri, u
         TAG_LOGI(AAFwkTag::URIPERMMGR, "Insert an uri r/w permission.");
         std::list<GrantInfo> infoList = { info };
         uriMap_.emplace(uri, infoList);
+        SyncUriIndex(uri);
         return ERR_OK;
     }
     auto& infoList = search->second;
@@ -304,6 +332,7 @@ int UriPermissionManagerStubImpl::AddTempUriPermission(const std::string &uri, u
     }
     TAG_LOGI(AAFwkTag::URIPERMMGR, "Insert a new uri permission record.");
     infoList.emplace_back(info);
+    SyncUriIndex(uri);
     return ERR_OK;
 }
 
@@ -491,7 +520,16 @@ void UriPermissionManagerStubImpl::RemoveUriRecord(std::vector<std::string> &uri
     int32_t abilityId)
 {
     std::lock_guard<std::mutex> guard(mutex_);
-    for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
+    auto tokenUris = tokenUriIndex_.find(tokenId);
+    if (tokenUris == tokenUriIndex_.end()) {
+        return;
+    }
+    std::vector<std::string> uris(tokenUris->second.begin(), tokenUris->second.end());
+    for (const auto &uri : uris) {
+        auto iter = uriMap_.find(uri);
+        if (iter == uriMap_.end()) {
+            continue;
+        }
         auto& list = iter->second;
         for (auto it = list.begin(); it != list.end(); it++) {
             if (it->targetTokenId != tokenId || !it->RemoveAbilityId(abilityId) || !it->autoRemove) {
@@ -507,10 +545,9 @@ void UriPermissionManagerStubImpl::RemoveUriRecord(std::vector<std::string> &uri
             break;
         }
         if (list.empty()) {
-            uriMap_.erase(iter++);
-            continue;
+            uriMap_.erase(iter);
         }
-        ++iter;
+        SyncUriIndex(uri);
     }
 }
 
@@ -539,16 +576,35 @@ int UriPermissionManagerStubImpl::RevokeAllUriPermissions(uint32_t tokenId)
     std::map<uint32_t, std::vector<std::string>> uriLists;
     {
         std::lock_guard<std::mutex> guard(mutex_);
-        for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
+        std::vector<std::string> authorityUris;
+        for (const auto &[authority, uris] : authorityUriIndex_) {
             uint32_t authorityTokenId = 0;
-            auto authority = Uri(iter->first).GetAuthority();
             // uri belong to target tokenId.
             auto ret = UPMSUtils::GetTokenIdByBundleName(authority, 0, authorityTokenId);
             if (ret == ERR_OK && authorityTokenId == tokenId) {
-                for (const auto &record : iter->second) {
-                    uriLists[record.targetTokenId].emplace_back(iter->first);
-                }
-                uriMap_.erase(iter++);
+                authorityUris.insert(authorityUris.end(), uris.begin(), uris.end());
+            }
+        }
+        for (const auto &uri : authorityUris) {
+            auto iter = uriMap_.find(uri);
+            if (iter == uriMap_.end()) {
+                continue;
+            }
+            for (const auto &record : iter->second) {
+                uriLists[record.targetTokenId].emplace_back(iter->first);
+            }
+            uriMap_.erase(iter);
+            SyncUriIndex(uri);
+        }
+
+        auto tokenUris = tokenUriIndex_.find(tokenId);
+        std::vector<std::string> uris;
+        if (tokenUris != tokenUriIndex_.end()) {
+            uris.assign(tokenUris->second.begin(), tokenUris->second.end());
+        }
+        for (const auto &uri : uris) {
+            auto iter = uriMap_.find(uri);
+            if (iter == uriMap_.end()) {
                 continue;
             }
             auto& list = iter->second;
@@ -562,10 +618,9 @@ int UriPermissionManagerStubImpl::RevokeAllUriPermissions(uint32_t tokenId)
                 it++;
             }
             if (list.empty()) {
-                uriMap_.erase(iter++);
-                continue;
+                uriMap_.erase(iter);
             }
-            iter++;
+            SyncUriIndex(uri);
         }
     }
 
@@ -624,10 +679,106 @@ int UriPermissionManagerStubImpl::RevokeUriPermissionManually(const Uri &uri, co
         if (list.empty()) {
             uriMap_.erase(search);
         }
+        SyncUriIndex(uriStr);
     }
     return DeleteShareFile(targetTokenId, uriList);
 }
 
+void UriPermissionManagerStubImpl::SyncUriIndex(const std::string &uri)
+{
+    std::unordered_set<uint32_t> tokenIds;
+    auto search = uriMap_.find(uri);
+    if (search != uriMap_.end()) {
+        for (const auto &info : search->second) {
+            tokenIds.insert(info.fromTokenId);
+            tokenIds.insert(info.targetTokenId);
+        }
+    }
+
+    auto indexed = uriTokenIndex_.find(uri);
+    bool isIndexed = (indexed != uriTokenIndex_.end());
+    if (isIndexed) {
+        for (auto tokenId : indexed->second) {
+            auto tokenUris = tokenUriIndex_.find(tokenId);
+            if (tokenIds.count(tokenId) != 0 || tokenUris == tokenUriIndex_.end()) {
+                continue;
+            }
+            tokenUris->second.erase(uri);
+            if (tokenUris->second.empty()) {
+                tokenUriIndex_.erase(tokenUris);
+            }
+        }
+    }
+    for (auto tokenId : tokenIds) {
+        tokenUriIndex_[tokenId].insert(uri);
+    }
+
+    if (search == uriMap_.end()) {
+        if (!isIndexed) {
+            return;
+        }
+        uriTokenIndex_.erase(indexed);
+        auto authorityUris = authorityUriIndex_.find(Uri(uri).GetAuthority());
+        if (authorityUris != authorityUriIndex_.end()) {
+            authorityUris->second.erase(uri);
+            if (authorityUris->second.empty()) {
+                authorityUriIndex_.erase(authorityUris);
+            }
+        }
+        RemoveDistributedUriIndex(uri);
+        return;
+    }
+    if (!isIndexed) {
+        authorityUriIndex_[Uri(uri).GetAuthority()].insert(uri);
+        AddDistributedUriIndex(uri);
+    }
+    uriTokenIndex_[uri] = std::move(tokenIds);
+}
+
+void UriPermissionManagerStubImpl::AddDistributedUriIndex(const std::string &uri)
+{
+    auto pos = uri.find(CLOUND_DOCS_URI_MARK);
+    if (pos == std::string::npos) {
+        return;
+    }
+    UriTrieNode *node = &distributedUriTrie_;
+    for (const auto &segment : SplitUriPath(uri.substr(0, pos))) {
+        auto &child = node->children[segment];
+        if (child == nullptr) {
+            child = std::make_unique<UriTrieNode>();
+        }
+        node = child.get();
+    }
+    node->uris.insert(uri);
+}
+
+void UriPermissionManagerStubImpl::RemoveDistributedUriIndex(const std::string &uri)
+{
+    auto pos = uri.find(CLOUND_DOCS_URI_MARK);
+    if (pos == std::string::npos) {
+        return;
+    }
+    std::vector<std::pair<UriTrieNode *, std::string>> path;
+    UriTrieNode *node = &distributedUriTrie_;
+    for (const auto &segment : SplitUriPath(uri.substr(0, pos))) {
+        auto child = node->children.find(segment);
+        if (child == node->children.end()) {
+            return;
+        }
+        path.emplace_back(node, segment);
+        node = child->second.get();
+    }
+    node->uris.erase(uri);
+    // prune the branch which holds no uri any more
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        auto child = it->first->children.find(it->second);
+        if (!child->second->uris.empty() || !child->second->children.empty()) {
+            break;
+        }
+        it->first->children.erase(child);
+    }
+}
+
 int32_t UriPermissionManagerStubImpl::DeleteShareFile(uint32_t targetTokenId, const std::vector<std::string> &uriVec)
 {
     ConnectManager(storageManager_, STORAGE_MANAGER_MANAGER_ID);
@@ -78,7 +78,7 @@ bool DoSomethingInterestingWithMyAPI(const char* data, size_t size)
     executer->DoProcess(param);
     std::shared_ptr<AAFwk::TaskHandlerWrap> taskHandler;
     executer->SetTaskHandler(taskHandler);
-    executer->GetInterceptorMapCopy();
+    executer->GetInterceptorStats();
     return true;
 }
 }
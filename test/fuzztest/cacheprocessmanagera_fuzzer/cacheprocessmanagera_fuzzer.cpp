@@ -90,7 +90,7 @@ void CacheProcessManagerFuzztestFunc1(bool boolParam, std::string &stringParam,
     mgr->CheckAndCacheProcess(nullptr); // nullptr
     mgr->maxProcCacheNum_ = int32Param;
     mgr->CheckAndCacheProcess(appRecord2); // not cached
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->CheckAndCacheProcess(appRecord2); // cached
 
     mgr->CheckAndNotifyCachedState(nullptr);
@@ -108,27 +108,27 @@ void CacheProcessManagerFuzztestFunc2(bool boolParam, std::string &stringParam,
     std::shared_ptr<ApplicationInfo> appInfo = std::make_shared<ApplicationInfo>();
     std::shared_ptr<AppRunningRecord> appRecord2 = std::make_shared<AppRunningRecord>(appInfo, int32Param, stringParam);
     mgr->IsCachedProcess(appRecord2); // not cached called.
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->IsCachedProcess(appRecord2); // cached called.
     mgr->cachedAppRecordQueue_.clear(); // clear
 
     mgr->maxProcCacheNum_ = int32Param;
     mgr->OnProcessKilled(nullptr); // nullptr called.
     mgr->OnProcessKilled(appRecord2); // not cached called.
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->OnProcessKilled(appRecord2); // cached called.
     mgr->cachedAppRecordQueue_.clear(); // clear
 
     mgr->maxProcCacheNum_ = int32Param;
     mgr->ReuseCachedProcess(nullptr);
     mgr->ReuseCachedProcess(appRecord2); // not cached
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->ReuseCachedProcess(appRecord2); // cached
     mgr->cachedAppRecordQueue_.clear(); // clear
 
     std::shared_ptr<AppMgrServiceInner> serviceInner = std::make_shared<AppMgrServiceInner>();
     mgr->SetAppMgr(serviceInner); // appInner not null
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->ReuseCachedProcess(appRecord2); // cached
 
     mgr->IsAppSupportProcessCache(nullptr); // null ptr check
@@ -174,7 +174,7 @@ void CacheProcessManagerFuzztestFunc3(bool boolParam, std::string &stringParam,
     mgr->IsAppShouldCache(nullptr); // called.
     mgr->maxProcCacheNum_ = int32Param;
     mgr->IsAppShouldCache(appRecord1); // not ccached called.
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
     mgr->IsAppShouldCache(appRecord1); //ccached called.
 
     mgr->IsAppAbilitiesEmpty(nullptr); // called
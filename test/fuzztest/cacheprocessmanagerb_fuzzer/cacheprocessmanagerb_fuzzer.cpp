@@ -73,7 +73,7 @@ void CacheProcessManagerFuzztestFunc1(bool boolParam, std::string &stringParam,
     std::shared_ptr<ApplicationInfo> appInfo = std::make_shared<ApplicationInfo>();
     std::shared_ptr<AppRunningRecord> appRecord1 = std::make_shared<AppRunningRecord>(appInfo, int32Param, stringParam);
     std::shared_ptr<AppRunningRecord> appRecord2 = std::make_shared<AppRunningRecord>(nullptr, int32Param, stringParam);
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
     mgr->RemoveCacheRecord(appRecord1); // called branch cached.
     mgr->RemoveCacheRecord(appRecord2); // called branch not cached.
     mgr->cachedAppRecordQueue_.clear();
@@ -82,8 +82,8 @@ void CacheProcessManagerFuzztestFunc1(bool boolParam, std::string &stringParam,
     mgr->ShrinkAndKillCache(); // called branch
     mgr->maxProcCacheNum_ = 1; // 1 means maxProcCacheNum
     mgr->ShrinkAndKillCache(); // called branch current < maxProcCacheNum.
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->ShrinkAndKillCache(); // called branch current > maxProcCacheNum.
     mgr->cachedAppRecordQueue_.clear();
 
@@ -94,8 +94,8 @@ void CacheProcessManagerFuzztestFunc1(bool boolParam, std::string &stringParam,
     mgr->SetAppMgr(serviceInner2);
     mgr->KillProcessByRecord(appRecord2); // called branch appRecord not null.
 
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord2);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord2);
     mgr->PrintCacheQueue(); // called branch apprecord exist,
     mgr->cachedAppRecordQueue_.clear();
     mgr->PrintCacheQueue(); // called branch no apprecord.
@@ -121,11 +121,11 @@ void CacheProcessManagerFuzztestFunc2(bool boolParam, std::string &stringParam,
     mgr->PrepareActivateCache(appRecord1);
 
     mgr->SetAppMgr(serviceInner1);
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
     mgr->PrepareActivateCache(appRecord1); // // branch cached & appMgr null.
     std::shared_ptr<AppMgrServiceInner> serviceInner2 = std::make_shared<AppMgrServiceInner>();
     mgr->SetAppMgr(serviceInner2);
-    mgr->cachedAppRecordQueue_.emplace_back(appRecord1);
+    mgr->cachedAppRecordQueue_.push_back(appRecord1);
     mgr->PrepareActivateCache(appRecord1); // branch cached & appMgr not null.
 }
 
@@ -217,6 +217,7 @@ HWTEST_F(AbilityManagerServiceDumpTest, AbilityManagerService_OnAppStateChanged_
         missionListManager->Init();
         abilityMs_->subManagersHelper_->currentMissionListManager_ = missionListManager;
         missionListManager->terminateAbilityList_.push_back(abilityRecord);
+        missionListManager->terminateTokenIndex_.Add(abilityRecord);
 
         abilityMs_->subManagersHelper_->currentDataAbilityManager_ = std::make_shared<DataAbilityManager>();
         EXPECT_NE(abilityMs_->subManagersHelper_->currentDataAbilityManager_, nullptr);
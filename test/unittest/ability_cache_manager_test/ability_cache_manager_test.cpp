@@ -664,5 +664,42 @@ HWTEST_F(AbilityCacheManagerTest, AbilityCacheManagerDeleteInvalidRecord_001, Te
     rec = OHOS::AAFwk::AbilityCacheManager::GetInstance().Get(abilityRequest);
     EXPECT_EQ(rec, nullptr);
 }
+
+/**
+ * @tc.name: AbilityCacheManagerPutRefreshTest_001
+ * @tc.desc: Put an ability record again to refresh it, then exceed the dev capacity,
+ *           eliminate the least recently used ability record
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AbilityCacheManagerTest, AbilityCacheManagerPutRefreshTest_001, TestSize.Level0)
+{
+    auto &cacheManager = OHOS::AAFwk::AbilityCacheManager::GetInstance();
+    cacheManager.Init(2, 5);
+    Want want;
+    std::vector<std::shared_ptr<AbilityRecord>> abilityRecords;
+    for (uint32_t i = 1; i <= 3; i++) {
+        OHOS::AppExecFwk::AbilityInfo abilityInfo;
+        abilityInfo.moduleName = "TestModuleName" + std::to_string(i);
+        abilityInfo.bundleName = "TestBundleName" + std::to_string(i);
+        OHOS::AppExecFwk::ApplicationInfo applicationInfo;
+        applicationInfo.accessTokenId = i;
+        auto abilityRecord = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+        abilityRecord->Init();
+        abilityRecords.push_back(abilityRecord);
+    }
+    EXPECT_EQ(cacheManager.Put(abilityRecords[0]), nullptr);
+    EXPECT_EQ(cacheManager.Put(abilityRecords[1]), nullptr);
+    EXPECT_EQ(cacheManager.Put(abilityRecords[0]), nullptr);
+    auto rec = cacheManager.Put(abilityRecords[2]);
+    EXPECT_EQ(rec, abilityRecords[1]);
+    EXPECT_EQ(cacheManager.FindRecordByToken(abilityRecords[1]->GetToken()), nullptr);
+    EXPECT_EQ(cacheManager.FindRecordByToken(abilityRecords[0]->GetToken()), abilityRecords[0]);
+    EXPECT_EQ(cacheManager.GetAbilityList().size(), 2u);
+
+    cacheManager.Remove(abilityRecords[0]);
+    cacheManager.Remove(abilityRecords[2]);
+    EXPECT_EQ(cacheManager.FindRecordByToken(abilityRecords[0]->GetToken()), nullptr);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -1410,6 +1410,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_StartAbilityLocked_001, Test
     abilityRecord->currentState_ = AbilityState::ACTIVE;
     abilityRecord->SetPreAbilityRecord(serviceRecord1_);
     connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int res = connectManager->StartAbilityLocked(abilityRequest);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1432,6 +1433,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetOrCreateServiceRecord_001
     bool isLoadedAbility = false;
     abilityRequest.abilityInfo.name = AbilityConfig::LAUNCHER_ABILITY_NAME;
     connectManager->serviceMap_.clear();
+    connectManager->serviceTokenIndex_.Clear();
     connectManager->GetOrCreateServiceRecord(abilityRequest, isCreatedByConnect, targetService, isLoadedAbility);
 }
 
@@ -1467,6 +1469,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ConnectAbilityLocked_001, Te
     abilityRecord->currentState_ = AbilityState::ACTIVE;
     abilityRecord->AddConnectRecordToList(connection1);
     connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->connectMap_.clear();
     connectManager->ConnectAbilityLocked(abilityRequest, connect, callerToken);
     abilityRecord->AddConnectRecordToList(connection2);
@@ -1490,6 +1493,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_AttachAbilityThreadLocked_00
     sptr<IAbilityScheduler> scheduler = nullptr;
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->eventHandler_ = nullptr;
     connectManager->taskHandler_ = nullptr;
     int res = connectManager->AttachAbilityThreadLocked(scheduler, token);
@@ -1519,6 +1523,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnAppStateChanged_001, TestS
     abilityRecord->abilityInfo_.uid = uid;
     info.appData.push_back({name, uid});
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->OnAppStateChanged(info);
 }
 
@@ -1545,6 +1550,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnAppStateChanged_002, TestS
     abilityRecord->abilityInfo_.uid = uid;
     info.appData.push_back({name, uid});
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->serviceMap_.emplace("first", nullptr);
     connectManager->OnAppStateChanged(info);
 }
@@ -1566,6 +1572,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_AbilityTransitionDone_001, T
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int res1 = connectManager->AbilityTransitionDone(token, state);
     EXPECT_EQ(res1, ERR_INVALID_VALUE);
     state = AbilityState::INITIAL;
@@ -1591,6 +1598,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1616,6 +1624,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
@@ -1642,6 +1651,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleCommandAbilityDoneLo
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.clear();
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int res = connectManager->ScheduleCommandAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1677,6 +1687,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetServiceRecordByElementNam
     std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
     std::string element = "first";
     connectManager->serviceMap_.emplace(element, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     auto res = connectManager->GetServiceRecordByElementName(element);
     EXPECT_NE(res, nullptr);
 }
@@ -1731,6 +1742,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetAbilityRecordById_001, Te
     std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
     int64_t abilityRecordId = abilityRecord->GetRecordId();
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->serviceMap_.emplace("second", nullptr);
     auto res = connectManager->GetAbilityRecordById(abilityRecordId);
     EXPECT_NE(res, nullptr);
@@ -2002,6 +2014,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_RemoveServiceAbility_001, Te
     AbilityInfo abilityInfo;
     abilityRecord->abilityInfo_ = abilityInfo;
     connectManager->serviceMap_.clear();
+    connectManager->serviceTokenIndex_.Clear();
     connectManager->RemoveServiceAbility(abilityRecord);
 }
 
@@ -2077,6 +2090,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnTimeOut_001, TestSize.Leve
     std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
     uint32_t msgId = 2;
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     int64_t abilityRecordId = 1;
     connectManager->OnTimeOut(msgId, abilityRecordId);
     msgId = 0;
@@ -2117,6 +2131,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_HandleAbilityDiedTask_001, T
     std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
     int32_t currentUserId = 0;
     connectManager->serviceMap_.clear();
+    connectManager->serviceTokenIndex_.Clear();
     connectManager->HandleAbilityDiedTask(abilityRecord, currentUserId);
 }
 
@@ -2178,8 +2193,10 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_DumpState_001, TestSize.Leve
     bool isClient = false;
     std::string args = "args";
     connectManager->serviceMap_.emplace(args, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->DumpState(info, isClient, args);
     connectManager->serviceMap_.clear();
+    connectManager->serviceTokenIndex_.Clear();
     connectManager->DumpState(info, isClient, args);
     args = "";
     connectManager->DumpState(info, isClient, args);
@@ -2203,8 +2220,10 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_DumpStateByUri_001, TestSize
     std::string args = "args";
     std::vector<std::string> params;
     connectManager->serviceMap_.emplace(args, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->DumpStateByUri(info, isClient, args, params);
     connectManager->serviceMap_.clear();
+    connectManager->serviceTokenIndex_.Clear();
     connectManager->DumpStateByUri(info, isClient, args, params);
 }
 
@@ -2228,6 +2247,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetExtensionRunningInfos_001
     ExtensionRunningInfo extensionInfo;
     info.push_back(extensionInfo);
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->GetExtensionRunningInfos(upperLimit, info, userId, isPerm);
 }
 
@@ -2438,6 +2458,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_StartAbilityLocked_With_Sess
     abilityRecord->currentState_ = AbilityState::ACTIVE;
     abilityRecord->SetPreAbilityRecord(serviceRecord1_);
     connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     abilityRequest.sessionInfo = MockSessionInfo(0);
     int res = connectManager->StartAbilityLocked(abilityRequest);
     EXPECT_EQ(res, ERR_OK);
@@ -2794,9 +2815,11 @@ HWTEST_F(AbilityConnectManagerTest, OnAbilityRequestDone_001, TestSize.Level1)
     abilityRecord->abilityInfo_.extensionAbilityType = ExtensionAbilityType::UI;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->serviceTokenIndex_.Add(abilityRecord);
     connectManager->OnAbilityRequestDone(token, 2);
     EXPECT_EQ(abilityRecord->GetAbilityState(), AbilityState::FOREGROUNDING);
     connectManager->serviceMap_.erase("first");
+    connectManager->serviceTokenIndex_.Remove(abilityRecord);
     abilityRecord->abilityInfo_.extensionAbilityType = ExtensionAbilityType::UNSPECIFIED;
     abilityRecord->SetAbilityState(AbilityState::INITIAL);
 }
@@ -3180,11 +3203,13 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_PauseExtensions_001, TestSiz
     std::shared_ptr<AbilityRecord> abilityRecord1 = serviceRecord_;
     abilityRecord1->abilityInfo_.type = AbilityType::PAGE;
     connectManager->serviceMap_.emplace("first", abilityRecord1);
+    connectManager->serviceTokenIndex_.Add(abilityRecord1);
     std::shared_ptr<AbilityRecord> abilityRecord2 = AbilityRecord::CreateAbilityRecord(abilityRequest_);
     abilityRecord2->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord2->abilityInfo_.name = AbilityConfig::LAUNCHER_ABILITY_NAME;
     abilityRecord2->abilityInfo_.bundleName = AbilityConfig::LAUNCHER_BUNDLE_NAME;
     connectManager->serviceMap_.emplace("second", abilityRecord2);
+    connectManager->serviceTokenIndex_.Add(abilityRecord2);
     connectManager->PauseExtensions();
 }
 
@@ -3202,9 +3227,11 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_SignRestartAppFlag_001, Test
     std::shared_ptr<AbilityRecord> abilityRecord1 = serviceRecord_;
     abilityRecord1->abilityInfo_.bundleName = bundleName;
     connectManager->serviceMap_.emplace("first", abilityRecord1);
+    connectManager->serviceTokenIndex_.Add(abilityRecord1);
     std::shared_ptr<AbilityRecord> abilityRecord2 = AbilityRecord::CreateAbilityRecord(abilityRequest_);
     abilityRecord2->abilityInfo_.bundleName = "errTestBundleName";
     connectManager->serviceMap_.emplace("second", abilityRecord2);
+    connectManager->serviceTokenIndex_.Add(abilityRecord2);
     connectManager->SignRestartAppFlag(bundleName);
 }
 
@@ -3283,5 +3310,52 @@ HWTEST_F(AbilityConnectManagerTest, UnloadUIExtensionAbility_0100, TestSize.Leve
     auto ret = connectManager->UnloadUIExtensionAbility(abilityRecord, hostBundleName);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 }
+
+/**
+ * @tc.name: ServiceTokenIndex_0100
+ * @tc.desc: Verify the token indexes follow the service map and the terminating list.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AbilityConnectManagerTest, ServiceTokenIndex_0100, TestSize.Level1)
+{
+    std::shared_ptr<AbilityConnectManager> connectManager = std::make_shared<AbilityConnectManager>(0);
+    ASSERT_NE(connectManager, nullptr);
+    std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
+    sptr<IRemoteObject> token = abilityRecord->GetToken();
+
+    EXPECT_TRUE(connectManager->AddToServiceMap(abilityRecord->GetURI(), abilityRecord));
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), abilityRecord);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromTerminatingMap(token), nullptr);
+
+    connectManager->MoveToTerminatingMap(abilityRecord);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), nullptr);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromTerminatingMap(token), abilityRecord);
+    EXPECT_EQ(connectManager->serviceTokenIndex_.Size(), 0);
+
+    connectManager->RemoveServiceAbility(abilityRecord);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromTerminatingMap(token), nullptr);
+    EXPECT_EQ(connectManager->terminatingTokenIndex_.Size(), 0);
+}
+
+/**
+ * @tc.name: ServiceTokenIndex_0200
+ * @tc.desc: Verify records removed from the service map by bundle are dropped from the token index.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AbilityConnectManagerTest, ServiceTokenIndex_0200, TestSize.Level1)
+{
+    std::shared_ptr<AbilityConnectManager> connectManager = std::make_shared<AbilityConnectManager>(0);
+    ASSERT_NE(connectManager, nullptr);
+    std::shared_ptr<AbilityRecord> abilityRecord = serviceRecord_;
+    sptr<IRemoteObject> token = abilityRecord->GetToken();
+
+    EXPECT_TRUE(connectManager->AddToServiceMap(abilityRecord->GetURI(), abilityRecord));
+    EXPECT_FALSE(connectManager->AddToServiceMap(abilityRecord->GetURI(), abilityRecord));
+    EXPECT_EQ(connectManager->serviceTokenIndex_.Size(), connectManager->serviceMap_.size());
+
+    connectManager->DeleteInvalidServiceRecord(abilityRecord->GetApplicationInfo().bundleName);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), nullptr);
+    EXPECT_EQ(connectManager->serviceTokenIndex_.Size(), 0);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
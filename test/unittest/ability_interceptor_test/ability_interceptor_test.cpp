@@ -44,6 +44,24 @@ const std::string JUMP_ABILITY_NAME = "com.test.jump";
 
 namespace OHOS {
 namespace AAFwk {
+class CountingInterceptor : public IAbilityInterceptor {
+public:
+    CountingInterceptor(ErrCode result, bool isCacheable) : result_(result), isCacheable_(isCacheable) {}
+    ErrCode DoProcess(AbilityInterceptorParam param) override
+    {
+        processCount_++;
+        return result_;
+    }
+    bool IsVerdictCacheable(const AbilityInterceptorParam &param) override
+    {
+        return isCacheable_;
+    }
+    int32_t processCount_ = 0;
+private:
+    ErrCode result_;
+    bool isCacheable_;
+};
+
 class AbilityInterceptorTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -749,5 +767,75 @@ HWTEST_F(AbilityInterceptorTest, EcologicalRuleInterceptor_003, TestSize.Level1)
     bool result = interceptor->DoProcess(want, userId);
     EXPECT_EQ(result, true);
 }
+
+/**
+ * @tc.name: AbilityInterceptorTest_DoProcess_001
+ * @tc.desc: the first reject in added order is returned and the interceptors after it are skipped
+ * @tc.type: FUNC
+ * @tc.require: No
+ */
+HWTEST_F(AbilityInterceptorTest, DoProcess_001, TestSize.Level1)
+{
+    auto executer = std::make_shared<AbilityInterceptorExecuter>();
+    auto first = std::make_shared<CountingInterceptor>(ERR_OK, false);
+    auto firstReject = std::make_shared<CountingInterceptor>(ERR_INVALID_VALUE, false);
+    auto secondReject = std::make_shared<CountingInterceptor>(ERR_INVALID_OPERATION, false);
+    auto last = std::make_shared<CountingInterceptor>(ERR_OK, false);
+    executer->AddInterceptor("First", first);
+    executer->AddInterceptor("FirstReject", firstReject);
+    executer->AddInterceptor("SecondReject", secondReject);
+    executer->AddInterceptor("Last", last);
+
+    Want want;
+    AbilityInterceptorParam param = AbilityInterceptorParam(want, 0, 100, true, nullptr);
+    EXPECT_EQ(executer->DoProcess(param), ERR_INVALID_VALUE);
+    EXPECT_EQ(first->processCount_, 1);
+    EXPECT_EQ(firstReject->processCount_, 1);
+    EXPECT_EQ(secondReject->processCount_, 0);
+    EXPECT_EQ(last->processCount_, 0);
+
+    executer->RemoveInterceptor("FirstReject");
+    EXPECT_EQ(executer->DoProcess(param), ERR_INVALID_OPERATION);
+    EXPECT_EQ(secondReject->processCount_, 1);
+    EXPECT_EQ(last->processCount_, 0);
+
+    auto stats = executer->GetInterceptorStats();
+    EXPECT_EQ(stats.size(), 3);
+    EXPECT_EQ(stats["First"].processCount, 2);
+    EXPECT_EQ(stats["SecondReject"].rejectCount, 1);
+}
+
+/**
+ * @tc.name: AbilityInterceptorTest_DoProcess_002
+ * @tc.desc: the passes of cacheable interceptors are reused until the cache is cleared
+ * @tc.type: FUNC
+ * @tc.require: No
+ */
+HWTEST_F(AbilityInterceptorTest, DoProcess_002, TestSize.Level1)
+{
+    auto executer = std::make_shared<AbilityInterceptorExecuter>();
+    auto cacheable = std::make_shared<CountingInterceptor>(ERR_OK, true);
+    auto uncacheable = std::make_shared<CountingInterceptor>(ERR_OK, false);
+    executer->AddInterceptor("Cacheable", cacheable);
+    executer->AddInterceptor("Uncacheable", uncacheable);
+
+    Want want;
+    want.SetElementName(BUNDLE_NAME, PASS_ABILITY_NAME);
+    sptr<IRemoteObject> callerToken = new Token(std::weak_ptr<AbilityRecord>());
+    AbilityInterceptorParam param = AbilityInterceptorParam(want, 0, 100, true, callerToken);
+    EXPECT_EQ(executer->DoProcess(param), ERR_OK);
+    EXPECT_EQ(executer->DoProcess(param), ERR_OK);
+    EXPECT_EQ(cacheable->processCount_, 1);
+    EXPECT_EQ(uncacheable->processCount_, 2);
+    EXPECT_EQ(executer->GetInterceptorStats()["Cacheable"].verdictHitCount, 1);
+
+    executer->ClearVerdictCache();
+    EXPECT_EQ(executer->DoProcess(param), ERR_OK);
+    EXPECT_EQ(cacheable->processCount_, 2);
+
+    AbilityInterceptorParam otherUserParam = AbilityInterceptorParam(want, 0, 101, true, callerToken);
+    EXPECT_EQ(executer->DoProcess(otherUserParam), ERR_OK);
+    EXPECT_EQ(cacheable->processCount_, 3);
+}
 } // namespace AAFwk
 } // namespace OHOS
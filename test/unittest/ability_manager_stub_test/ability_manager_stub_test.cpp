@@ -3742,5 +3742,48 @@ HWTEST_F(AbilityManagerStubTest, ChangeUIAbilityVisibilityBySCB_0100, TestSize.L
 
     TAG_LOGI(AAFwkTag::TEST, "end");
 }
+/**
+ * @tc.name: AbilityManagerStub_RequestFuncTable_0100
+ * @tc.desc: Every ipc code of the request func table is unique and resolved to its own entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(AbilityManagerStubTest, AbilityManagerStub_RequestFuncTable_0100, TestSize.Level1)
+{
+    const auto &requestFuncTable = AbilityManagerStub::GetRequestFuncTable();
+    EXPECT_FALSE(requestFuncTable.entries.empty());
+    for (size_t index = 0; index < requestFuncTable.entries.size(); index++) {
+        uint32_t code = static_cast<uint32_t>(requestFuncTable.entries[index].code);
+        ASSERT_LT(code, requestFuncTable.slots.size());
+        EXPECT_EQ(requestFuncTable.slots[code], index + 1);
+    }
+}
+
+/**
+ * @tc.name: AbilityManagerStub_DumpRequestStats_0100
+ * @tc.desc: DumpRequestStats reports the count of the dispatched ipc codes
+ * @tc.type: FUNC
+ */
+HWTEST_F(AbilityManagerStubTest, AbilityManagerStub_DumpRequestStats_0100, TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    Want want;
+    WriteInterfaceToken(data);
+    data.WriteParcelable(&want);
+    data.WriteInt32(1);
+    int res = stub_->OnRemoteRequest(static_cast<uint32_t>(AbilityManagerInterfaceCode::START_ABILITY),
+        data, reply, option);
+    EXPECT_EQ(res, NO_ERROR);
+
+    std::vector<std::string> info;
+    stub_->DumpRequestStats(info);
+    std::string expected = "code:" +
+        std::to_string(static_cast<uint32_t>(AbilityManagerInterfaceCode::START_ABILITY)) + " count:1 ";
+    bool isFound = std::any_of(info.begin(), info.end(), [&expected](const std::string &line) {
+        return line.find(expected) != std::string::npos;
+    });
+    EXPECT_TRUE(isFound);
+}
 } // namespace AAFwk
 } // namespace OHOS
@@ -512,6 +512,29 @@ HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_GetAbilityRecordByToken, TestSize.Le
     EXPECT_EQ(abilityRecord_->GetToken()->GetAbilityRecord(), abilityRecord_);
 }
 
+/*
+ * Feature: Token
+ * Function: GetAbilityRecordByToken
+ * SubFunction: GetSlowPathCount
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify live tokens skip the descriptor check and other objects take the slow path
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_GetAbilityRecordByToken_SlowPath, TestSize.Level1)
+{
+    uint64_t slowPathCount = Token::GetSlowPathCount();
+    EXPECT_EQ(Token::GetAbilityRecordByToken(abilityRecord_->GetToken()), abilityRecord_);
+    EXPECT_EQ(Token::GetSlowPathCount(), slowPathCount);
+
+    sptr<IRemoteObject> callback = new AbilityConnectCallback();
+    EXPECT_EQ(Token::GetAbilityRecordByToken(callback), nullptr);
+    EXPECT_EQ(Token::GetSlowPathCount(), slowPathCount + 1);
+
+    sptr<Token> token = new Token(abilityRecord_);
+    EXPECT_EQ(Token::GetAbilityRecordByToken(token), abilityRecord_);
+    EXPECT_EQ(Token::GetSlowPathCount(), slowPathCount + 1);
+}
+
 /*
  * Feature: AbilityRecord
  * Function: Dump
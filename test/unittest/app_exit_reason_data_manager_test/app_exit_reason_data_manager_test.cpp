@@ -170,5 +170,35 @@ HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_GetAbilitySessio
     EXPECT_EQ(result, ERR_OK);
     EXPECT_EQ(sessionId, SESSION_ID);
 }
+/**
+ * @tc.name: AppExitReasonDataManager_DeleteAppExitReason_001
+ * @tc.desc: DeleteAppExitReason removes the token entry and the ui extension entries of the bundle only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_DeleteAppExitReason_001, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    std::string bundleName = "com.test.demo";
+    std::string otherBundleName = "com.test.demo.other";
+    std::vector<std::string> abilityList = { ABILITY_NAME };
+    std::vector<std::string> extensionList = { "testEntryUIExtAbility" };
+    AAFwk::ExitReason exitReason = { AAFwk::REASON_JS_ERROR, "Js Error." };
+    EXPECT_EQ(dataManager->SetAppExitReason(bundleName, ACCESS_TOKEN_ID, abilityList, exitReason), ERR_OK);
+    EXPECT_EQ(dataManager->SetUIExtensionAbilityExitReason(bundleName, extensionList, exitReason), ERR_OK);
+    EXPECT_EQ(dataManager->SetUIExtensionAbilityExitReason(otherBundleName, extensionList, exitReason), ERR_OK);
+
+    EXPECT_EQ(dataManager->DeleteAppExitReason(bundleName, ACCESS_TOKEN_ID), ERR_OK);
+    EXPECT_TRUE(dataManager->isEntriesLoaded_);
+    EXPECT_EQ(dataManager->entries_.count(std::to_string(ACCESS_TOKEN_ID)), 0);
+    EXPECT_EQ(dataManager->entries_.count(bundleName + ":" + extensionList[0]), 0);
+
+    bool isSetReason = true;
+    AAFwk::ExitReason result;
+    EXPECT_EQ(dataManager->GetAppExitReason(bundleName, ACCESS_TOKEN_ID, ABILITY_NAME, isSetReason, result), ERR_OK);
+    EXPECT_FALSE(isSetReason);
+    EXPECT_FALSE(dataManager->GetUIExtensionAbilityExitReason(bundleName + ":" + extensionList[0], result));
+    EXPECT_TRUE(dataManager->GetUIExtensionAbilityExitReason(otherBundleName + ":" + extensionList[0], result));
+    EXPECT_EQ(result.reason, AAFwk::REASON_JS_ERROR);
+}
 }  // namespace AbilityRuntime
 }  // namespace OHOS
@@ -60,6 +60,14 @@ namespace {
 constexpr int32_t RECORD_ID = 1;
 constexpr int32_t APP_DEBUG_INFO_PID = 0;
 constexpr int32_t APP_DEBUG_INFO_UID = 0;
+
+void AddAppRunningRecord(const std::shared_ptr<AppRunningManager> &appRunningManager, int32_t recordId,
+    const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord).second) {
+        appRunningManager->AddRecordIndexLocked(recordId, appRecord);
+    }
+}
 }
 static int recordId_ = 0;
 class AppMgrServiceInnerTest : public testing::Test {
@@ -1089,7 +1097,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillProcessByPid_002, TestSize.Level0)
     auto priorityObject = std::make_shared<PriorityObject>();
     priorityObject->SetPid(0);
     appRecord->priorityObject_ = priorityObject;
-    appRunningManager->appRunningRecordMap_.emplace(recordId_, appRecord);
+    AddAppRunningRecord(appRunningManager, recordId_, appRecord);
 
     int result = appMgrServiceInner->KillProcessByPid(pid, "KillProcessByPid_002");
     EXPECT_EQ(result, AAFwk::ERR_KILL_PROCESS_NOT_EXIST);
@@ -3896,7 +3904,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsApplicationRunning_001, TestSize.Level1)
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
     appRecord->mainBundleName_ = "com.is.hiserice";
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    AddAppRunningRecord(appMgrServiceInner->appRunningManager_, recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsApplicationRunning(bundleName, isRunning);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_TRUE(isRunning);
@@ -3916,7 +3924,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsApplicationRunning_002, TestSize.Level1)
     bool isRunning = false;
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    AddAppRunningRecord(appMgrServiceInner->appRunningManager_, recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsApplicationRunning(bundleName, isRunning);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_FALSE(isRunning);
@@ -3989,7 +3997,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsAppRunning_001, TestSize.Level1)
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
     appRecord->mainBundleName_ = "com.is.hiserice";
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    AddAppRunningRecord(appMgrServiceInner->appRunningManager_, recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsAppRunning(bundleName, appCloneIndex, isRunning);
     EXPECT_EQ(ret, AAFwk::ERR_APP_CLONE_INDEX_INVALID);
     EXPECT_FALSE(isRunning);
@@ -4011,7 +4019,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsAppRunning_002, TestSize.Level1)
     bool isRunning = false;
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    AddAppRunningRecord(appMgrServiceInner->appRunningManager_, recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsAppRunning(bundleName, appCloneIndex, isRunning);
     EXPECT_EQ(ret, AAFwk::ERR_APP_CLONE_INDEX_INVALID);
     EXPECT_FALSE(isRunning);
@@ -4371,5 +4379,55 @@ HWTEST_F(AppMgrServiceInnerTest, BlockProcessCacheByPids_001, TestSize.Level1)
     std::vector<int32_t> pids{2};
     appMgrServiceInner->BlockProcessCacheByPids(pids);
 }
+
+/**
+ * @tc.name: GetSpawnDescriptor_001
+ * @tc.desc: Spawn descriptor is served from the cache until a bundle event clears it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppMgrServiceInnerTest, GetSpawnDescriptor_001, TestSize.Level1)
+{
+    auto appMgrServiceInner = std::make_shared<AppMgrServiceInner>();
+    EXPECT_NE(appMgrServiceInner, nullptr);
+
+    AppMgrServiceInner::SpawnDescriptor cached;
+    cached.overlayInfo = "/data/overlay.hap|";
+    BaseSharedBundleInfo hsp;
+    hsp.bundleName = "com.example.hsp";
+    cached.hspList.emplace_back(hsp);
+    appMgrServiceInner->spawnDescriptorCache_.emplace("com.example.test:100", cached);
+
+    AppMgrServiceInner::SpawnDescriptor descriptor;
+    EXPECT_EQ(appMgrServiceInner->GetSpawnDescriptor("com.example.test", 100, descriptor), ERR_OK);
+    EXPECT_EQ(descriptor.overlayInfo, cached.overlayInfo);
+    ASSERT_EQ(descriptor.hspList.size(), 1);
+    EXPECT_EQ(descriptor.hspList[0].bundleName, hsp.bundleName);
+
+    auto generation = appMgrServiceInner->spawnDescriptorGeneration_;
+    appMgrServiceInner->ClearSpawnDescriptorCache();
+    EXPECT_TRUE(appMgrServiceInner->spawnDescriptorCache_.empty());
+    EXPECT_EQ(appMgrServiceInner->spawnDescriptorGeneration_, generation + 1);
+}
+
+/**
+ * @tc.name: GetSpawnDescriptor_002
+ * @tc.desc: Spawn descriptor query fails without the remote client manager unless it is cached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppMgrServiceInnerTest, GetSpawnDescriptor_002, TestSize.Level1)
+{
+    auto appMgrServiceInner = std::make_shared<AppMgrServiceInner>();
+    EXPECT_NE(appMgrServiceInner, nullptr);
+    appMgrServiceInner->remoteClientManager_ = nullptr;
+
+    AppMgrServiceInner::SpawnDescriptor descriptor;
+    EXPECT_EQ(appMgrServiceInner->GetSpawnDescriptor("com.example.test", 100, descriptor), ERR_NO_INIT);
+
+    AppMgrServiceInner::SpawnDescriptor cached;
+    cached.overlayInfo = "/data/overlay.hap|";
+    appMgrServiceInner->spawnDescriptorCache_.emplace("com.example.test:100", cached);
+    EXPECT_EQ(appMgrServiceInner->GetSpawnDescriptor("com.example.test", 100, descriptor), ERR_OK);
+    EXPECT_EQ(descriptor.overlayInfo, cached.overlayInfo);
+}
 } // namespace AppExecFwk
 } // namespace OHOS
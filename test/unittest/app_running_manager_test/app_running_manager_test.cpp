@@ -38,6 +38,14 @@ constexpr pid_t PID = 10;
 constexpr int32_t RECORD_MAP_SIZE = 1;
 constexpr int32_t DEBUG_INFOS_SIZE = 1;
 constexpr int32_t ABILITY_TOKENS_SIZE = 1;
+
+void AddAppRunningRecord(const std::shared_ptr<AppRunningManager> &appRunningManager, int32_t recordId,
+    const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord).second) {
+        appRunningManager->AddRecordIndexLocked(recordId, appRecord);
+    }
+}
 }
 class AppRunningManagerTest : public testing::Test {
 public:
@@ -73,7 +81,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_SetAttachAppDebug_0100, TestSi
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    AddAppRunningRecord(appRunningManager, RECORD_ID, appRunningRecord);
     appRunningManager->SetAttachAppDebug(bundleName, true);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -99,7 +107,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_SetAttachAppDebug_0200, TestSi
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    AddAppRunningRecord(appRunningManager, RECORD_ID, appRunningRecord);
     appRunningManager->SetAttachAppDebug(bundleName, isAttachDebug);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -126,7 +134,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppDebugInfoByBundleName_01
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    AddAppRunningRecord(appRunningManager, RECORD_ID, appRunningRecord);
     appRunningManager->GetAppDebugInfosByBundleName(bundleName, isDetachDebug);
     EXPECT_EQ(appRunningManager->appRunningRecordMap_.size(), RECORD_MAP_SIZE);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
@@ -152,7 +160,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAbilityTokensByBundleName_0
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    AddAppRunningRecord(appRunningManager, RECORD_ID, appRunningRecord);
     appRunningManager->GetAbilityTokensByBundleName(bundleName, abilityTokens);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -184,7 +192,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_OnWindowVisibilityChanged_0100
     EXPECT_NE(appRunningRecord, nullptr);
     appRunningRecord->curState_ = ApplicationState::APP_STATE_BACKGROUND;
     appRunningRecord->GetPriorityObject()->SetPid(PID);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, recordId, appRunningRecord);
 
     // 3. construct WindowVisibilityInfos
     std::vector<sptr<OHOS::Rosen::WindowVisibilityInfo>> windowVisibilityInfos;
@@ -220,7 +228,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppRunningRecordByChildProc
     pid_t childPid = 201;
     childRecord->pid_ = childPid;
     appRecord->AddChildProcessRecord(childPid, childRecord);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRecord));
+    AddAppRunningRecord(appRunningManager, RECORD_ID, appRecord);
 
     auto record = appRunningManager->GetAppRunningRecordByChildProcessPid(childPid);
     EXPECT_NE(record, nullptr);
@@ -243,13 +251,13 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_UpdateConfiguration_0100, Test
     std::string processName;
     Configuration config;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, nullptr);
+    AddAppRunningRecord(appRunningManager, recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, ++recordId, nullptr);
     appRunningRecord->SetState(ApplicationState::APP_STATE_READY);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, ++recordId, appRunningRecord);
     appInfo->name = "com.huawei.shell_assistant";
     appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, ++recordId, appRunningRecord);
     EXPECT_EQ(appRunningManager->appRunningRecordMap_.size(), recordId);
     auto ret = appRunningManager->UpdateConfiguration(config);
     EXPECT_EQ(ret, ERR_OK);
@@ -287,10 +295,10 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_UpdateConfiguration_0300, Test
     std::string processName;
     Configuration config;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, recordId, appRunningRecord);
     appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRunningRecord->SetState(ApplicationState::APP_STATE_BACKGROUND);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    AddAppRunningRecord(appRunningManager, ++recordId, appRunningRecord);
     auto ret = appRunningManager->UpdateConfiguration(config);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_EQ(appRunningManager->updateConfigurationDelayedMap_[0], false);
@@ -677,13 +685,49 @@ HWTEST_F(AppRunningManagerTest, IsAppProcessesAllCached_0100, TestSize.Level1)
     appRunningRecord2->SetUid(appInfo->uid);
     appRunningRecord2->SetSupportedProcessCache(true);
 
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId1, appRunningRecord1));
+    AddAppRunningRecord(appRunningManager, recordId1, appRunningRecord1);
     std::set<std::shared_ptr<AppRunningRecord>> cachedSet;
     cachedSet.insert(appRunningRecord1);
     EXPECT_EQ(appRunningManager->IsAppProcessesAllCached(appInfo->bundleName, appInfo->uid, cachedSet), true);
 
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId2, appRunningRecord2));
+    AddAppRunningRecord(appRunningManager, recordId2, appRunningRecord2);
     EXPECT_EQ(appRunningManager->IsAppProcessesAllCached(appInfo->bundleName, appInfo->uid, cachedSet), false);
 }
+
+/**
+ * @tc.name: AppRunningManager_RecordIndex_0100
+ * @tc.desc: Test that bundle name, process name and pid lookups follow record creation and removal
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerTest, AppRunningManager_RecordIndex_0100, TestSize.Level1)
+{
+    auto appRunningManager = std::make_shared<AppRunningManager>();
+    ASSERT_NE(appRunningManager, nullptr);
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->bundleName = "com.example.index";
+    BundleInfo bundleInfo;
+    auto appRecord1 = appRunningManager->CreateAppRunningRecord(appInfo, "com.example.index", bundleInfo);
+    auto appRecord2 = appRunningManager->CreateAppRunningRecord(appInfo, "com.example.index:remote", bundleInfo);
+    ASSERT_NE(appRecord1, nullptr);
+    ASSERT_NE(appRecord2, nullptr);
+    appRecord2->GetPriorityObject()->SetPid(PID);
+
+    EXPECT_EQ(appRunningManager->GetAllAppRunningRecordCountByBundleName("com.example.index"), 2);
+    EXPECT_TRUE(appRunningManager->CheckAppRunningRecordIsExistByBundleName("com.example.index"));
+    EXPECT_FALSE(appRunningManager->CheckAppRunningRecordIsExistByBundleName("com.example.other"));
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(PID), appRecord2);
+    EXPECT_EQ(appRunningManager->pidCache_.size(), 1u);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(PID), appRecord2);
+
+    appRunningManager->RemoveAppRunningRecordById(appRecord2->GetRecordId());
+    EXPECT_EQ(appRunningManager->GetAllAppRunningRecordCountByBundleName("com.example.index"), 1);
+    EXPECT_EQ(appRunningManager->GetAppRunningRecordByPid(PID), nullptr);
+    EXPECT_TRUE(appRunningManager->pidCache_.empty());
+    EXPECT_EQ(appRunningManager->processNameIndex_.count("com.example.index:remote"), 0u);
+
+    appRunningManager->ClearAppRunningRecordMap();
+    EXPECT_TRUE(appRunningManager->bundleNameIndex_.empty());
+    EXPECT_FALSE(appRunningManager->CheckAppRunningRecordIsExistByBundleName("com.example.index"));
+}
 } // namespace AppExecFwk
 } // namespace OHOS
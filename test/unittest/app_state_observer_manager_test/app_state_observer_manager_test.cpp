@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <gtest/gtest.h>
 
 #include "ability_foreground_state_observer_proxy.h"
@@ -64,6 +65,70 @@ public:
         return {};
     }
 };
+class CountingApplicationStateObserver : public MockApplicationStateObserver {
+public:
+    void OnForegroundApplicationChanged(const AppStateData &appStateData) override
+    {
+        foregroundApplicationChangedCount_++;
+    }
+    void OnAbilityStateChanged(const AbilityStateData &abilityStateData) override
+    {
+        abilityStateChangedCount_++;
+    }
+    void OnExtensionStateChanged(const AbilityStateData &abilityStateData) override
+    {
+        extensionStateChangedCount_++;
+    }
+    void OnProcessCreated(const ProcessData &processData) override
+    {
+        callbacks_.emplace_back("OnProcessCreated");
+        processCreatedCount_++;
+    }
+    void OnProcessStateChanged(const ProcessData &processData) override
+    {
+        callbacks_.emplace_back("OnProcessStateChanged");
+        lastProcessState_ = static_cast<int32_t>(processData.state);
+        processStateChangedCount_++;
+    }
+    void OnProcessDied(const ProcessData &processData) override
+    {
+        processDiedCount_++;
+    }
+    void OnApplicationStateChanged(const AppStateData &appStateData) override
+    {
+        applicationStateChangedCount_++;
+    }
+    void OnAppStateChanged(const AppStateData &appStateData) override
+    {
+        appStateChangedCount_++;
+    }
+    void OnAppStarted(const AppStateData &appStateData) override
+    {
+        appStartedCount_++;
+    }
+    void OnAppStopped(const AppStateData &appStateData) override
+    {
+        appStoppedCount_++;
+    }
+    void OnAppCacheStateChanged(const AppStateData &appStateData) override
+    {
+        appCacheStateChangedCount_++;
+    }
+    std::atomic<int32_t> foregroundApplicationChangedCount_ = 0;
+    std::atomic<int32_t> abilityStateChangedCount_ = 0;
+    std::atomic<int32_t> extensionStateChangedCount_ = 0;
+    std::atomic<int32_t> processCreatedCount_ = 0;
+    std::atomic<int32_t> processStateChangedCount_ = 0;
+    std::atomic<int32_t> lastProcessState_ = -1;
+    std::atomic<int32_t> processDiedCount_ = 0;
+    std::atomic<int32_t> applicationStateChangedCount_ = 0;
+    std::atomic<int32_t> appStateChangedCount_ = 0;
+    std::atomic<int32_t> appStartedCount_ = 0;
+    std::atomic<int32_t> appStoppedCount_ = 0;
+    std::atomic<int32_t> appCacheStateChangedCount_ = 0;
+    // only touched by the thread draining the queue.
+    std::vector<std::string> callbacks_;
+};
 class AppForegroundStateObserver : public AppForegroundStateObserverStub {
 public:
     AppForegroundStateObserver() = default;
@@ -78,7 +143,9 @@ public:
     void SetUp();
     void TearDown();
     std::shared_ptr<AppRunningRecord> MockAppRecord();
-    sptr<IApplicationStateObserver> observer_ {nullptr};
+    void AddObserver(const std::shared_ptr<AppStateObserverManager> &manager,
+        const sptr<IApplicationStateObserver> &observer, const std::vector<std::string> &bundleNameList);
+    sptr<CountingApplicationStateObserver> observer_ {nullptr};
 };
 
 void AppSpawnSocketTest::SetUpTestCase()
@@ -89,12 +156,19 @@ void AppSpawnSocketTest::TearDownTestCase()
 
 void AppSpawnSocketTest::SetUp()
 {
-    sptr<IApplicationStateObserver> observer_ = new MockApplicationStateObserver();
+    observer_ = new CountingApplicationStateObserver();
 }
 
 void AppSpawnSocketTest::TearDown()
 {}
 
+void AppSpawnSocketTest::AddObserver(const std::shared_ptr<AppStateObserverManager> &manager,
+    const sptr<IApplicationStateObserver> &observer, const std::vector<std::string> &bundleNameList)
+{
+    manager->appStateObserverMap_.emplace(observer, bundleNameList);
+    manager->AddAppStateObserverIndex(observer, bundleNameList);
+}
+
 std::shared_ptr<AppRunningRecord> AppSpawnSocketTest::MockAppRecord()
 {
     ApplicationInfo appInfo;
@@ -365,8 +439,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_001, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStarted(appRecord);
+    EXPECT_EQ(observer_->appStartedCount_, 1);
 }
 
 /*
@@ -385,8 +460,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_002, TestSize.Level0)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStarted(appRecord);
+    EXPECT_EQ(observer_->appStartedCount_, 1);
 }
 
 /*
@@ -407,8 +483,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_003, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStarted(appRecord);
+    EXPECT_EQ(observer_->appStartedCount_, 0);
 }
 
 /*
@@ -428,7 +505,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_004, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnAppStarted(appRecord);
 }
 
@@ -450,8 +527,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_001, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStopped(appRecord);
+    EXPECT_EQ(observer_->appStoppedCount_, 1);
 }
 
 /*
@@ -470,8 +548,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_002, TestSize.Level0)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStopped(appRecord);
+    EXPECT_EQ(observer_->appStoppedCount_, 1);
 }
 
 /*
@@ -492,8 +571,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_003, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppStopped(appRecord);
+    EXPECT_EQ(observer_->appStoppedCount_, 0);
 }
 
 /*
@@ -513,7 +593,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_004, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnAppStopped(appRecord);
 }
 
@@ -536,8 +616,10 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_001, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
+    EXPECT_EQ(observer_->foregroundApplicationChangedCount_, 1);
+    EXPECT_EQ(observer_->appStateChangedCount_, 1);
 }
 
 /*
@@ -559,8 +641,10 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_002, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
+    EXPECT_EQ(observer_->foregroundApplicationChangedCount_, 1);
+    EXPECT_EQ(observer_->appStateChangedCount_, 0);
 }
 
 /*
@@ -581,7 +665,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_003, TestSize.Level0)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
 }
 
@@ -603,8 +687,10 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_004, TestSize.Level0)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
+    EXPECT_EQ(observer_->applicationStateChangedCount_, 1);
+    EXPECT_EQ(observer_->foregroundApplicationChangedCount_, 0);
 }
 
 /*
@@ -626,8 +712,9 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_005, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
+    EXPECT_EQ(observer_->applicationStateChangedCount_, 1);
 }
 
 /*
@@ -650,8 +737,9 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_006, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
+    EXPECT_EQ(observer_->applicationStateChangedCount_, 0);
 }
 
 /*
@@ -672,7 +760,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_007, TestSize.Level0)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false);
 }
 
@@ -713,8 +801,10 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_001, TestSize.Leve
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
+    EXPECT_EQ(observer_->abilityStateChangedCount_, 1);
+    EXPECT_EQ(observer_->extensionStateChangedCount_, 0);
 }
 
 /*
@@ -734,8 +824,10 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_002, TestSize.Leve
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
+    EXPECT_EQ(observer_->extensionStateChangedCount_, 1);
+    EXPECT_EQ(observer_->abilityStateChangedCount_, 0);
 }
 
 /*
@@ -757,8 +849,9 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_003, TestSize.Leve
     std::string bundleName2 = "com.ohos.unittest2";
     abilityStateData.bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
+    EXPECT_EQ(observer_->extensionStateChangedCount_, 0);
 }
 
 /*
@@ -779,7 +872,7 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_004, TestSize.Leve
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
 }
 
@@ -836,8 +929,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_001, TestSize.Level0)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     data.bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessCreated(data);
+    EXPECT_EQ(observer_->processCreatedCount_, 1);
 }
 
 /*
@@ -857,8 +951,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_002, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     data.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessCreated(data);
+    EXPECT_EQ(observer_->processCreatedCount_, 1);
 }
 
 /*
@@ -879,8 +974,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_003, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest";
     data.bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessCreated(data);
+    EXPECT_EQ(observer_->processCreatedCount_, 1);
 }
 
 /*
@@ -900,7 +996,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_004, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     data.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnProcessCreated(data);
 }
 
@@ -936,8 +1032,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_002, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessStateChanged(appRecord);
+    EXPECT_EQ(observer_->processStateChangedCount_, 1);
 }
 
 /*
@@ -956,8 +1053,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_003, TestSize.Level0)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessStateChanged(appRecord);
+    EXPECT_EQ(observer_->processStateChangedCount_, 1);
 }
 
 /*
@@ -978,7 +1076,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_004, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnProcessStateChanged(appRecord);
 }
 
@@ -999,7 +1097,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_005, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnProcessStateChanged(appRecord);
 }
 
@@ -1056,8 +1154,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_001, TestSize.Level0)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     data.bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessDied(data);
+    EXPECT_EQ(observer_->processDiedCount_, 1);
 }
 
 /*
@@ -1077,8 +1176,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_002, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     data.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessDied(data);
+    EXPECT_EQ(observer_->processDiedCount_, 1);
 }
 
 /*
@@ -1099,8 +1199,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_003, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     data.bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnProcessDied(data);
+    EXPECT_EQ(observer_->processDiedCount_, 0);
 }
 
 /*
@@ -1121,7 +1222,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_004, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     data.bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnProcessDied(data);
 }
 
@@ -1408,8 +1509,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_001, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
+    EXPECT_EQ(observer_->appCacheStateChangedCount_, 1);
 }
 
 /*
@@ -1428,8 +1530,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_002, TestSize.Level0)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
+    EXPECT_EQ(observer_->appCacheStateChangedCount_, 1);
 }
 
 /*
@@ -1450,8 +1553,9 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_003, TestSize.Level0)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, bundleNameList);
+    AddObserver(manager, observer_, bundleNameList);
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
+    EXPECT_EQ(observer_->appCacheStateChangedCount_, 0);
 }
 
 /*
@@ -1471,8 +1575,159 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_004, TestSize.Level0)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, bundleNameList);
+    AddObserver(manager, nullptr, bundleNameList);
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
 }
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: NotifyAppStateObservers
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager NotifyAppStateObservers
+ * EnvConditions: NA
+ * CaseDescription: Verify only the observers subscribed to the bundle and the wildcard observers are notified
+ */
+HWTEST_F(AppSpawnSocketTest, NotifyAppStateObservers_001, TestSize.Level0)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    sptr<CountingApplicationStateObserver> bundleObserver = new CountingApplicationStateObserver();
+    sptr<CountingApplicationStateObserver> wildcardObserver = new CountingApplicationStateObserver();
+    sptr<CountingApplicationStateObserver> otherObserver = new CountingApplicationStateObserver();
+    manager->AddAppStateObserverIndex(bundleObserver, { "com.ohos.unittest", "com.ohos.unittest" });
+    manager->AddAppStateObserverIndex(wildcardObserver, {});
+    manager->AddAppStateObserverIndex(otherObserver, { "com.ohos.unittest2" });
+
+    ProcessData data;
+    data.bundleName = "com.ohos.unittest";
+    manager->HandleOnProcessCreated(data);
+    EXPECT_EQ(bundleObserver->processCreatedCount_, 1);
+    EXPECT_EQ(wildcardObserver->processCreatedCount_, 1);
+    EXPECT_EQ(otherObserver->processCreatedCount_, 0);
+
+    manager->RemoveAppStateObserverIndex(wildcardObserver);
+    manager->HandleOnProcessCreated(data);
+    EXPECT_EQ(bundleObserver->processCreatedCount_, 2);
+    EXPECT_EQ(wildcardObserver->processCreatedCount_, 1);
+    EXPECT_EQ(manager->wildcardObservers_.size(), 0);
+    EXPECT_EQ(manager->observerQueues_.size(), 2);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: EnqueueObserverEvent
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager EnqueueObserverEvent
+ * EnvConditions: NA
+ * CaseDescription: Verify pending process state events of the same process are coalesced into the newest position
+ */
+HWTEST_F(AppSpawnSocketTest, EnqueueObserverEvent_001, TestSize.Level0)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    manager->deliveryHandler_ = AAFwk::TaskHandlerWrap::CreateQueueHandler("EnqueueObserverEvent_001");
+    sptr<CountingApplicationStateObserver> observer = new CountingApplicationStateObserver();
+    manager->AddAppStateObserverIndex(observer, {});
+    auto queue = manager->observerQueues_[observer];
+    ASSERT_NE(queue, nullptr);
+    // hold the queue so that the events stay pending.
+    queue->isDraining = true;
+
+    ProcessData data;
+    data.bundleName = "com.ohos.unittest";
+    data.pid = 1;
+    data.state = AppProcessState::APP_STATE_FOREGROUND;
+    manager->NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &target) {
+        target->OnProcessStateChanged(data);
+    }, "processState:1");
+    manager->NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &target) {
+        target->OnProcessCreated(data);
+    });
+    data.state = AppProcessState::APP_STATE_BACKGROUND;
+    manager->NotifyAppStateObservers(data.bundleName, [data](const sptr<IApplicationStateObserver> &target) {
+        target->OnProcessStateChanged(data);
+    }, "processState:1");
+    EXPECT_EQ(queue->events.size(), 2);
+    EXPECT_EQ(queue->stats.coalescedCount, 1);
+
+    manager->DrainObserverQueue(queue);
+    EXPECT_EQ(observer->processStateChangedCount_, 1);
+    EXPECT_EQ(observer->lastProcessState_, static_cast<int32_t>(AppProcessState::APP_STATE_BACKGROUND));
+    EXPECT_EQ(observer->processCreatedCount_, 1);
+    std::vector<std::string> expectCallbacks = { "OnProcessCreated", "OnProcessStateChanged" };
+    EXPECT_EQ(observer->callbacks_, expectCallbacks);
+    EXPECT_EQ(queue->stats.deliveredCount, 2);
+    EXPECT_FALSE(queue->isDraining);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: EnqueueObserverEvent
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager EnqueueObserverEvent
+ * EnvConditions: NA
+ * CaseDescription: Verify only state updates are dropped when the observer queue is full, and the observer stays
+ *                  registered when nothing can be dropped
+ */
+HWTEST_F(AppSpawnSocketTest, EnqueueObserverEvent_002, TestSize.Level0)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    manager->deliveryHandler_ = AAFwk::TaskHandlerWrap::CreateQueueHandler("EnqueueObserverEvent_002");
+    AddObserver(manager, observer_, { "com.ohos.unittest" });
+    auto queue = manager->observerQueues_[observer_];
+    ASSERT_NE(queue, nullptr);
+    queue->isDraining = true;
+
+    std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
+    appRecord->mainBundleName_ = "com.ohos.unittest";
+    manager->HandleOnProcessStateChanged(appRecord);
+    ProcessData data;
+    data.bundleName = "com.ohos.unittest";
+    constexpr int32_t queueMaxSize = 256;
+    for (int32_t i = 1; i < queueMaxSize; i++) {
+        manager->HandleOnProcessDied(data);
+    }
+    EXPECT_EQ(queue->events.size(), queueMaxSize);
+    EXPECT_EQ(queue->stats.droppedCount, 0);
+
+    manager->HandleOnProcessDied(data);
+    EXPECT_EQ(queue->events.size(), queueMaxSize);
+    EXPECT_EQ(queue->stats.droppedCount, 1);
+    EXPECT_TRUE(queue->events.front().coalesceKey.empty());
+
+    manager->HandleOnProcessDied(data);
+    manager->HandleOnProcessDied(data);
+    EXPECT_FALSE(queue->isRemoved);
+    EXPECT_EQ(queue->events.size(), queueMaxSize + 2);
+    EXPECT_EQ(queue->stats.droppedCount, 1);
+    EXPECT_EQ(queue->stats.overflowCount, 2);
+    EXPECT_EQ(manager->appStateObserverMap_.size(), 1);
+    EXPECT_EQ(manager->observerQueues_.count(observer_), 1);
+
+    std::string result;
+    manager->DumpObserverDelivery(result);
+    EXPECT_NE(result.find("overflow: 2"), std::string::npos);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: DumpObserverDelivery
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager DumpObserverDelivery
+ * EnvConditions: NA
+ * CaseDescription: Verify the delivery statistics of every observer are dumped
+ */
+HWTEST_F(AppSpawnSocketTest, DumpObserverDelivery_001, TestSize.Level0)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    AddObserver(manager, observer_, { "com.ohos.unittest" });
+    std::string result;
+    manager->DumpObserverDelivery(result);
+    EXPECT_NE(result.find("application state observers: 1"), std::string::npos);
+    EXPECT_NE(result.find("bundles: com.ohos.unittest"), std::string::npos);
+    EXPECT_NE(result.find("delivered: 0"), std::string::npos);
+}
 } // namespace AppExecFwk
 } // namespace OHOS
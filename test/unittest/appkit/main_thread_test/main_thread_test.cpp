@@ -14,6 +14,7 @@
  */
 
 #include <cstdlib>
+#include <dlfcn.h>
 #include <gtest/gtest.h>
 
 #define private public
@@ -1982,6 +1983,119 @@ HWTEST_F(MainThreadTest, LoadAbilityLibrary_0100, TestSize.Level1)
     mainThread_->handleAbilityLib_.clear();
 }
 
+/**
+ * @tc.name: WaitAbilityLibraryPreloaded_0100
+ * @tc.desc: Wait the ability libraries opened in background.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, WaitAbilityLibraryPreloaded_0100, TestSize.Level1)
+{
+    ASSERT_NE(mainThread_, nullptr);
+    mainThread_->WaitAbilityLibraryPreloaded();
+    EXPECT_FALSE(mainThread_->abilityLibraryPreloaded_.valid());
+
+    std::vector<MainThread::AbilityLibraryItem> items;
+    MainThread::AbilityLibraryItem item;
+    item.file = "libability_library_not_exist.z.so";
+    item.isFatal = false;
+    items.emplace_back(item);
+    mainThread_->PreloadAbilityLibraries(std::move(items));
+    EXPECT_TRUE(mainThread_->abilityLibraryPreloaded_.valid());
+    mainThread_->PreloadAbilityLibraries({ item });
+    mainThread_->WaitAbilityLibraryPreloaded();
+    EXPECT_FALSE(mainThread_->abilityLibraryPreloaded_.valid());
+    EXPECT_TRUE(mainThread_->abilityLibraryPreloadState_->handles.empty());
+    mainThread_->handleAbilityLib_.clear();
+}
+
+/**
+ * @tc.name: OpenAbilityLibraries_0100
+ * @tc.desc: Open the fallback library when the ability library does not exist.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, OpenAbilityLibraries_0100, TestSize.Level1)
+{
+    std::vector<MainThread::AbilityLibraryItem> items;
+    MainThread::AbilityLibraryItem item;
+    item.file = "libability_library_not_exist.z.so";
+    item.fallbackFile = "libc++.so";
+    items.emplace_back(item);
+    MainThread::AbilityLibraryItem optionalItem;
+    optionalItem.file = "libability_library_optional_not_exist.z.so";
+    optionalItem.isFatal = false;
+    items.emplace_back(optionalItem);
+
+    std::vector<void *> handles;
+    std::string fatalFile;
+    EXPECT_TRUE(MainThread::OpenAbilityLibraries(items, handles, fatalFile));
+    EXPECT_TRUE(fatalFile.empty());
+    ASSERT_EQ(handles.size(), 1);
+    for (auto handle : handles) {
+        dlclose(handle);
+    }
+}
+
+/**
+ * @tc.name: OpenAbilityLibraries_0200
+ * @tc.desc: Stop and record the fatal library which failed to open.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, OpenAbilityLibraries_0200, TestSize.Level1)
+{
+    std::vector<MainThread::AbilityLibraryItem> items;
+    MainThread::AbilityLibraryItem item;
+    item.file = "libability_library_fatal_not_exist.z.so";
+    items.emplace_back(item);
+    item.file = "libc++.so";
+    items.emplace_back(item);
+
+    std::vector<void *> handles;
+    std::string fatalFile;
+    EXPECT_FALSE(MainThread::OpenAbilityLibraries(items, handles, fatalFile));
+    EXPECT_EQ(fatalFile, "libability_library_fatal_not_exist.z.so");
+    EXPECT_TRUE(handles.empty());
+}
+
+/**
+ * @tc.name: PreloadAbilityLibraries_0100
+ * @tc.desc: The batches are opened in order and the batches after a fatal failure are skipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, PreloadAbilityLibraries_0100, TestSize.Level1)
+{
+    ASSERT_NE(mainThread_, nullptr);
+    MainThread::AbilityLibraryItem first;
+    first.file = "libability_library_first_not_exist.z.so";
+    MainThread::AbilityLibraryItem second;
+    second.file = "libability_library_second_not_exist.z.so";
+    mainThread_->PreloadAbilityLibraries({ first });
+    mainThread_->PreloadAbilityLibraries({ second });
+    ASSERT_TRUE(mainThread_->abilityLibraryPreloaded_.valid());
+    mainThread_->abilityLibraryPreloaded_.wait();
+    {
+        std::lock_guard<std::mutex> lock(mainThread_->abilityLibraryPreloadState_->mutex);
+        EXPECT_EQ(mainThread_->abilityLibraryPreloadState_->fatalFile, first.file);
+        mainThread_->abilityLibraryPreloadState_->fatalFile.clear();
+    }
+    mainThread_->abilityLibraryPreloaded_ = std::shared_future<void>();
+}
+
+/**
+ * @tc.name: WaitAbilityLibraryPreloaded_0200
+ * @tc.desc: The main thread exits when a fatal library failed to open in background.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, WaitAbilityLibraryPreloaded_0200, TestSize.Level1)
+{
+    ASSERT_NE(mainThread_, nullptr);
+    EXPECT_EXIT({
+        MainThread::AbilityLibraryItem item;
+        item.file = "libability_library_fatal_not_exist.z.so";
+        mainThread_->PreloadAbilityLibraries({ item });
+        mainThread_->WaitAbilityLibraryPreloaded();
+    }, testing::ExitedWithCode(255), "");
+}
+
 /**
  * @tc.name: ScanDir_0100
  * @tc.desc: Close ability library.
@@ -2457,5 +2571,45 @@ HWTEST_F(MainThreadTest, ScheduleChangeAppGcState_0100, TestSize.Level1)
     auto ret = mainThread_->ScheduleChangeAppGcState(0);
     EXPECT_EQ(ret, NO_ERROR);
 }
+
+/**
+ * @tc.name: PostIdleTask_0100
+ * @tc.desc: Post idle task falls back to an idle priority event without idle time.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, PostIdleTask_0100, TestSize.Level1)
+{
+    ASSERT_NE(mainThread_, nullptr);
+    mainThread_->idleTime_ = nullptr;
+    EXPECT_TRUE(mainThread_->PostIdleTask("MainThreadTest:PostIdleTask", []() {}, 1));
+    EXPECT_FALSE(mainThread_->PostIdleTask("MainThreadTest:PostIdleTask", nullptr, 1));
+
+    auto bakHandler = mainThread_->mainHandler_;
+    mainThread_->mainHandler_ = nullptr;
+    EXPECT_FALSE(mainThread_->PostIdleTask("MainThreadTest:PostIdleTask", []() {}, 1));
+    mainThread_->mainHandler_ = bakHandler;
+}
+
+/**
+ * @tc.name: SubscribeOverlayChange_0100
+ * @tc.desc: Subscribe overlay change in idle time, or at once if it can not be posted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MainThreadTest, SubscribeOverlayChange_0100, TestSize.Level1)
+{
+    ASSERT_NE(mainThread_, nullptr);
+    std::shared_ptr<Global::Resource::ResourceManager> resourceManager(Global::Resource::CreateResourceManager());
+    HapModuleInfo entryHapModuleInfo;
+    entryHapModuleInfo.moduleName = "entry";
+    mainThread_->SubscribeOverlayChange("com.ohos.demo", "/data/storage/el1/bundle/entry.hap", resourceManager,
+        entryHapModuleInfo);
+
+    auto bakHandler = mainThread_->mainHandler_;
+    mainThread_->mainHandler_ = nullptr;
+    mainThread_->SubscribeOverlayChange("com.ohos.demo", "/data/storage/el1/bundle/entry.hap", resourceManager,
+        entryHapModuleInfo);
+    mainThread_->mainHandler_ = bakHandler;
+    EXPECT_TRUE(mainThread_->overlayModuleInfos_.empty());
+}
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "startup_task_dispatcher.h"
+#undef private
+#include "startup_task.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+class FakeStartupTask : public StartupTask {
+public:
+    explicit FakeStartupTask(const std::string &name) : StartupTask(name)
+    {
+        SetWaitOnMainThread(false);
+    }
+
+    int32_t RunTaskInit(std::unique_ptr<StartupTaskResultCallback> callback) override
+    {
+        state_ = State::INITIALIZING;
+        callback_ = std::move(callback);
+        return ERR_OK;
+    }
+
+    int32_t RunTaskOnDependencyCompleted(const std::string &name,
+        const std::shared_ptr<StartupTaskResult> &result) override
+    {
+        completedDependencies_.emplace_back(name);
+        return ERR_OK;
+    }
+
+    void OnAsyncTaskCompleted(const std::shared_ptr<StartupTaskResult> &result) override
+    {}
+
+    bool IsStarted() const
+    {
+        return callback_ != nullptr;
+    }
+
+    void Complete()
+    {
+        auto result = std::make_shared<StartupTaskResult>();
+        SaveResult(result);
+        auto callback = std::move(callback_);
+        ASSERT_NE(callback, nullptr);
+        callback->Call(result);
+    }
+
+    std::vector<std::string> completedDependencies_;
+
+private:
+    std::unique_ptr<StartupTaskResultCallback> callback_;
+};
+} // namespace
+
+class StartupTaskDispatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<FakeStartupTask> AddTask(const std::string &name, const std::vector<std::string> &dependencies);
+
+    std::map<std::string, std::shared_ptr<StartupTask>> tasks_;
+    std::shared_ptr<StartupSortResult> sortResult_;
+};
+
+void StartupTaskDispatcherTest::SetUpTestCase()
+{}
+
+void StartupTaskDispatcherTest::TearDownTestCase()
+{}
+
+void StartupTaskDispatcherTest::SetUp()
+{
+    // a, b -> c -> d
+    sortResult_ = std::make_shared<StartupSortResult>();
+    AddTask("a", {});
+    AddTask("b", {});
+    AddTask("c", { "a", "b" });
+    AddTask("d", { "c" });
+}
+
+void StartupTaskDispatcherTest::TearDown()
+{
+    tasks_.clear();
+    sortResult_ = nullptr;
+}
+
+std::shared_ptr<FakeStartupTask> StartupTaskDispatcherTest::AddTask(const std::string &name,
+    const std::vector<std::string> &dependencies)
+{
+    auto task = std::make_shared<FakeStartupTask>(name);
+    task->SetDependencies(dependencies);
+    tasks_.emplace(name, task);
+    sortResult_->startupChildrenMap_[name];
+    if (dependencies.empty()) {
+        sortResult_->zeroDequeResult_.emplace_back(name);
+    }
+    for (const auto &dependency : dependencies) {
+        sortResult_->startupChildrenMap_[dependency].emplace_back(name);
+    }
+    return task;
+}
+
+/**
+ * @tc.name: Run_0100
+ * @tc.desc: A task starts only after all of its dependencies completed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, Run_0100, TestSize.Level1)
+{
+    auto a = std::static_pointer_cast<FakeStartupTask>(tasks_["a"]);
+    auto b = std::static_pointer_cast<FakeStartupTask>(tasks_["b"]);
+    auto c = std::static_pointer_cast<FakeStartupTask>(tasks_["c"]);
+    auto d = std::static_pointer_cast<FakeStartupTask>(tasks_["d"]);
+    int32_t completedCount = 0;
+    auto completedCallback = std::make_shared<OnCompletedCallback>(
+        [&completedCount](const std::shared_ptr<StartupTaskResult> &result) {
+            completedCount++;
+        });
+    auto dispatcher = std::make_shared<StartupTaskDispatcher>(tasks_, sortResult_);
+    EXPECT_EQ(dispatcher->Run(completedCallback, nullptr), ERR_OK);
+    EXPECT_TRUE(a->IsStarted());
+    EXPECT_TRUE(b->IsStarted());
+    EXPECT_FALSE(c->IsStarted());
+
+    a->Complete();
+    EXPECT_FALSE(c->IsStarted());
+    EXPECT_EQ(c->completedDependencies_, std::vector<std::string>({ "a" }));
+    b->Complete();
+    EXPECT_TRUE(c->IsStarted());
+    EXPECT_EQ(c->completedDependencies_, std::vector<std::string>({ "a", "b" }));
+    EXPECT_FALSE(d->IsStarted());
+
+    c->Complete();
+    EXPECT_TRUE(d->IsStarted());
+    EXPECT_EQ(completedCount, 0);
+    d->Complete();
+    EXPECT_EQ(completedCount, 1);
+    EXPECT_EQ(dispatcher->tasksCount_, 0);
+    EXPECT_EQ(dispatcher->GetCriticalPathLocked().back(), "d");
+}
+
+/**
+ * @tc.name: Run_0200
+ * @tc.desc: A task already initialized is dispatched without running again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, Run_0200, TestSize.Level1)
+{
+    auto a = std::static_pointer_cast<FakeStartupTask>(tasks_["a"]);
+    auto b = std::static_pointer_cast<FakeStartupTask>(tasks_["b"]);
+    auto c = std::static_pointer_cast<FakeStartupTask>(tasks_["c"]);
+    a->SaveResult(std::make_shared<StartupTaskResult>());
+    auto dispatcher = std::make_shared<StartupTaskDispatcher>(tasks_, sortResult_);
+    EXPECT_EQ(dispatcher->Run(nullptr, nullptr), ERR_OK);
+    EXPECT_FALSE(a->IsStarted());
+    EXPECT_EQ(c->completedDependencies_, std::vector<std::string>({ "a" }));
+    b->Complete();
+    EXPECT_TRUE(c->IsStarted());
+}
+
+/**
+ * @tc.name: GetCriticalPathLocked_0100
+ * @tc.desc: The critical path follows the dependency that completed last.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, GetCriticalPathLocked_0100, TestSize.Level1)
+{
+    auto dispatcher = std::make_shared<StartupTaskDispatcher>(tasks_, sortResult_);
+    EXPECT_TRUE(dispatcher->GetCriticalPathLocked().empty());
+
+    dispatcher->timings_["a"] = { 0, 10 };
+    dispatcher->timings_["b"] = { 0, 30 };
+    dispatcher->timings_["c"] = { 30, 40 };
+    dispatcher->timings_["d"] = { 40, 50 };
+    EXPECT_EQ(dispatcher->GetCriticalPathLocked(), std::vector<std::string>({ "b", "c", "d" }));
+
+    dispatcher->timings_["a"] = { 0, 35 };
+    dispatcher->timings_["c"] = { 35, 40 };
+    EXPECT_EQ(dispatcher->GetCriticalPathLocked(), std::vector<std::string>({ "a", "c", "d" }));
+}
+
+/**
+ * @tc.name: GetCriticalPathLocked_0200
+ * @tc.desc: The critical path ends at the last completed task even if it has no children.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, GetCriticalPathLocked_0200, TestSize.Level1)
+{
+    auto dispatcher = std::make_shared<StartupTaskDispatcher>(tasks_, sortResult_);
+    dispatcher->timings_["a"] = { 0, 10 };
+    dispatcher->timings_["b"] = { 0, 80 };
+    dispatcher->timings_["c"] = { 10, 20 };
+    dispatcher->timings_["d"] = { 20, 30 };
+    EXPECT_EQ(dispatcher->GetCriticalPathLocked(), std::vector<std::string>({ "b" }));
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
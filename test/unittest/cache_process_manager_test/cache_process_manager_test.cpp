@@ -507,5 +507,123 @@ HWTEST_F(CacheProcessManagerTest, CacheProcessManager_IsAppContainsSrvExt_0100,
     
     EXPECT_EQ(cacheProcMgr->IsAppContainsSrvExt(appRunningRecord), true);
 }
+
+/**
+ * @tc.name: CacheProcessManager_CachedProcessQueue_0100
+ * @tc.desc: Test the indexed queue keeps order and removes records by index
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheProcessManagerTest, CacheProcessManager_CachedProcessQueue_0100, TestSize.Level1)
+{
+    CachedProcessQueue queue;
+    auto appRecord1 = MockAppRecord();
+    auto appRecord2 = MockAppRecord();
+    auto appRecord3 = MockAppRecord();
+    EXPECT_EQ(queue.push_back(appRecord1), true);
+    EXPECT_EQ(queue.push_back(appRecord2), true);
+    EXPECT_EQ(queue.push_back(appRecord3), true);
+    EXPECT_EQ(queue.push_back(appRecord1), false);
+    EXPECT_EQ(queue.size(), 3);
+
+    EXPECT_EQ(queue.move_to_back(appRecord1), true);
+    EXPECT_EQ(queue.front(), appRecord2);
+    EXPECT_EQ(queue.erase(appRecord3), true);
+    EXPECT_EQ(queue.erase(appRecord3), false);
+    EXPECT_EQ(queue.count(appRecord3), 0);
+    queue.pop_front();
+    EXPECT_EQ(queue.front(), appRecord1);
+    EXPECT_EQ(queue.size(), 1);
+    queue.clear();
+    EXPECT_EQ(queue.empty(), true);
+}
+
+/**
+ * @tc.name: CacheProcessManager_EvictPolicy_0100
+ * @tc.desc: Test the victims selected by the evict policies
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheProcessManagerTest, CacheProcessManager_EvictPolicy_0100, TestSize.Level1)
+{
+    std::vector<ProcessCacheCandidate> candidates(3);
+    candidates[0].memoryKb = 100;
+    candidates[0].reuseCount = 0;
+    candidates[1].memoryKb = 400;
+    candidates[1].reuseCount = 3;
+    candidates[2].memoryKb = 300;
+    candidates[2].reuseCount = 1;
+
+    FifoProcessCacheEvictPolicy fifoPolicy;
+    EXPECT_EQ(fifoPolicy.SelectVictim(candidates), 0);
+    EXPECT_EQ(fifoPolicy.IsReorderedOnUse(), false);
+    LruProcessCacheEvictPolicy lruPolicy;
+    EXPECT_EQ(lruPolicy.SelectVictim(candidates), 0);
+    EXPECT_EQ(lruPolicy.IsReorderedOnUse(), true);
+    CostWeightedProcessCacheEvictPolicy costPolicy;
+    EXPECT_EQ(costPolicy.IsMemoryWeighted(), true);
+    EXPECT_EQ(costPolicy.SelectVictim(candidates), 2);
+    candidates[0].reuseCount = 1;
+    candidates[2].reuseCount = 3;
+    EXPECT_EQ(costPolicy.SelectVictim(candidates), 1);
+}
+
+/**
+ * @tc.name: CacheProcessManager_ShrinkAndKillCache_0200
+ * @tc.desc: Test the lru policy evicts the least recently used process
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheProcessManagerTest, CacheProcessManager_ShrinkAndKillCache_0200, TestSize.Level1)
+{
+    auto cacheProcMgr = std::make_shared<CacheProcessManager>();
+    cacheProcMgr->maxProcCacheNum_ = 2;
+    cacheProcMgr->maxProcCacheMemoryKb_ = 0;
+    cacheProcMgr->SetEvictPolicy(std::make_shared<LruProcessCacheEvictPolicy>());
+
+    auto appRecord1 = MockAppRecord();
+    auto appRecord2 = MockAppRecord();
+    auto appRecord3 = MockAppRecord();
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord2), true);
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->GetCurrentCachedProcNum(), 2);
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord3), true);
+    EXPECT_EQ(cacheProcMgr->GetCurrentCachedProcNum(), 2);
+    EXPECT_EQ(cacheProcMgr->IsCachedProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->IsCachedProcess(appRecord2), false);
+    EXPECT_EQ(cacheProcMgr->evictCount_, 1);
+
+    std::string result;
+    cacheProcMgr->DumpProcessCache(result);
+    EXPECT_NE(result.find("policy: lru"), std::string::npos);
+    EXPECT_NE(result.find("evict: 1"), std::string::npos);
+}
+
+/**
+ * @tc.name: CacheProcessManager_ReuseCachedProcess_0100
+ * @tc.desc: Test the hit and miss statistics of the process cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheProcessManagerTest, CacheProcessManager_ReuseCachedProcess_0100, TestSize.Level1)
+{
+    auto cacheProcMgr = std::make_shared<CacheProcessManager>();
+    cacheProcMgr->maxProcCacheNum_ = 1;
+    cacheProcMgr->maxProcCacheMemoryKb_ = 0;
+    cacheProcMgr->SetEvictPolicy(std::make_shared<FifoProcessCacheEvictPolicy>());
+
+    auto appRecord1 = MockAppRecord();
+    auto appRecord2 = MockAppRecord();
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->ReuseCachedProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->hitCount_, 1);
+    EXPECT_EQ(cacheProcMgr->bundleReuseCounts_[DEFAULT_BUNDLE_NAME], 1);
+    EXPECT_EQ(cacheProcMgr->ReuseCachedProcess(appRecord1), false);
+
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord1), true);
+    EXPECT_EQ(cacheProcMgr->PenddingCacheProcess(appRecord2), true);
+    EXPECT_EQ(cacheProcMgr->IsCachedProcess(appRecord1), false);
+    cacheProcMgr->OnProcessCreated(MockAppRecord());
+    EXPECT_EQ(cacheProcMgr->missCount_, 1);
+    cacheProcMgr->OnProcessCreated(MockAppRecord());
+    EXPECT_EQ(cacheProcMgr->missCount_, 1);
+}
 } // namespace AppExecFwk
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -15,6 +15,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
 
 #include "uri.h"
 #define private public
@@ -790,5 +791,55 @@ HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleNotifyChange_0100, Tes
     EXPECT_EQ(observer2->onChangeCall_, 1);
 }
 
+/*
+ * Feature: DataObsMgrInnerExt
+ * Function: HandleNotifyChange test
+ * SubFunction: 0200
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription:NotifyChange and RegisterObserver concurrently, notify reads a published snapshot
+ */
+HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleNotifyChange_0200, TestSize.Level1)
+{
+    std::shared_ptr<DataObsMgrInnerExt> dataObsMgrInnerExt = std::make_shared<DataObsMgrInnerExt>();
+    std::string uriBase = "datashare://Authority1/com.domainname.dataability.persondata";
+    constexpr int32_t threadNum = 16;
+    constexpr int32_t loopNum = 200;
+    constexpr int32_t registerInterval = 10;
+
+    std::vector<sptr<MockDataAbilityObserverStub>> observers;
+    for (int32_t i = 0; i < threadNum; i++) {
+        observers.emplace_back(new (std::nothrow) MockDataAbilityObserverStub());
+        Uri uri(uriBase + "/Person" + std::to_string(i));
+        EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(uri, observers[i], true), SUCCESS);
+    }
+
+    auto func = [&dataObsMgrInnerExt, &uriBase](int32_t index, sptr<MockDataAbilityObserverStub> observer) {
+        Uri uri(uriBase + "/Person" + std::to_string(index));
+        for (int32_t i = 0; i < loopNum; i++) {
+            if (i % registerInterval == 0) {
+                Uri childUri(uriBase + "/Person" + std::to_string(index) + "/" + std::to_string(i));
+                EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(childUri, observer, false), SUCCESS);
+                continue;
+            }
+            EXPECT_EQ(dataObsMgrInnerExt->HandleNotifyChange({ ChangeInfo::ChangeType::INSERT, { uri } }), SUCCESS);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < threadNum; i++) {
+        threads.emplace_back(func, i, observers[i]);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int32_t i = 0; i < threadNum; i++) {
+        EXPECT_EQ(observers[i]->onChangeCall_, loopNum - loopNum / registerInterval);
+        EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(observers[i]), SUCCESS);
+    }
+    EXPECT_TRUE(dataObsMgrInnerExt->root_->childrens_.empty());
+    EXPECT_TRUE(dataObsMgrInnerExt->obsRecipientRefs.empty());
+}
+
 } // namespace DataObsMgrInnerExtTest
 } // namespace OHOS
@@ -340,5 +340,64 @@ HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_RemoveObs_0100, TestSize.Level1)
     dataObsMgrInner->observers_.emplace(uri2, obsList2);
     dataObsMgrInner->RemoveObs(callback2->AsObject());
 }
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleNotifyChange function test
+ * SubFunction: SetHandler
+ * FunctionPoints: OnChange of every observer is fanned out on the handler
+ * EnvConditions: NA
+ * CaseDescription:NA
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleNotifyChange_0400, TestSize.Level1)
+{
+    std::shared_ptr<DataObsMgrInner> dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    ASSERT_NE(dataObsMgrInner, nullptr);
+    dataObsMgrInner->SetHandler(TaskHandlerWrap::GetFfrtHandler());
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> observer1(new (std::nothrow) MockDataAbilityObserverStub());
+    sptr<MockDataAbilityObserverStub> observer2(new (std::nothrow) MockDataAbilityObserverStub());
+    EXPECT_CALL(*observer1, OnChange()).Times(1).WillOnce(Invoke(observer1.GetRefPtr(),
+        &MockDataAbilityObserverStub::PostVoid));
+    EXPECT_CALL(*observer2, OnChange()).Times(1).WillOnce(Invoke(observer2.GetRefPtr(),
+        &MockDataAbilityObserverStub::PostVoid));
+    const sptr<IDataAbilityObserver> callback1(new (std::nothrow) DataAbilityObserverProxy(observer1));
+    const sptr<IDataAbilityObserver> callback2(new (std::nothrow) DataAbilityObserverProxy(observer2));
+    dataObsMgrInner->HandleRegisterObserver(uri, callback1);
+    dataObsMgrInner->HandleRegisterObserver(uri, callback2);
+
+    EXPECT_EQ(dataObsMgrInner->HandleNotifyChange(uri), NO_ERROR);
+    observer1->Wait();
+    observer2->Wait();
+    dataObsMgrInner->SetHandler(nullptr);
+}
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: DispatchOnChange function test
+ * SubFunction: BeginDispatch/EndDispatch
+ * FunctionPoints: An observer blocked longer than the timeout is skipped
+ * EnvConditions: NA
+ * CaseDescription:NA
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_DispatchOnChange_0100, TestSize.Level1)
+{
+    std::shared_ptr<DataObsMgrInner> dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    ASSERT_NE(dataObsMgrInner, nullptr);
+    sptr<MockDataAbilityObserverStub> observer(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(observer));
+    EXPECT_CALL(*observer, OnChange()).Times(1);
+
+    auto &state = dataObsMgrInner->dispatching_[callback->AsObject()];
+    state.inflight = 1;
+    state.startTime = 0;
+    dataObsMgrInner->DispatchOnChange(callback);
+    EXPECT_EQ(dataObsMgrInner->dispatching_[callback->AsObject()].inflight, 1);
+
+    dataObsMgrInner->EndDispatch(callback->AsObject());
+    EXPECT_TRUE(dataObsMgrInner->dispatching_.empty());
+    dataObsMgrInner->DispatchOnChange(callback);
+    EXPECT_TRUE(dataObsMgrInner->dispatching_.empty());
+}
 }  // namespace AAFwk
 }  // namespace OHOS
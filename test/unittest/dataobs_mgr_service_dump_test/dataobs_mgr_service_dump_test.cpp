@@ -105,5 +105,26 @@ HWTEST_F(DataobsMgrServiceDumpTest, DataobsMgrServiceDump_0300, TestSize.Level1)
 
     TAG_LOGI(AAFwkTag::TEST, "DataobsMgrServiceDump_0300 end");
 }
+
+/*
+ * @tc.number    : DataobsMgrServiceDump_0400
+ * @tc.name      : DataobsMgrService dump
+ * @tc.desc      : 1.Test dump statistics
+ */
+HWTEST_F(DataobsMgrServiceDumpTest, DataobsMgrServiceDump_0400, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "DataobsMgrServiceDump_0400 start");
+
+    auto dataobsMgrService = std::make_shared<DataObsMgrService>();
+    EXPECT_NE(dataobsMgrService, nullptr);
+
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16("-s"));
+    std::string result;
+    dataobsMgrService->Dump(args, result);
+    EXPECT_NE(result.find("coalesced"), std::string::npos);
+
+    TAG_LOGI(AAFwkTag::TEST, "DataobsMgrServiceDump_0400 end");
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -18,6 +18,7 @@
 #include "gmock/gmock.h"
 
 #include "mock_data_ability_observer_stub.h"
+#include "parameters.h"
 #define private public
 #include "dataobs_mgr_service.h"
 
@@ -587,5 +588,213 @@ HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_Dump_0100, TestSize.
 
     GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_Dump_0100 end";
 }
+
+/*
+ * Feature: DataObsMgrService
+ * Function: NotifyChange
+ * SubFunction: CoalesceChange
+ * FunctionPoints: DataObsMgrService merges notifications of the same uri in the coalesce window
+ * EnvConditions: NA
+ * CaseDescription: Verify that the duplicated uris are delivered once by the flush.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0100 start";
+    // the scheduled flush never fires during the case, it is driven explicitly.
+    constexpr int64_t windowMs = 600000;
+    constexpr uint64_t notifyCount = 3;
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    dataObsMgrServer->handler_ = TaskHandlerWrap::GetFfrtHandler();
+    dataObsMgrServer->SetCoalesceWindow(windowMs);
+
+    sptr<MockDataAbilityObserverStub> observer(new (std::nothrow) MockDataAbilityObserverStub());
+    EXPECT_CALL(*observer, OnChange()).Times(1);
+    EXPECT_EQ(NO_ERROR, dataObsMgrServer->RegisterObserver(uri, observer));
+    for (uint64_t i = 0; i < notifyCount; i++) {
+        EXPECT_EQ(NO_ERROR, dataObsMgrServer->NotifyChange(uri));
+    }
+    EXPECT_EQ(dataObsMgrServer->pendingChanges_.changes.size(), 1u);
+    EXPECT_TRUE(dataObsMgrServer->pendingChanges_.isFlushScheduled);
+    EXPECT_EQ(dataObsMgrServer->taskCount_, 1u);
+
+    dataObsMgrServer->FlushPendingChanges();
+    EXPECT_EQ(dataObsMgrServer->receivedCount_.load(), notifyCount);
+    EXPECT_EQ(dataObsMgrServer->coalescedCount_.load(), notifyCount - 1);
+    EXPECT_EQ(dataObsMgrServer->deliveredCount_.load(), 1u);
+    EXPECT_EQ(dataObsMgrServer->taskCount_, 0u);
+
+    // a second flush has nothing to deliver and must not release the task slot again.
+    dataObsMgrServer->FlushPendingChanges();
+    EXPECT_EQ(dataObsMgrServer->deliveredCount_.load(), 1u);
+    EXPECT_EQ(dataObsMgrServer->taskCount_, 0u);
+    dataObsMgrServer->UnregisterObserver(uri, observer);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0100 end";
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: NotifyChangeExt
+ * SubFunction: SetCoalesceWindow
+ * FunctionPoints: DataObsMgrService notify immediately when the coalesce window is 0
+ * EnvConditions: NA
+ * CaseDescription: Verify that coalescing is off by default and nothing is pending when it is disabled.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0200 start";
+    Uri uri("dataobs://authority/com.domainname.dataability.persondata/person/10");
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    EXPECT_FALSE(dataObsMgrServer->IsCoalesceEnabled());
+    dataObsMgrServer->handler_ = TaskHandlerWrap::GetFfrtHandler();
+    dataObsMgrServer->SetCoalesceWindow(0);
+
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::UPDATE, { uri, uri } }));
+    EXPECT_FALSE(dataObsMgrServer->pendingChanges_.isFlushScheduled);
+    EXPECT_EQ(dataObsMgrServer->coalescedCount_.load(), 0u);
+    EXPECT_EQ(dataObsMgrServer->deliveredCount_.load(), 2u);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0200 end";
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: NotifyChangeExt
+ * SubFunction: CoalesceChange
+ * FunctionPoints: DataObsMgrService keeps the arrival order of the changes of a uri
+ * EnvConditions: NA
+ * CaseDescription: Verify that a change only merges into the last pending change of its uri.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0300, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0300 start";
+    Uri uriA("dataobs://authority/com.domainname.dataability.persondata/person/10");
+    Uri uriB("dataobs://authority/com.domainname.dataability.persondata/person/11");
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    dataObsMgrServer->handler_ = TaskHandlerWrap::GetFfrtHandler();
+    dataObsMgrServer->SetCoalesceWindow(600000);
+
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::INSERT, { uriA, uriB } }));
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::DELETE, { uriA } }));
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::INSERT, { uriA, uriB } }));
+
+    auto &changes = dataObsMgrServer->pendingChanges_.changes;
+    ASSERT_EQ(changes.size(), 4u);
+    EXPECT_EQ(changes[0].changeType, ChangeInfo::ChangeType::INSERT);
+    EXPECT_EQ(changes[0].uri.ToString(), uriA.ToString());
+    EXPECT_EQ(changes[1].changeType, ChangeInfo::ChangeType::INSERT);
+    EXPECT_EQ(changes[1].uri.ToString(), uriB.ToString());
+    EXPECT_EQ(changes[2].changeType, ChangeInfo::ChangeType::DELETE);
+    EXPECT_EQ(changes[2].uri.ToString(), uriA.ToString());
+    EXPECT_EQ(changes[3].changeType, ChangeInfo::ChangeType::INSERT);
+    EXPECT_EQ(changes[3].uri.ToString(), uriA.ToString());
+    EXPECT_EQ(dataObsMgrServer->coalescedCount_.load(), 1u);
+
+    dataObsMgrServer->FlushPendingChanges();
+    EXPECT_EQ(dataObsMgrServer->deliveredCount_.load(), 4u);
+    EXPECT_EQ(dataObsMgrServer->taskCount_, 0u);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0300 end";
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: NotifyChangeExt
+ * SubFunction: CoalesceChange
+ * FunctionPoints: DataObsMgrService delivers the pending changes ahead of an immediate notification
+ * EnvConditions: NA
+ * CaseDescription: Verify that a notification carrying value buckets takes the pending changes with it.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0400, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0400 start";
+    Uri uri("dataobs://authority/com.domainname.dataability.persondata/person/10");
+    // the immediate task outlives the case, the service must stay alive for it.
+    auto dataObsMgrServer = DelayedSingleton<DataObsMgrService>::GetInstance();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    dataObsMgrServer->handler_ = TaskHandlerWrap::GetFfrtHandler();
+    dataObsMgrServer->SetCoalesceWindow(600000);
+
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::INSERT, { uri } }));
+    EXPECT_EQ(dataObsMgrServer->pendingChanges_.changes.size(), 1u);
+
+    ChangeInfo changeInfo = { ChangeInfo::ChangeType::UPDATE, { uri } };
+    changeInfo.valueBuckets_.push_back({ { "id", static_cast<int64_t>(1) } });
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt(changeInfo));
+    EXPECT_TRUE(dataObsMgrServer->pendingChanges_.changes.empty());
+    EXPECT_TRUE(dataObsMgrServer->pendingChanges_.lastIndexes.empty());
+    // the scheduled flush still owns its task slot and releases it when it runs.
+    EXPECT_TRUE(dataObsMgrServer->pendingChanges_.isFlushScheduled);
+    dataObsMgrServer->FlushPendingChanges();
+    dataObsMgrServer->SetCoalesceWindow(0);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0400 end";
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: NotifyChangeExt
+ * SubFunction: CoalesceChange
+ * FunctionPoints: DataObsMgrService limits the number of pending uris
+ * EnvConditions: NA
+ * CaseDescription: Verify that the limit counts the pending uris after the duplicates are merged.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0500, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0500 start";
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    dataObsMgrServer->handler_ = TaskHandlerWrap::GetFfrtHandler();
+    dataObsMgrServer->SetCoalesceWindow(600000);
+
+    ChangeInfo changeInfo = { ChangeInfo::ChangeType::UPDATE, {} };
+    for (int i = 0; i < ChangeInfo::LIST_MAX_COUNT; i++) {
+        changeInfo.uris_.emplace_back("dataobs://authority/com.domainname.dataability.persondata/person/" +
+            std::to_string(i));
+    }
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt(changeInfo));
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt(changeInfo));
+    EXPECT_EQ(dataObsMgrServer->coalescedCount_.load(), static_cast<uint64_t>(ChangeInfo::LIST_MAX_COUNT));
+
+    Uri uri("dataobs://authority/com.domainname.dataability.persondata/person/new");
+    EXPECT_EQ(DATAOBS_SERVICE_TASK_LIMMIT,
+        dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::UPDATE, { uri } }));
+    EXPECT_EQ(dataObsMgrServer->pendingChanges_.changes.size(), static_cast<size_t>(ChangeInfo::LIST_MAX_COUNT));
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0500 end";
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: Init
+ * SubFunction: CoalesceChange
+ * FunctionPoints: DataObsMgrService reads the coalesce window from the system parameter
+ * EnvConditions: NA
+ * CaseDescription: Verify that the window configured by the parameter turns coalescing on at init.
+ */
+HWTEST_F(DataObsMgrServiceTest, AaFwk_DataObsMgrServiceTest_CoalesceChange_0600, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0600 start";
+    const std::string parameter = "persist.sys.abilityms.dataObsCoalesceWindowMs";
+    auto originWindow = OHOS::system::GetParameter(parameter, "0");
+    ASSERT_TRUE(OHOS::system::SetParameter(parameter, "600000"));
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    ASSERT_NE(dataObsMgrServer, nullptr);
+    EXPECT_TRUE(dataObsMgrServer->Init());
+    EXPECT_EQ(dataObsMgrServer->coalesceWindowMs_.load(), 600000);
+    EXPECT_TRUE(dataObsMgrServer->IsCoalesceEnabled());
+
+    Uri uri("dataobs://authority/com.domainname.dataability.persondata/person/10");
+    EXPECT_EQ(SUCCESS, dataObsMgrServer->NotifyChangeExt({ ChangeInfo::ChangeType::UPDATE, { uri, uri } }));
+    EXPECT_EQ(dataObsMgrServer->pendingChanges_.changes.size(), 1u);
+    EXPECT_EQ(dataObsMgrServer->coalescedCount_.load(), 1u);
+    dataObsMgrServer->FlushPendingChanges();
+    EXPECT_EQ(dataObsMgrServer->deliveredCount_.load(), 1u);
+
+    ASSERT_TRUE(OHOS::system::SetParameter(parameter, "-1"));
+    EXPECT_TRUE(dataObsMgrServer->Init());
+    EXPECT_FALSE(dataObsMgrServer->IsCoalesceEnabled());
+    OHOS::system::SetParameter(parameter, originWindow);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsMgrServiceTest_CoalesceChange_0600 end";
+}
 }  // namespace AAFwk
 }  // namespace OHOS
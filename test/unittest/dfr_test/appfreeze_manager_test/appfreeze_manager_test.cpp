@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <sstream>
 
 #define private public
 #include "appfreeze_manager.h"
@@ -200,5 +201,35 @@ HWTEST_F(AppfreezeManagerTest, AppfreezeManagerTest_006, TestSize.Level1)
     result = appfreezeManager->IsNeedIgnoreFreezeEvent(pid);
     EXPECT_TRUE(result);
 }
+
+/**
+ * @tc.number: AppfreezeManagerTest_007
+ * @tc.desc: BinderParser keeps the whole dump and parses the peer pids of every sync transaction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppfreezeManagerTest, AppfreezeManagerTest_007, TestSize.Level1)
+{
+    constexpr int lineNum = 100000;
+    constexpr int pidNum = 1000;
+    std::string dump;
+    for (int i = 0; i < lineNum; i++) {
+        int client = i % pidNum;
+        dump += std::to_string(client) + ":" + std::to_string(client) + " to " + std::to_string(client + 1) + ":" +
+            std::to_string(client + 1) + " code 3 wait:1.234 s\n";
+    }
+    dump += "1:1 to 2:2 code 3 wait:1.234 s async\n";
+    dump += "binder context\n";
+    dump += "5:5 to 7:7 code 3 wait:1.234 s";
+    std::istringstream fin(dump);
+    std::string stack;
+    auto binderInfo = appfreezeManager->BinderParser(fin, stack);
+    EXPECT_EQ(stack, "BinderCatcher --\n\n" + dump + "\n");
+    EXPECT_EQ(binderInfo.size(), pidNum);
+    EXPECT_EQ(binderInfo[5], std::set<int>({ 6 }));
+
+    std::set<int> pids;
+    appfreezeManager->ParseBinderPids(binderInfo, pids, 0, 0);
+    EXPECT_EQ(pids, std::set<int>({ 1, 2, 3, 4, 5, 6, 7 }));
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -133,5 +133,37 @@ HWTEST_F(IdleTimeTest, GetIdleNotifyFunc_0100, Function | MediumTest | Level1)
 
     GTEST_LOG_(INFO) << "IdleTimeTest GetIdleNotifyFunc_0100 end";
 }
+
+/**
+ * @tc.number: PostIdleTask_0100
+ * @tc.name: PostIdleTask
+ * @tc.desc: Test idle tasks run only in an idle window they fit in, or once their deadline is reached.
+ */
+HWTEST_F(IdleTimeTest, PostIdleTask_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "IdleTimeTest PostIdleTask_0100 start";
+    constexpr int64_t nsPerMs = 1000000;
+    std::vector<std::string> runTasks;
+    EXPECT_FALSE(idleTime_->PostIdleTask("nullTask", nullptr, 1));
+    EXPECT_TRUE(idleTime_->PostIdleTask("late", [&runTasks]() { runTasks.emplace_back("late"); }, 1, 2000));
+    EXPECT_TRUE(idleTime_->PostIdleTask("early", [&runTasks]() { runTasks.emplace_back("early"); }, 1, 1000));
+    EXPECT_TRUE(idleTime_->PostIdleTask("heavy", [&runTasks]() { runTasks.emplace_back("heavy"); }, 100));
+    EXPECT_TRUE(idleTime_->PostIdleTask("removed", [&runTasks]() { runTasks.emplace_back("removed"); }, 1));
+    idleTime_->RemoveIdleTask("removed");
+    EXPECT_EQ(idleTime_->GetIdleTaskCount(), 3);
+
+    int64_t leftTime = idleTime_->RunIdleTasks(16 * nsPerMs);
+    EXPECT_GT(leftTime, 0);
+    EXPECT_EQ(runTasks, std::vector<std::string>({ "early", "late" }));
+    EXPECT_EQ(idleTime_->GetIdleTaskCount(), 1);
+
+    uint64_t heavyId = idleTime_->idleTasks_.begin()->second.id;
+    idleTime_->RunExpiredIdleTask(heavyId);
+    EXPECT_EQ(runTasks.back(), "heavy");
+    EXPECT_EQ(idleTime_->GetIdleTaskCount(), 0);
+    idleTime_->RunExpiredIdleTask(heavyId);
+    EXPECT_EQ(runTasks.size(), 3);
+    GTEST_LOG_(INFO) << "IdleTimeTest PostIdleTask_0100 end";
+}
 }
 }
\ No newline at end of file
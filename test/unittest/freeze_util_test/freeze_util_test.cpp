@@ -98,5 +98,29 @@ HWTEST_F(FreezeUtilTest, FreezeUtilTest_003, TestSize.Level1)
     EXPECT_EQ(FreezeUtil::GetInstance().GetLifecycleEvent(backgroundFlow), "");
     TAG_LOGI(AAFwkTag::TEST, "FreezeUtilTest_003 is end");
 }
+
+/*
+ * @tc.number    : FreezeUtilTest_004
+ * @tc.name      : FreezeUtilTest
+ * @tc.desc      : Test Function AddLifecycleEvent() keeps only the latest entries of a flow
+ */
+HWTEST_F(FreezeUtilTest, FreezeUtilTest_004, TestSize.Level1)
+{
+    sptr<IRemoteObject> token_(new IPCObjectStub());
+    FreezeUtil::LifecycleFlow flow = { token_, FreezeUtil::TimeoutState::FOREGROUND };
+    const size_t entryNum = 100;
+    for (size_t i = 0; i < entryNum; i++) {
+        FreezeUtil::GetInstance().AddLifecycleEvent(flow, "entry" + std::to_string(i));
+    }
+    std::string expected;
+    for (size_t i = entryNum - FreezeUtil::MAX_LIFECYCLE_EVENT_NUM; i < entryNum; i++) {
+        expected += (expected.empty() ? "" : "\n") + std::string("entry") + std::to_string(i);
+    }
+    EXPECT_EQ(FreezeUtil::GetInstance().GetLifecycleEvent(flow), expected);
+
+    FreezeUtil::GetInstance().DeleteLifecycleEvent(token_);
+    EXPECT_EQ(FreezeUtil::GetInstance().GetLifecycleEvent(flow), "");
+    TAG_LOGI(AAFwkTag::TEST, "FreezeUtilTest_004 is end");
+}
 }
 }
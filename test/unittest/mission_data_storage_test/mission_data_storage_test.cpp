@@ -14,6 +14,8 @@
  */
 
 #include <gtest/gtest.h>
+#include "directory_ex.h"
+#include "file_ex.h"
 #define private public
 #define protected public
 #include "mission_data_storage.h"
@@ -549,5 +551,98 @@ HWTEST_F(MissionDataStorageTest, GetPixelMap_002, TestSize.Level1)
     std::unique_ptr<Media::PixelMap> res = missionDataStorage->GetPixelMap(missionId, isLowResolution);
     EXPECT_EQ(res, nullptr);
 }
+
+/*
+ * Feature: MissionDataStorage
+ * Function: FlushPendingMissionInfo
+ * SubFunction: NA
+ * FunctionPoints: MissionDataStorage EnqueueSaveMissionInfo FlushPendingMissionInfo LoadAllMissionInfo
+ * EnvConditions: NA
+ * CaseDescription: Verify queued updates are batched and reloaded from the journal
+ */
+HWTEST_F(MissionDataStorageTest, FlushPendingMissionInfo_001, TestSize.Level1)
+{
+    int32_t userId = 1001;
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(userId);
+    OHOS::ForceRemoveDirectory(missionDataStorage->GetMissionDataDirPath());
+    InnerMissionInfo missionInfo;
+    missionInfo.missionInfo.id = 1;
+    missionInfo.missionName = "first";
+    EXPECT_TRUE(missionDataStorage->EnqueueSaveMissionInfo(missionInfo));
+    missionInfo.missionName = "second";
+    EXPECT_FALSE(missionDataStorage->EnqueueSaveMissionInfo(missionInfo));
+    missionInfo.missionInfo.id = 2;
+    EXPECT_FALSE(missionDataStorage->EnqueueSaveMissionInfo(missionInfo));
+    EXPECT_FALSE(missionDataStorage->EnqueueDeleteMissionInfo(2));
+    missionDataStorage->FlushPendingMissionInfo();
+    EXPECT_TRUE(missionDataStorage->pendingRecords_.empty());
+    EXPECT_EQ(missionDataStorage->journalRecordCount_, 2u);
+
+    auto reloadStorage = std::make_shared<MissionDataStorage>(userId);
+    std::list<InnerMissionInfo> missionInfoList;
+    EXPECT_TRUE(reloadStorage->LoadAllMissionInfo(missionInfoList));
+    ASSERT_EQ(missionInfoList.size(), 1u);
+    EXPECT_EQ(missionInfoList.front().missionInfo.id, 1);
+    EXPECT_EQ(missionInfoList.front().missionName, "second");
+    EXPECT_EQ(reloadStorage->journalRecordCount_, 1u);
+    OHOS::ForceRemoveDirectory(missionDataStorage->GetMissionDataDirPath());
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: LoadAllMissionInfo
+ * SubFunction: NA
+ * FunctionPoints: MissionDataStorage LoadAllMissionInfo
+ * EnvConditions: NA
+ * CaseDescription: Verify a torn journal tail is dropped and later appends stay readable
+ */
+HWTEST_F(MissionDataStorageTest, LoadAllMissionInfo_001, TestSize.Level1)
+{
+    int32_t userId = 1002;
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(userId);
+    OHOS::ForceRemoveDirectory(missionDataStorage->GetMissionDataDirPath());
+    InnerMissionInfo missionInfo;
+    missionInfo.missionInfo.id = 1;
+    missionDataStorage->SaveMissionInfo(missionInfo);
+    missionInfo.missionInfo.id = 2;
+    std::string tornRecord = MissionDataStorage::EncodeJournalRecord({ 2, false, missionInfo.ToJsonStr() });
+    tornRecord.resize(tornRecord.size() / 2);
+    EXPECT_TRUE(OHOS::SaveStringToFile(missionDataStorage->GetMissionJournalFilePath(), tornRecord, false));
+
+    auto reloadStorage = std::make_shared<MissionDataStorage>(userId);
+    std::list<InnerMissionInfo> missionInfoList;
+    EXPECT_TRUE(reloadStorage->LoadAllMissionInfo(missionInfoList));
+    ASSERT_EQ(missionInfoList.size(), 1u);
+    EXPECT_EQ(missionInfoList.front().missionInfo.id, 1);
+
+    missionInfo.missionInfo.id = 3;
+    reloadStorage->SaveMissionInfo(missionInfo);
+    missionInfoList.clear();
+    auto thirdStorage = std::make_shared<MissionDataStorage>(userId);
+    EXPECT_TRUE(thirdStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 2u);
+    OHOS::ForceRemoveDirectory(missionDataStorage->GetMissionDataDirPath());
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: DecodeJournalRecord
+ * SubFunction: NA
+ * FunctionPoints: MissionDataStorage EncodeJournalRecord DecodeJournalRecord
+ * EnvConditions: NA
+ * CaseDescription: Verify journal record round trip and length check
+ */
+HWTEST_F(MissionDataStorageTest, DecodeJournalRecord_001, TestSize.Level1)
+{
+    std::string line = MissionDataStorage::EncodeJournalRecord({ 12, false, "{\"a\":1}" });
+    line.pop_back();
+    MissionDataStorage::JournalRecord record;
+    EXPECT_TRUE(MissionDataStorage::DecodeJournalRecord(line, record));
+    EXPECT_EQ(record.missionId, 12);
+    EXPECT_FALSE(record.isDelete);
+    EXPECT_EQ(record.content, "{\"a\":1}");
+    EXPECT_FALSE(MissionDataStorage::DecodeJournalRecord(line.substr(0, line.size() - 1), record));
+    EXPECT_FALSE(MissionDataStorage::DecodeJournalRecord("X 1 0 ", record));
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -72,6 +72,7 @@ HWTEST_F(MissionListDumpTest, MissionListDump_DumpList_0100, TestSize.Level0)
     EXPECT_NE(missionList, nullptr);
 
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
 
     std::vector<std::string> info;
     bool isClient = false;
@@ -106,6 +107,7 @@ HWTEST_F(MissionListDumpTest, MissionListDump_DumpStateByRecordId_0100, TestSize
     EXPECT_NE(missionList, nullptr);
 
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
 
     std::vector<std::string> info;
     bool isClient = false;
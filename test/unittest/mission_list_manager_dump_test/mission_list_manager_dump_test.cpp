@@ -105,6 +105,7 @@ HWTEST_F(MissionListManagerDumpTest, MissionListManager_DumpMissionListByRecordI
     auto missionList = std::make_shared<MissionList>();
     EXPECT_NE(missionList, nullptr);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
 
     auto missionListManager = std::make_shared<MissionListManager>(USER_ID);
     EXPECT_NE(missionListManager, nullptr);
@@ -147,6 +148,7 @@ HWTEST_F(MissionListManagerDumpTest, MissionListManager_OnAppStateChanged_0100,
     auto missionListManager = std::make_shared<MissionListManager>(USER_ID);
     EXPECT_NE(missionListManager, nullptr);
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
 
     AppInfo info;
     info.processName = STRING_PROCESS_NAME;
@@ -175,6 +175,7 @@ HWTEST_F(MissionListManagerTest, StartAbility_002, TestSize.Level1)
     mission->SetSpecifiedFlag(flag);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->launcherList_ = missionList;
     AbilityRequest abilityRequest;
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SPECIFIED;
@@ -672,6 +673,7 @@ HWTEST_F(MissionListManagerTest, StartWaitingAbility_001, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_front(missionList);
     missionListManager->StartWaitingAbility();
     missionListManager.reset();
@@ -694,6 +696,7 @@ HWTEST_F(MissionListManagerTest, StartWaitingAbility_002, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_front(missionList);
     missionListManager->StartWaitingAbility();
     missionListManager.reset();
@@ -716,6 +719,7 @@ HWTEST_F(MissionListManagerTest, StartWaitingAbility_003, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_front(missionList);
     AbilityRequest abilityRequest;
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SPECIFIED;
@@ -743,6 +747,7 @@ HWTEST_F(MissionListManagerTest, StartWaitingAbility_004, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_front(missionList);
     AbilityRequest abilityRequest;
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SPECIFIED;
@@ -864,6 +869,7 @@ HWTEST_F(MissionListManagerTest, CreateOrReusedMissionInfo_005, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultStandardList_ = std::make_shared<MissionList>();
     missionListManager->launcherList_ = std::make_shared<MissionList>();
     missionListManager->currentMissionLists_.push_front(missionList);
@@ -903,6 +909,7 @@ HWTEST_F(MissionListManagerTest, CreateOrReusedMissionInfo_006, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultStandardList_= missionList;
     missionListManager->launcherList_ = std::make_shared<MissionList>();
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
@@ -944,9 +951,11 @@ HWTEST_F(MissionListManagerTest, CreateOrReusedMissionInfo_007, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
     missionList2->missions_.push_front(mission2);
+    missionList2->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultStandardList_ = std::make_shared<MissionList>();
     missionListManager->currentMissionLists_.push_front(missionList2);
     missionListManager->launcherList_ = missionList;
@@ -1173,6 +1182,7 @@ HWTEST_F(MissionListManagerTest, GetReusedMission_004, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
     abilityRequest.abilityInfo.applicationInfo.isLauncherApp = true;
     missionListManager->launcherList_ = missionList;
@@ -1201,6 +1211,7 @@ HWTEST_F(MissionListManagerTest, GetReusedMission_005, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
     abilityRequest.abilityInfo.applicationInfo.isLauncherApp = false;
     missionListManager->currentMissionLists_.push_front(missionList);
@@ -1229,6 +1240,7 @@ HWTEST_F(MissionListManagerTest, GetReusedMission_006, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(3, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
     abilityRequest.abilityInfo.applicationInfo.isLauncherApp = false;
     missionListManager->defaultSingleList_ = missionList;
@@ -1277,6 +1289,7 @@ HWTEST_F(MissionListManagerTest, GetReusedSpecifiedMission_002, TestSize.Level1)
     mission->SetSpecifiedFlag(flag);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->launcherList_ = missionList;
     AbilityRequest abilityRequest;
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SPECIFIED;
@@ -1308,6 +1321,7 @@ HWTEST_F(MissionListManagerTest, GetReusedSpecifiedMission_003, TestSize.Level1)
     mission->SetSpecifiedFlag(flag);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultStandardList_ = missionList;
     missionListManager->launcherList_ = std::make_shared<MissionList>();
     missionListManager->currentMissionLists_.clear();
@@ -1341,6 +1355,7 @@ HWTEST_F(MissionListManagerTest, GetReusedSpecifiedMission_004, TestSize.Level1)
     mission->SetSpecifiedFlag(flag);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultStandardList_ = std::make_shared<MissionList>();
     missionListManager->launcherList_ = std::make_shared<MissionList>();
     missionListManager->currentMissionLists_.push_front(missionList);
@@ -1488,6 +1503,7 @@ HWTEST_F(MissionListManagerTest, MoveNoneTopMissionToDefaultList_002, TestSize.L
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     mission->SetMissionList(missionList);
     missionListManager->MoveNoneTopMissionToDefaultList(mission);
     missionListManager.reset();
@@ -1536,6 +1552,7 @@ HWTEST_F(MissionListManagerTest, MoveNoneTopMissionToDefaultList_004, TestSize.L
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     mission->SetMissionList(missionList);
     missionListManager->MoveNoneTopMissionToDefaultList(mission);
     missionListManager.reset();
@@ -1561,6 +1578,7 @@ HWTEST_F(MissionListManagerTest, MoveNoneTopMissionToDefaultList_005, TestSize.L
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord, missionName);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     mission->SetMissionList(missionList);
     missionListManager->MoveNoneTopMissionToDefaultList(mission);
     missionListManager.reset();
@@ -1697,6 +1715,7 @@ HWTEST_F(MissionListManagerTest, AttachAbilityThread_001, TestSize.Level1)
     bool isFlag = true;
     abilityRecord->SetStartedByCall(isFlag);
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->AttachAbilityThread(scheduler, token);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
     missionListManager.reset();
@@ -1758,6 +1777,7 @@ HWTEST_F(MissionListManagerTest, OnAppStateChanged_001, TestSize.Level1)
     info.processName = processName;
     missionListManager->terminateAbilityList_.push_back(nullptr);
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->OnAppStateChanged(info);
     missionListManager.reset();
 }
@@ -1785,7 +1805,9 @@ HWTEST_F(MissionListManagerTest, OnAppStateChanged_002, TestSize.Level1)
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
     missionList->missions_.push_back(nullptr);
     missionList->missions_.push_back(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     AppInfo info;
     info.processName = processName;
     missionListManager->currentMissionLists_.push_back(missionList);
@@ -1812,7 +1834,9 @@ HWTEST_F(MissionListManagerTest, GetAbilityRecordByToken_001, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     auto res = missionListManager->GetAbilityRecordByToken(token);
@@ -1837,6 +1861,7 @@ HWTEST_F(MissionListManagerTest, GetMissionById_001, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     auto res = missionListManager->GetMissionById(missionId);
@@ -1862,6 +1887,7 @@ HWTEST_F(MissionListManagerTest, GetMissionById_002, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList2;
     missionListManager->launcherList_ = missionList;
@@ -1889,7 +1915,9 @@ HWTEST_F(MissionListManagerTest, AbilityTransactionDone_001, TestSize.Level1)
     int state = 0;
     PacMap saveData;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->defaultSingleList_ = missionList;
     int res = missionListManager->AbilityTransactionDone(token, state, saveData);
     EXPECT_EQ(res, INNER_ERR);
@@ -1915,7 +1943,9 @@ HWTEST_F(MissionListManagerTest, AbilityTransactionDone_002, TestSize.Level1)
     int state = 6;
     PacMap saveData;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->defaultSingleList_ = missionList;
     int res = missionListManager->AbilityTransactionDone(token, state, saveData);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
@@ -2342,6 +2372,7 @@ HWTEST_F(MissionListManagerTest, CompleteBackground_003, TestSize.Level1)
     abilityRecord->SetStartToBackground(true);
     abilityRecord->isReady_ = true;
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteBackground(abilityRecord);
     missionListManager.reset();
 }
@@ -2368,6 +2399,7 @@ HWTEST_F(MissionListManagerTest, CompleteBackground_004, TestSize.Level1)
     abilityRecord->isReady_ = true;
     abilityRecord2->currentState_ = AbilityState::BACKGROUND;
     missionListManager->terminateAbilityList_.push_back(abilityRecord2);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord2);
     missionListManager->CompleteBackground(abilityRecord);
     missionListManager.reset();
 }
@@ -2394,6 +2426,7 @@ HWTEST_F(MissionListManagerTest, CompleteBackground_005, TestSize.Level1)
     abilityRecord->isReady_ = true;
     abilityRecord2->currentState_ = AbilityState::BACKGROUND;
     missionListManager->terminateAbilityList_.push_back(abilityRecord2);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord2);
     missionListManager->CompleteBackground(abilityRecord);
     missionListManager.reset();
 }
@@ -2420,6 +2453,7 @@ HWTEST_F(MissionListManagerTest, CompleteBackground_006, TestSize.Level1)
     abilityRecord->isReady_ = false;
     abilityRecord2->currentState_ = AbilityState::FOREGROUND;
     missionListManager->terminateAbilityList_.push_back(abilityRecord2);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord2);
     missionListManager->CompleteBackground(abilityRecord);
     missionListManager.reset();
 }
@@ -2501,6 +2535,7 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_002, TestSize.Level1
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::BACKGROUND);
@@ -2525,8 +2560,10 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_003, TestSize.Level1
     EXPECT_NE(abilityRecord, nullptr);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2554,7 +2591,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_004, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUND);
@@ -2585,7 +2624,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_005, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2620,7 +2661,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_006, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2655,7 +2698,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_007, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2690,7 +2735,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_008, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2725,7 +2772,9 @@ HWTEST_F(MissionListManagerTest, RemoveBackgroundingAbility_009, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord2, "missionName");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->defaultSingleList_ = std::make_shared<MissionList>();
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
@@ -2779,7 +2828,9 @@ HWTEST_F(MissionListManagerTest, TerminateAbility_002, TestSize.Level1)
     bool flag = true;
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
     int res = missionListManager->TerminateAbility(abilityRecord, resultCode, resultWant, flag);
@@ -2807,6 +2858,7 @@ HWTEST_F(MissionListManagerTest, TerminateAbility_003, TestSize.Level1)
     Want* resultWant = nullptr;
     bool flag = true;
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->TerminateAbility(abilityRecord, resultCode, resultWant, flag);
     EXPECT_EQ(res, ERR_OK);
     missionListManager.reset();
@@ -2828,6 +2880,7 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_001, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     bool flag = true;
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
 }
@@ -2849,6 +2902,7 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_002, TestSize.Level1)
     bool flag = true;
     abilityRecord->SetAbilityState(AbilityState::BACKGROUND);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
 }
@@ -2872,9 +2926,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_003, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = false;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUND);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
 }
@@ -2896,6 +2952,7 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_004, TestSize.Level1)
     bool flag = true;
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
 }
@@ -2922,9 +2979,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_005, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->launcherList_ = missionList;
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
@@ -2955,9 +3014,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_006, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->launcherList_ = missionList;
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
@@ -2988,9 +3049,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_007, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->launcherList_ = missionList;
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
@@ -3021,9 +3084,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_008, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->launcherList_ = missionList;
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
@@ -3054,9 +3119,11 @@ HWTEST_F(MissionListManagerTest, RemoveTerminatingAbility_009, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord2, "missionName");
     bool flag = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAbilityState(AbilityState::FOREGROUNDING);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->launcherList_ = missionList;
     missionListManager->RemoveTerminatingAbility(abilityRecord, flag);
     missionListManager.reset();
@@ -3172,8 +3239,11 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_001, TestSize
     std::shared_ptr<AbilityRecord> abilityRecord2 = InitAbilityRecord();
     abilityRecord->SetAppIndex(1);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->terminateAbilityList_.push_back(abilityRecord2);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord2);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3194,7 +3264,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_002, TestSize
     abilityRecord->SetAppIndex(0);
     abilityRecord->abilityInfo_.removeMissionAfterTerminate = true;
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3216,7 +3288,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_003, TestSize
     abilityRecord->abilityInfo_.removeMissionAfterTerminate = false;
     abilityRecord->abilityInfo_.excludeFromMissions = true;
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3244,7 +3318,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_004, TestSize
     DelayedSingleton<MissionInfoMgr>::GetInstance()->Init(userId);
     DelayedSingleton<MissionInfoMgr>::GetInstance()->missionInfoList_.push_back(info);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3268,7 +3344,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_005, TestSize
     abilityRecord->missionId_ = 2;
     missionListManager->listenerController_ = nullptr;
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3297,7 +3375,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_006, TestSize
     DelayedSingleton<MissionInfoMgr>::GetInstance()->Init(userId);
     DelayedSingleton<MissionInfoMgr>::GetInstance()->missionInfoList_.push_back(info);
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3318,7 +3398,9 @@ HWTEST_F(MissionListManagerTest, CompleteTerminateAndUpdateMission_007, TestSize
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<AbilityRecord> abilityRecord2 = InitAbilityRecord();
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->terminateAbilityList_.push_back(abilityRecord2);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord2);
     missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
     missionListManager.reset();
 }
@@ -3360,6 +3442,7 @@ HWTEST_F(MissionListManagerTest, ClearMission_002, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>(MissionListType::LAUNCHER);
     mission->SetMissionList(missionList);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int res = missionListManager->ClearMission(missionId);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
@@ -3386,6 +3469,7 @@ HWTEST_F(MissionListManagerTest, ClearMission_003, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     mission->SetMissionList(missionList);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int res = missionListManager->ClearMission(missionId);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
@@ -3412,6 +3496,7 @@ HWTEST_F(MissionListManagerTest, ClearMission_004, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     mission->SetMissionList(nullptr);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int res = missionListManager->ClearMission(missionId);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
@@ -3545,6 +3630,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLockedState_002, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int res = missionListManager->SetMissionLockedState(missionId, lockedState);
     EXPECT_EQ(res, MISSION_NOT_FOUND);
@@ -3568,6 +3654,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLockedState_003, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, nullptr);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     DelayedSingleton<MissionInfoMgr>::GetInstance()->missionIdMap_.clear();
     int res = missionListManager->SetMissionLockedState(missionId, lockedState);
@@ -3594,6 +3681,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLockedState_004, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     DelayedSingleton<MissionInfoMgr>::GetInstance()->missionIdMap_[1] = true;
     InnerMissionInfo info;
@@ -3991,6 +4079,7 @@ HWTEST_F(MissionListManagerTest, OnTimeOut_002, TestSize.Level1)
     abilityRecord->SetStartingWindow(true);
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -4017,6 +4106,7 @@ HWTEST_F(MissionListManagerTest, OnTimeOut_003, TestSize.Level1)
     abilityRecord->SetStartingWindow(false);
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -4043,6 +4133,7 @@ HWTEST_F(MissionListManagerTest, OnTimeOut_004, TestSize.Level1)
     abilityRecord->SetStartingWindow(false);
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -4334,6 +4425,7 @@ HWTEST_F(MissionListManagerTest, GetAbilityRecordById_001, TestSize.Level1)
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
     int64_t abilityRecordId = abilityRecord->GetRecordId();
     missionList2->missions_.push_back(mission);
+    missionList2->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList1);
     missionListManager->defaultSingleList_ = missionList2;
     missionListManager->defaultStandardList_ = missionList2;
@@ -4438,6 +4530,7 @@ HWTEST_F(MissionListManagerTest, GetTargetMissionList_005, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     mission->SetMissionList(nullptr);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int missionId = 1;
     bool isReachToLimit = false;
@@ -4463,6 +4556,7 @@ HWTEST_F(MissionListManagerTest, GetTargetMissionList_006, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>(MissionListType::LAUNCHER);
     mission->SetMissionList(missionList);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     int missionId = 1;
     bool isReachToLimit = false;
@@ -4489,6 +4583,7 @@ HWTEST_F(MissionListManagerTest, GetTargetMissionList_007, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>(MissionListType::DEFAULT_STANDARD);
     mission->SetMissionList(missionList);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     bool isReachToLimit = false;
     auto res = missionListManager->GetTargetMissionList(missionId, mission, isReachToLimit);
@@ -4583,6 +4678,7 @@ HWTEST_F(MissionListManagerTest, GetMissionIdByAbilityToken_002, TestSize.Level1
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->GetMissionIdByAbilityToken(token);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -4606,6 +4702,7 @@ HWTEST_F(MissionListManagerTest, GetMissionIdByAbilityToken_003, TestSize.Level1
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     abilityRecord->SetMissionId(mission->GetMissionId());
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->GetMissionIdByAbilityToken(token);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -4629,6 +4726,7 @@ HWTEST_F(MissionListManagerTest, GetAbilityTokenByMissionId_001, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     auto res = missionListManager->GetAbilityTokenByMissionId(missionId);
     EXPECT_NE(res, nullptr);
@@ -4653,6 +4751,7 @@ HWTEST_F(MissionListManagerTest, GetAbilityTokenByMissionId_002, TestSize.Level1
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     auto res = missionListManager->GetAbilityTokenByMissionId(missionId);
@@ -4813,6 +4912,7 @@ HWTEST_F(MissionListManagerTest, HandleAbilityDiedByDefault_002, TestSize.Level1
     abilityRecord2->SetLauncherRoot();
     mission->SetMissionList(missionList);
     missionList2->missions_.push_back(mission);
+    missionList2->tokenIndex_.Add(mission->GetAbilityRecord());
     abilityRecord->SetMissionId(mission->GetMissionId());
     abilityRecord->SetAppIndex(1);
     abilityRecord->SetAbilityState(AbilityState::FOREGROUND);
@@ -4955,6 +5055,7 @@ HWTEST_F(MissionListManagerTest, BackToLauncher_002, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->launcherList_ = missionList;
     missionListManager->BackToLauncher();
     missionListManager.reset();
@@ -4981,6 +5082,7 @@ HWTEST_F(MissionListManagerTest, BackToLauncher_003, TestSize.Level1)
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(2, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionListManager->launcherList_ = missionList;
     missionListManager->BackToLauncher();
     missionListManager.reset();
@@ -5025,6 +5127,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLabel_002, TestSize.Level1)
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     std::string label = "label";
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->SetMissionLabel(token, label);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -5054,6 +5157,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLabel_003, TestSize.Level1)
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     std::string label = "label";
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->SetMissionLabel(token, label);
     EXPECT_TRUE(missionListManager != nullptr);
     missionListManager.reset();
@@ -5084,6 +5188,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLabel_004, TestSize.Level1)
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     std::string label = "label";
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->SetMissionLabel(token, label);
     EXPECT_TRUE(missionListManager != nullptr);
     missionListManager.reset();
@@ -5111,6 +5216,7 @@ HWTEST_F(MissionListManagerTest, SetMissionLabel_005, TestSize.Level1)
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     std::string label = "label";
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->SetMissionLabel(token, label);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -5153,6 +5259,7 @@ HWTEST_F(MissionListManagerTest, SetMissionIcon_002, TestSize.Level1)
     abilityRecord->SetMissionId(mission->GetMissionId());
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->SetMissionIcon(token, icon);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -5177,6 +5284,7 @@ HWTEST_F(MissionListManagerTest, SetMissionIcon_003, TestSize.Level1)
     abilityRecord->SetMissionId(mission->GetMissionId());
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->SetMissionIcon(token, icon);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -5202,6 +5310,7 @@ HWTEST_F(MissionListManagerTest, SetMissionIcon_004, TestSize.Level1)
     abilityRecord->abilityInfo_.excludeFromMissions = false;
     sptr<IRemoteObject> token = abilityRecord->GetToken();
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     int res = missionListManager->SetMissionIcon(token, icon);
     EXPECT_EQ(res, -1);
     missionListManager.reset();
@@ -5240,6 +5349,7 @@ HWTEST_F(MissionListManagerTest, CompleteFirstFrameDrawing_002, TestSize.Level1)
     sptr<IRemoteObject> abilityToken = abilityRecord->GetToken();
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5403,6 +5513,7 @@ HWTEST_F(MissionListManagerTest, GetAbilityRecordByName_001, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(nullptr);
     missionListManager->launcherList_ = missionList;
     auto res = missionListManager->GetAbilityRecordByName(element);
@@ -5475,6 +5586,7 @@ HWTEST_F(MissionListManagerTest, OnAcceptWantResponse_008, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     missionListManager->OnAcceptWantResponse(want, flag);
     missionListManager.reset();
@@ -5529,6 +5641,7 @@ HWTEST_F(MissionListManagerTest, GetMissionBySpecifiedFlag_006, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList2 = std::make_shared<MissionList>();
     missionList2->missions_.push_back(mission);
+    missionList2->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(nullptr);
     missionListManager->defaultSingleList_ = missionList1;
     missionListManager->launcherList_ = missionList2;
@@ -5582,6 +5695,7 @@ HWTEST_F(MissionListManagerTest, IsReachToLimitLocked_001, TestSize.Level1)
     mission->SetSpecifiedFlag(flag);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->launcherList_ = missionList;
     bool res = missionListManager->IsReachToLimitLocked();
     EXPECT_FALSE(res);
@@ -5604,6 +5718,7 @@ HWTEST_F(MissionListManagerTest, IsReachToLimitLocked_002, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(nullptr);
     missionListManager->currentMissionLists_.push_back(missionList);
     missionListManager->defaultStandardList_ = missionList;
@@ -5631,6 +5746,7 @@ HWTEST_F(MissionListManagerTest, GetMissionSnapshot_001, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     abilityRecord->SetAbilityState(AbilityState::FOREGROUND);
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     bool res = missionListManager->GetMissionSnapshot(missionId, abilityRecord->GetToken(), missionSnapshot, isLowResolution);
     EXPECT_FALSE(res);
     missionListManager.reset();
@@ -5654,6 +5770,7 @@ HWTEST_F(MissionListManagerTest, GetMissionSnapshot_002, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     abilityRecord->SetAbilityState(AbilityState::BACKGROUND);
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     bool res = missionListManager->GetMissionSnapshot(missionId, abilityRecord->GetToken(), missionSnapshot, isLowResolution);
     EXPECT_FALSE(res);
     missionListManager.reset();
@@ -5677,6 +5794,7 @@ HWTEST_F(MissionListManagerTest, GetMissionSnapshot_003, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5725,6 +5843,7 @@ HWTEST_F(MissionListManagerTest, GetAbilityRunningInfos_002, TestSize.Level1)
     std::vector<AbilityRunningInfo> info;
     bool isPerm = true;
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5769,6 +5888,7 @@ HWTEST_F(MissionListManagerTest, AddUninstallTags_002, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     std::string bundleName = "bundleName";
     int32_t uid = 0;
     missionListManager->Init();
@@ -5817,6 +5937,7 @@ HWTEST_F(MissionListManagerTest, EraseWaitingAbility_001, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     std::string bundleName = "bundleName";
     int32_t uid = 0;
     AbilityRequest abilityRequest;
@@ -5844,6 +5965,7 @@ HWTEST_F(MissionListManagerTest, EraseWaitingAbility_002, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     std::string bundleName = "bundleName";
     int32_t uid = 0;
     AbilityRequest abilityRequest;
@@ -5871,6 +5993,7 @@ HWTEST_F(MissionListManagerTest, EraseWaitingAbility_003, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     std::string bundleName = "bundleName";
     int32_t uid = 0;
     AbilityRequest abilityRequest;
@@ -5898,6 +6021,7 @@ HWTEST_F(MissionListManagerTest, PauseManager_001, TestSize.Level1)
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionListManager->currentMissionLists_.push_back(missionList);
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5919,6 +6043,7 @@ HWTEST_F(MissionListManagerTest, PauseManager_002, TestSize.Level1)
     auto missionListManager = std::make_shared<MissionListManager>(userId);
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     missionListManager->currentMissionLists_.push_back(missionList);
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5942,6 +6067,7 @@ HWTEST_F(MissionListManagerTest, GetAllForegroundAbilities_001, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     std::list<std::shared_ptr<AbilityRecord>> foregroundList;
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -5965,6 +6091,7 @@ HWTEST_F(MissionListManagerTest, GetForegroundAbilities_001, TestSize.Level1)
     std::shared_ptr<MissionList> missionList = std::make_shared<MissionList>();
     std::list<std::shared_ptr<AbilityRecord>> foregroundList;
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     missionListManager->GetForegroundAbilities(missionList, foregroundList);
     missionListManager.reset();
 }
@@ -5987,10 +6114,13 @@ HWTEST_F(MissionListManagerTest, GetForegroundAbilities_002, TestSize.Level1)
     std::shared_ptr<Mission> mission = std::make_shared<Mission>(1, abilityRecord);
     std::shared_ptr<Mission> mission2 = std::make_shared<Mission>(1, nullptr);
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(nullptr);
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     std::list<std::shared_ptr<AbilityRecord>> foregroundList;
     missionList->missions_.clear();
+    missionList->tokenIndex_.Clear();
     missionListManager->GetForegroundAbilities(missionList, foregroundList);
     missionListManager.reset();
 }
@@ -6108,6 +6238,7 @@ HWTEST_F(MissionListManagerTest, SetMissionANRStateByTokens_001, TestSize.Level1
     std::vector<sptr<IRemoteObject>> tokens;
     tokens.push_back(abilityRecord->GetToken());
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->SetMissionANRStateByTokens(tokens);
     missionListManager.reset();
 }
@@ -6129,6 +6260,7 @@ HWTEST_F(MissionListManagerTest, SetMissionANRStateByTokens_002, TestSize.Level1
     std::vector<sptr<IRemoteObject>> tokens;
     tokens.push_back(abilityRecord->GetToken());
     missionListManager->terminateAbilityList_.push_back(abilityRecord);
+    missionListManager->terminateTokenIndex_.Add(abilityRecord);
     missionListManager->SetMissionANRStateByTokens(tokens);
     missionListManager.reset();
 }
@@ -6152,6 +6284,7 @@ HWTEST_F(MissionListManagerTest, SetMissionANRStateByTokens_003, TestSize.Level1
     std::vector<sptr<IRemoteObject>> tokens;
     tokens.push_back(abilityRecord->GetToken());
     missionListManager->terminateAbilityList_.clear();
+    missionListManager->terminateTokenIndex_.Clear();
     missionListManager->currentMissionLists_.clear();
     missionListManager->defaultSingleList_ = missionList;
     missionListManager->defaultStandardList_ = missionList;
@@ -6532,5 +6665,39 @@ HWTEST_F(MissionListManagerTest, OnStartSpecifiedAbilityTimeoutResponse_005, Tes
     missionListManager->waitingAbilityQueue_.push(abilityRequest2);
     missionListManager->OnStartSpecifiedAbilityTimeoutResponse(want);
 }
+
+/*
+ * Feature: MissionListManager
+ * Function: GetAbilityFromTerminateList
+ * SubFunction: NA
+ * FunctionPoints: MissionListManager GetAbilityFromTerminateList
+ * EnvConditions: NA
+ * CaseDescription: Verify the terminate token index follows an ability moved to and out of the terminate list
+ */
+HWTEST_F(MissionListManagerTest, GetAbilityFromTerminateList_001, TestSize.Level1)
+{
+    int userId = 3;
+    auto missionListManager = std::make_shared<MissionListManager>(userId);
+    missionListManager->Init();
+    std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
+    sptr<IRemoteObject> token = abilityRecord->GetToken();
+    auto mission = std::make_shared<Mission>(1, abilityRecord, "missionName");
+    auto missionList = std::make_shared<MissionList>();
+    missionList->AddMissionToTop(mission);
+    missionListManager->currentMissionLists_.push_front(missionList);
+    abilityRecord->SetMissionId(mission->GetMissionId());
+    EXPECT_EQ(missionListManager->GetAbilityRecordByToken(token), abilityRecord);
+    EXPECT_EQ(missionListManager->GetAbilityFromTerminateList(token), nullptr);
+
+    missionListManager->RemoveTerminatingAbility(abilityRecord, false);
+    EXPECT_EQ(missionListManager->GetAliveAbilityRecordByToken(token), nullptr);
+    EXPECT_EQ(missionListManager->GetAbilityFromTerminateList(token), abilityRecord);
+    EXPECT_EQ(missionListManager->GetAbilityRecordByToken(token), abilityRecord);
+
+    missionListManager->CompleteTerminateAndUpdateMission(abilityRecord);
+    EXPECT_EQ(missionListManager->GetAbilityFromTerminateList(token), nullptr);
+    EXPECT_EQ(missionListManager->terminateTokenIndex_.Size(), 0);
+    missionListManager.reset();
+}
 }  // namespace AAFwk
 }  // namespace OHOS
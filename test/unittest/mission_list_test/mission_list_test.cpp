@@ -454,6 +454,47 @@ HWTEST_F(MissionListTest, mission_list_get_ability_record_by_token_002, TestSize
     EXPECT_EQ(abilityRecord, missionList->GetAbilityRecordByToken(abilityRecord->GetToken()));
 }
 
+/*
+ * Feature: MissionList
+ * Function: GetAbilityRecordByToken
+ * SubFunction: NA
+ * FunctionPoints: MissionList GetAbilityRecordByToken
+ * EnvConditions: NA
+ * CaseDescription: Verify the token index follows add, move and remove of missions
+ */
+HWTEST_F(MissionListTest, mission_list_get_ability_record_by_token_003, TestSize.Level1)
+{
+    AppExecFwk::AbilityInfo abilityInfo;
+    Want want;
+    AppExecFwk::ApplicationInfo applicationInfo;
+    std::shared_ptr<AbilityRecord> abilityRecord = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    std::shared_ptr<AbilityRecord> abilityRecord2 = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    abilityRecord->Init();
+    abilityRecord2->Init();
+    auto mission1 = std::make_shared<Mission>(1, abilityRecord, "name");
+    auto mission2 = std::make_shared<Mission>(2, abilityRecord2, "name");
+
+    auto missionList = std::make_shared<MissionList>();
+    missionList->AddMissionToTop(mission1);
+    missionList->AddMissionToTop(mission2);
+    missionList->AddMissionToTop(mission1);
+    EXPECT_EQ(missionList->tokenIndex_.Size(), missionList->missions_.size());
+    EXPECT_EQ(abilityRecord, missionList->GetAbilityRecordByToken(abilityRecord->GetToken()));
+    EXPECT_EQ(abilityRecord2, missionList->GetAbilityRecordByToken(abilityRecord2->GetToken()));
+
+    missionList->RemoveMission(mission1);
+    EXPECT_EQ(nullptr, missionList->GetAbilityRecordByToken(abilityRecord->GetToken()));
+    EXPECT_EQ(abilityRecord2, missionList->GetAbilityRecordByToken(abilityRecord2->GetToken()));
+
+    missionList->RemoveMissionByAbilityRecord(abilityRecord2);
+    EXPECT_EQ(nullptr, missionList->GetAbilityRecordByToken(abilityRecord2->GetToken()));
+    EXPECT_EQ(missionList->tokenIndex_.Size(), 0);
+
+    // lookups only consult the index, a mission put into missions_ behind its back is not found.
+    missionList->missions_.push_back(mission2);
+    EXPECT_EQ(nullptr, missionList->GetAbilityRecordByToken(abilityRecord2->GetToken()));
+}
+
 /*
  * Feature: MissionList
  * Function: RemoveMissionByAbilityRecord
@@ -498,6 +539,7 @@ HWTEST_F(MissionListTest, mission_list_get_mission_by_id_001, TestSize.Level1)
     abilityRecord->Init();
     auto mission = std::make_shared<Mission>(1, abilityRecord, "name");
     missionList->missions_.push_back(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_back(nullptr);
 
     auto res1 = missionList->GetMissionById(1);
@@ -536,9 +578,13 @@ HWTEST_F(MissionListTest, mission_list_get_mission_by_specified_flag_001, TestSi
     auto mission4 = std::make_shared<Mission>(4, nullptr, "name");
 
     missionList->missions_.push_back(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_back(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionList->missions_.push_back(mission3);
+    missionList->tokenIndex_.Add(mission3->GetAbilityRecord());
     missionList->missions_.push_back(mission4);
+    missionList->tokenIndex_.Add(mission4->GetAbilityRecord());
     auto res1 = missionList->GetMissionBySpecifiedFlag(want, flag);
     EXPECT_EQ(res1, nullptr);
 
@@ -730,6 +776,7 @@ HWTEST_F(MissionListTest, mission_list_get_ability_record_by_id_001, TestSize.Le
     auto mission = std::make_shared<Mission>(1, abilityRecord, "name");
     auto missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_front(nullptr);
     auto res = missionList->GetAbilityRecordById(0);
     EXPECT_EQ(res, nullptr);
@@ -765,7 +812,9 @@ HWTEST_F(MissionListTest, mission_list_get_ability_record_by_caller_001, TestSiz
 
     auto missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     auto res = missionList->GetAbilityRecordByCaller(abilityRecord1, 0);
     EXPECT_EQ(res, abilityRecord1);
 }
@@ -793,6 +842,7 @@ HWTEST_F(MissionListTest, mission_list_get_ability_record_by_name_001, TestSize.
     auto missionList = std::make_shared<MissionList>();
     ElementName element("", "", "");
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_front(nullptr);
     auto res = missionList->GetAbilityRecordByName(element);
     EXPECT_EQ(res, nullptr);
@@ -812,7 +862,9 @@ HWTEST_F(MissionListTest, mission_list_get_ability_token_by_mission_id_001, Test
     auto mission2 = std::make_shared<Mission>(2, nullptr, "name");
     auto missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionList->missions_.push_front(nullptr);
     auto res = missionList->GetAbilityTokenByMissionId(1);
     EXPECT_EQ(res, nullptr);
@@ -839,6 +891,7 @@ HWTEST_F(MissionListTest, mission_list_handle_uninstall_app_001, TestSize.Level1
     auto missionList = std::make_shared<MissionList>();
     ASSERT_NE(missionList, nullptr);
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->HandleUnInstallApp("bundle", 0);
 }
 
@@ -897,6 +950,7 @@ HWTEST_F(MissionListTest, mission_list_dump_001, TestSize.Level1)
     std::vector<std::string> info;
     missionList->missions_.push_front(nullptr);
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     EXPECT_EQ(missionList->missions_.front(), mission);
     EXPECT_EQ(missionList->missions_.back(), nullptr);
     missionList->Dump(info);
@@ -927,7 +981,9 @@ HWTEST_F(MissionListTest, mission_list_dump_state_by_record_id_001, TestSize.Lev
     std::vector<std::string> params;
     missionList->missions_.push_front(nullptr);
     missionList->missions_.push_front(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionList->DumpStateByRecordId(info, isClient, abilityRecordId, params);
 }
 
@@ -948,6 +1004,7 @@ HWTEST_F(MissionListTest, mission_list_dump_list_001, TestSize.Level1)
     bool isClient = false;
     missionList->missions_.push_front(nullptr);
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->DumpList(info, isClient);
 }
 
@@ -976,7 +1033,9 @@ HWTEST_F(MissionListTest, mission_block_ability_by_record_id_001, TestSize.Level
     std::vector<std::string> params;
     missionList->missions_.push_front(nullptr);
     missionList->missions_.push_front(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     missionList->DumpStateByRecordId(info, isClient, 1, params);
     missionList->DumpStateByRecordId(info, isClient, 0, params);
 }
@@ -1002,7 +1061,9 @@ HWTEST_F(MissionListTest, mission_list_get_mission_count_by_uid_001, TestSize.Le
     auto missionList = std::make_shared<MissionList>();
     missionList->missions_.push_front(nullptr);
     missionList->missions_.push_front(mission1);
+    missionList->tokenIndex_.Add(mission1->GetAbilityRecord());
     missionList->missions_.push_front(mission2);
+    missionList->tokenIndex_.Add(mission2->GetAbilityRecord());
     int32_t res1 = missionList->GetMissionCountByUid(0);
     EXPECT_EQ(res1, 0);
     int32_t res2 = missionList->GetMissionCountByUid(1);
@@ -1033,6 +1094,7 @@ HWTEST_F(MissionListTest, mission_list_get_ability_records_by_name_001, TestSize
     ElementName elementEmpty("", "", "");
     std::vector<std::shared_ptr<AbilityRecord>> records;
     missionList->missions_.push_front(mission);
+    missionList->tokenIndex_.Add(mission->GetAbilityRecord());
     missionList->missions_.push_front(nullptr);
     missionList->GetAbilityRecordsByName(elementEmpty, records);
     EXPECT_TRUE(records.empty());
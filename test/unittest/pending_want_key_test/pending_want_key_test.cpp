@@ -193,5 +193,40 @@ HWTEST_F(PendingWantKeyTest, SetUserId_0100, TestSize.Level1)
     amsPendingWantKey->SetUserId(PENDING_WANT_USERID);
     EXPECT_EQ(PENDING_WANT_USERID, amsPendingWantKey->GetUserId());
 }
+
+/*
+ * @tc.number    : GetHashCode_0100
+ * @tc.name      : get HashCode
+ * @tc.desc      : Keys with the same content have the same hash code, flags and code are not hashed
+ */
+HWTEST_F(PendingWantKeyTest, GetHashCode_0100, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    std::unique_ptr<PendingWantKey> pendingWantKey1 = std::make_unique<PendingWantKey>();
+    std::unique_ptr<PendingWantKey> pendingWantKey2 = std::make_unique<PendingWantKey>();
+    for (auto key : { pendingWantKey1.get(), pendingWantKey2.get() }) {
+        key->SetType(PENDING_WANT_TYPE);
+        key->SetBundleName(PENDING_WANT_BUNDLENAME);
+        key->SetRequestWho(PENDING_WANT_WHO);
+        key->SetRequestCode(PENDING_WANT_REQUESTCODE);
+        key->SetRequestResolvedType(PENDING_WANT_REQUESTRESLOVEDTYPE);
+        key->SetUserId(PENDING_WANT_USERID);
+        key->SetRequestWant(want);
+    }
+    pendingWantKey1->SetFlags(PENDING_WANT_FLAGS);
+    pendingWantKey1->SetCode(PENDING_WANT_CODE);
+    EXPECT_EQ(pendingWantKey1->GetHashCode(), pendingWantKey2->GetHashCode());
+
+    pendingWantKey2->SetRequestCode(PENDING_WANT_REQUESTCODE + 1);
+    EXPECT_NE(pendingWantKey1->GetHashCode(), pendingWantKey2->GetHashCode());
+    pendingWantKey2->SetRequestCode(PENDING_WANT_REQUESTCODE);
+
+    ElementName otherElement("device", "bundleName", "otherAbilityName");
+    want.SetElement(otherElement);
+    pendingWantKey2->SetRequestWant(want);
+    EXPECT_NE(pendingWantKey1->GetHashCode(), pendingWantKey2->GetHashCode());
+}
 }  // namespace AAFwk
 }  // namespace OHOS
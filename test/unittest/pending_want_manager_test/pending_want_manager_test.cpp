@@ -971,5 +971,35 @@ HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_3700, TestSize.Level1)
     pendingManager_->ClearPendingWantRecordTask("bundleName3", 1);
     EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 2);
 }
+
+/*
+ * @tc.number    : PendingWantManagerTest_3800
+ * @tc.name      : PendingWantManager GetPendingWantRecordByKey
+ * @tc.desc      : 1.The key index follows insert, update and erase of want records.
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_3800, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    EXPECT_EQ(pendingManager_->wantRecordsIndex_.size(), 1u);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(wantSenderInfo)), pendingRecord);
+
+    WantSenderInfo updateInfo = MakeWantSenderInfo(want, static_cast<int32_t>(Flags::UPDATE_PRESENT_FLAG), 0);
+    auto updateRecord = pendingManager_->GetWantSenderLocked(1, 1, updateInfo.userId, updateInfo, nullptr);
+    EXPECT_EQ(iface_cast<PendingWantRecord>(updateRecord->AsObject()), pendingRecord);
+    EXPECT_EQ(pendingManager_->wantRecordsIndex_.size(), 1u);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(updateInfo)), pendingRecord);
+
+    pendingManager_->CancelWantSenderLocked(*pendingRecord, true);
+    EXPECT_TRUE(pendingManager_->wantRecords_.empty());
+    EXPECT_TRUE(pendingManager_->wantRecordsIndex_.empty());
+}
 }  // namespace AAFwk
 }  // namespace OHOS
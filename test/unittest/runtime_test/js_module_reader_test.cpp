@@ -17,10 +17,12 @@
 
 #include "js_module_reader.h"
 #include "extractor.h"
+#include "hap_path_cache.h"
 
 using namespace testing;
 using namespace testing::ext;
 using JsModuleReader = OHOS::AbilityRuntime::JsModuleReader;
+using HapPathCache = OHOS::AbilityRuntime::HapPathCache;
 using Extractor = OHOS::AbilityBase::Extractor;
 
 namespace OHOS {
@@ -100,5 +102,61 @@ JsModuleReader jsModuleReader("JsModuleReader", "/data/storage/el1/test.hsp");
 std::string hapPath = jsModuleReader.GetPresetAppHapPath("", "");
 EXPECT_TRUE(hapPath.empty());
 }
+
+/**
+ * @tc.name: HapPathCacheTest_0100
+ * @tc.desc: Seeded module paths are resolved by GetPresetAppHapPath without asking bundle manager
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsModuleReaderTest, HapPathCacheTest_0100, TestSize.Level0)
+{
+    auto &hapPathCache = HapPathCache::GetInstance();
+    std::map<std::string, std::string> modulePaths = {
+        { "entry", "/data/storage/el1/bundle/entry.hap" },
+        { "library", "/data/storage/el1/bundle/library.hsp" },
+    };
+    hapPathCache.SetSelfModulePaths(modulePaths);
+    uint64_t hitCount = hapPathCache.GetHitCount();
+    uint64_t missCount = hapPathCache.GetMissCount();
+
+    EXPECT_EQ(JsModuleReader::GetPresetAppHapPath("/library", "bundleName"), "/data/storage/el1/bundle/library.hsp");
+    EXPECT_EQ(JsModuleReader::GetPresetAppHapPath("/unknown", "bundleName"), "/unknown");
+    std::vector<std::string> hapList;
+    JsModuleReader::GetHapPathList("bundleName", hapList);
+    EXPECT_EQ(hapList.size(), modulePaths.size());
+    EXPECT_EQ(hapPathCache.GetHitCount(), hitCount + 2);
+    EXPECT_EQ(hapPathCache.GetMissCount(), missCount + 1);
+
+    hapPathCache.SetSharedModulePath("bundleName:@bundle/shared/library", "/data/storage/el1/shared.hsp");
+    std::string hapPath;
+    EXPECT_TRUE(hapPathCache.GetSharedModulePath("bundleName:@bundle/shared/library", hapPath));
+    EXPECT_EQ(hapPath, "/data/storage/el1/shared.hsp");
+
+    hapPathCache.Clear();
+    EXPECT_FALSE(hapPathCache.GetSharedModulePath("bundleName:@bundle/shared/library", hapPath));
+    EXPECT_EQ(hapPathCache.GetMissCount(), missCount + 2);
+}
+
+/**
+ * @tc.name: HapPathCacheTest_0200
+ * @tc.desc: The shared module resolutions to a stale hap path are dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsModuleReaderTest, HapPathCacheTest_0200, TestSize.Level0)
+{
+    auto &hapPathCache = HapPathCache::GetInstance();
+    hapPathCache.SetSharedModulePath("bundleName:@bundle/shared/library", "/system/app/shared/1/library.hsp");
+    hapPathCache.SetSharedModulePath("other:@bundle/shared/library", "/system/app/shared/1/library.hsp");
+    hapPathCache.SetSharedModulePath("bundleName:@bundle/shared/utils", "/system/app/shared/1/utils.hsp");
+
+    EXPECT_TRUE(hapPathCache.RemoveSharedModulePath("/system/app/shared/1/library.hsp"));
+    EXPECT_FALSE(hapPathCache.RemoveSharedModulePath("/system/app/shared/1/library.hsp"));
+    std::string hapPath;
+    EXPECT_FALSE(hapPathCache.GetSharedModulePath("bundleName:@bundle/shared/library", hapPath));
+    EXPECT_FALSE(hapPathCache.GetSharedModulePath("other:@bundle/shared/library", hapPath));
+    EXPECT_TRUE(hapPathCache.GetSharedModulePath("bundleName:@bundle/shared/utils", hapPath));
+    EXPECT_EQ(hapPath, "/system/app/shared/1/utils.hsp");
+    hapPathCache.Clear();
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -14,8 +14,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #define private public
+#include "mission_data_storage.h"
 #include "task_data_persistence_mgr.h"
 #undef private
 
@@ -160,6 +162,61 @@ HWTEST_F(TaskDataPersistenceMgrTest, RemoveUserDir_002, TestSize.Level1)
     EXPECT_FALSE(res);
 }
 
+/*
+ * Feature: TaskDataPersistenceMgr
+ * Function: RemoveUserDir
+ * SubFunction: NA
+ * FunctionPoints: TaskDataPersistenceMgr RemoveUserDir
+ * EnvConditions: NA
+ * CaseDescription: Verify the pending mission updates of the removed user are dropped
+ */
+HWTEST_F(TaskDataPersistenceMgrTest, RemoveUserDir_003, TestSize.Level1)
+{
+    auto taskDataPersistenceMgr = std::make_shared<TaskDataPersistenceMgr>();
+    int32_t userId = 102;
+    taskDataPersistenceMgr->Init(userId);
+    taskDataPersistenceMgr->Init(0);
+    auto storage = taskDataPersistenceMgr->missionDataStorageMgr_[userId];
+    ASSERT_NE(storage, nullptr);
+    InnerMissionInfo missionInfo;
+    missionInfo.missionInfo.id = 1;
+    EXPECT_TRUE(storage->EnqueueSaveMissionInfo(missionInfo));
+
+    EXPECT_TRUE(taskDataPersistenceMgr->RemoveUserDir(userId));
+    EXPECT_TRUE(storage->pendingRecords_.empty());
+    EXPECT_FALSE(storage->isFlushScheduled_);
+    EXPECT_EQ(taskDataPersistenceMgr->missionDataStorageMgr_.count(userId), 0);
+    storage->FlushPendingMissionInfo();
+    const std::string userDir = std::string(TASK_DATA_FILE_BASE_PATH) + "/" + std::to_string(userId);
+    EXPECT_NE(access(userDir.c_str(), F_OK), 0);
+}
+
+/*
+ * Feature: TaskDataPersistenceMgr
+ * Function: Init
+ * SubFunction: NA
+ * FunctionPoints: TaskDataPersistenceMgr Init
+ * EnvConditions: NA
+ * CaseDescription: Verify the pending mission updates are flushed before switching user
+ */
+HWTEST_F(TaskDataPersistenceMgrTest, Init_001, TestSize.Level1)
+{
+    auto taskDataPersistenceMgr = std::make_shared<TaskDataPersistenceMgr>();
+    int32_t userId = 0;
+    EXPECT_TRUE(taskDataPersistenceMgr->Init(userId));
+    InnerMissionInfo missionInfo;
+    missionInfo.missionInfo.id = 1;
+    EXPECT_TRUE(taskDataPersistenceMgr->SaveMissionInfo(missionInfo));
+    auto storage = taskDataPersistenceMgr->currentMissionDataStorage_;
+    ASSERT_NE(storage, nullptr);
+    EXPECT_FALSE(storage->pendingRecords_.empty());
+
+    EXPECT_TRUE(taskDataPersistenceMgr->Init(101));
+    EXPECT_TRUE(storage->pendingRecords_.empty());
+    EXPECT_FALSE(storage->isFlushScheduled_);
+    EXPECT_NE(taskDataPersistenceMgr->currentMissionDataStorage_, storage);
+}
+
 /*
  * Feature: TaskDataPersistenceMgr
  * Function: SaveMissionSnapshot
@@ -14,7 +14,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 #include "task_handler_wrap.h"
+#define private public
+#include "timeout_task_wheel.h"
+#undef private
 
 using namespace testing;
 using namespace testing::ext;
@@ -181,5 +186,186 @@ HWTEST_F(TaskHandlerWrapTest, FfrtTest_0040, TestSize.Level0)
     EXPECT_TRUE(result);
 }
 
+/**
+ * @tc.name: TimeoutTest_0010
+ * @tc.desc: named delayed task is kept in the timing wheel until it expires
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskHandlerWrapTest, TimeoutTest_0010, TestSize.Level0)
+{
+    std::atomic<int> input = 0;
+    queueHandler_->SubmitTask([&input]() {
+        input = 1;
+        }, "LoadTimeout:100", 100);
+    queueHandler_->SubmitTask([&input]() {
+        input = 2;
+        }, "LoadTimeout:101", 5000);
+    EXPECT_EQ(queueHandler_->GetPendingTimeoutCount(), 2);
+    auto counts = queueHandler_->GetPendingTimeoutCountByCategory();
+    EXPECT_EQ(counts["LoadTimeout"], 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_EQ(input, 1);
+    EXPECT_EQ(queueHandler_->GetPendingTimeoutCount(), 1);
+    EXPECT_TRUE(queueHandler_->CancelTask("LoadTimeout:101"));
+    EXPECT_EQ(queueHandler_->GetPendingTimeoutCount(), 0);
+}
+
+/**
+ * @tc.name: TimeoutTest_0020
+ * @tc.desc: canceled named delayed task is not executed and repeated name is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskHandlerWrapTest, TimeoutTest_0020, TestSize.Level0)
+{
+    std::atomic<int> input = 0;
+    queueHandler_->SubmitTask([&input]() {
+        input = 1;
+        }, "ForegroundTimeout:200", 100);
+    auto taskHandle = queueHandler_->SubmitTask([&input]() {
+        input = 2;
+        }, "ForegroundTimeout:200", 100, false);
+    EXPECT_FALSE(taskHandle);
+    EXPECT_EQ(queueHandler_->GetPendingTimeoutCount(), 1);
+
+    EXPECT_TRUE(queueHandler_->CancelTask("ForegroundTimeout:200"));
+    EXPECT_FALSE(queueHandler_->CancelTask("ForegroundTimeout:200"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(input, 0);
+}
+
+namespace {
+struct FakeDriveQueue {
+    TimeoutTaskWheel::DriveSubmitter GetSubmitter()
+    {
+        return [this](std::function<void()> &&drive, int64_t delayMillis) {
+            submitCount++;
+            return [this]() {
+                cancelCount++;
+                return true;
+            };
+        };
+    }
+
+    // run the live drive task at its tick, returns false if no drive task is live.
+    bool DriveNext(TimeoutTaskWheel &wheel)
+    {
+        uint64_t tick = wheel.driveTick_;
+        if (tick == 0) {
+            return false;
+        }
+        wheel.Drive(tick, static_cast<int64_t>(tick) * TimeoutTaskWheel::TICK_MILLIS);
+        return true;
+    }
+
+    int32_t submitCount = 0;
+    int32_t cancelCount = 0;
+};
+}  // namespace
+
+/**
+ * @tc.name: TimeoutWheelTest_0010
+ * @tc.desc: an earlier timeout cancels the later drive task and a stale drive task does nothing
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskHandlerWrapTest, TimeoutWheelTest_0010, TestSize.Level0)
+{
+    FakeDriveQueue queue;
+    TimeoutTaskWheel wheel(queue.GetSubmitter());
+    std::vector<std::string> fired;
+    EXPECT_TRUE(wheel.ArmAt("LoadTimeout:1", [&fired]() { fired.push_back("LoadTimeout:1"); }, 0, 1000));
+    EXPECT_EQ(queue.submitCount, 1);
+    EXPECT_EQ(wheel.driveTick_, 100);
+
+    EXPECT_TRUE(wheel.ArmAt("ForegroundTimeout:2", [&fired]() { fired.push_back("ForegroundTimeout:2"); }, 0, 100));
+    EXPECT_EQ(queue.submitCount, 2);
+    EXPECT_EQ(queue.cancelCount, 1);
+    EXPECT_EQ(wheel.driveTick_, 10);
+
+    // a later timeout reuses the live drive task.
+    EXPECT_TRUE(wheel.ArmAt("BackgroundTimeout:3", [&fired]() { fired.push_back("BackgroundTimeout:3"); }, 0, 500));
+    EXPECT_EQ(queue.submitCount, 2);
+
+    wheel.Drive(100, 1000);
+    EXPECT_TRUE(fired.empty());
+    EXPECT_EQ(wheel.GetPendingCount(), 3);
+
+    EXPECT_TRUE(queue.DriveNext(wheel));
+    EXPECT_EQ(fired, std::vector<std::string>({ "ForegroundTimeout:2" }));
+    EXPECT_EQ(wheel.driveTick_, 50);
+    EXPECT_TRUE(queue.DriveNext(wheel));
+    EXPECT_TRUE(queue.DriveNext(wheel));
+    EXPECT_FALSE(queue.DriveNext(wheel));
+    EXPECT_EQ(fired, std::vector<std::string>({ "ForegroundTimeout:2", "BackgroundTimeout:3", "LoadTimeout:1" }));
+    EXPECT_EQ(queue.submitCount, 4);
+    EXPECT_EQ(queue.cancelCount, 1);
+}
+
+/**
+ * @tc.name: TimeoutWheelTest_0020
+ * @tc.desc: timeouts in the upper levels are cascaded and fired at their own tick
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskHandlerWrapTest, TimeoutWheelTest_0020, TestSize.Level0)
+{
+    FakeDriveQueue queue;
+    TimeoutTaskWheel wheel(queue.GetSubmitter());
+    std::vector<std::pair<std::string, uint64_t>> fired;
+    auto arm = [&wheel, &fired](const std::string &name, uint64_t tick) {
+        EXPECT_TRUE(wheel.ArmAt(name, [&wheel, &fired, name]() {
+            fired.emplace_back(name, wheel.currentTick_);
+        }, 0, static_cast<int64_t>(tick) * TimeoutTaskWheel::TICK_MILLIS));
+    };
+    // root slot, the first and the second level, and the crossing of a level boundary.
+    arm("root", 255);
+    arm("level1", 257);
+    arm("level1Crossing", 256 * 64 - 1);
+    arm("level2", 256 * 64 + 5);
+    arm("level2Far", 256 * 64 * 3 + 300);
+    EXPECT_EQ(wheel.GetPendingCount(), 5);
+
+    while (queue.DriveNext(wheel)) {}
+    std::vector<std::pair<std::string, uint64_t>> expected = {
+        { "root", 255 },
+        { "level1", 257 },
+        { "level1Crossing", 256 * 64 - 1 },
+        { "level2", 256 * 64 + 5 },
+        { "level2Far", 256 * 64 * 3 + 300 },
+    };
+    EXPECT_EQ(fired, expected);
+    EXPECT_EQ(wheel.GetPendingCount(), 0);
+}
+
+/**
+ * @tc.name: TimeoutWheelTest_0030
+ * @tc.desc: a late drive fires all expired timeouts across levels in one batch and keeps the rest
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskHandlerWrapTest, TimeoutWheelTest_0030, TestSize.Level0)
+{
+    FakeDriveQueue queue;
+    TimeoutTaskWheel wheel(queue.GetSubmitter());
+    std::vector<std::string> fired;
+    auto arm = [&wheel, &fired](const std::string &name, int64_t delayMillis) {
+        EXPECT_TRUE(wheel.ArmAt(name, [&fired, name]() { fired.push_back(name); }, 0, delayMillis));
+    };
+    arm("TerminateTimeout:1", 100);
+    arm("ConnectTimeout:2", 5000);
+    arm("LoadTimeout:3", 200000);
+    arm("LoadTimeout:4", 300000);
+    EXPECT_TRUE(wheel.Cancel("ConnectTimeout:2"));
+
+    wheel.Drive(wheel.driveTick_, 250000);
+    EXPECT_EQ(fired, std::vector<std::string>({ "TerminateTimeout:1", "LoadTimeout:3" }));
+    EXPECT_TRUE(wheel.Contains("LoadTimeout:4"));
+    auto counts = wheel.GetPendingCountByCategory();
+    EXPECT_EQ(counts.size(), 1);
+    EXPECT_EQ(counts["LoadTimeout"], 1);
+
+    while (queue.DriveNext(wheel)) {}
+    EXPECT_EQ(fired.back(), "LoadTimeout:4");
+    EXPECT_EQ(wheel.currentTick_, 30000);
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
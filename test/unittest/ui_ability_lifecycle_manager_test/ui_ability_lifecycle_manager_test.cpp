@@ -138,6 +138,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_003, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, 0, isColdStart), ERR_OK);
 }
@@ -178,6 +179,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_005, TestSize.Level1)
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetPendingState(AbilityState::FOREGROUND);
     mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, 0, isColdStart), ERR_OK);
 }
@@ -235,6 +237,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_008, TestSize.Level1)
     abilityRequest.abilityInfo.moduleName = "EntryModule";
     std::shared_ptr<AbilityRecord>  abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(2, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, 0, isColdStart), ERR_OK);
 }
@@ -280,6 +283,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AbilityTransactionDone_002, TestSize.Lev
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->terminateAbilityList_.emplace_back(abilityRecord);
+    mgr->terminateTokenIndex_.Add(abilityRecord);
     auto token = abilityRecord->GetToken()->AsObject();
     int state = 6;
     PacMap saveData;
@@ -310,6 +314,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_002, TestSize.Level1
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -328,6 +333,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_003, TestSize.Level1
     abilityRecord->SetStartedByCall(true);
 
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -349,6 +355,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_004, TestSize.Level1
     abilityRecord->SetStartedByCall(true);
 
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -421,6 +428,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordByToken_003, TestSize.Le
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_NE(mgr->GetAbilityRecordByToken(token), nullptr);
 }
@@ -520,6 +528,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, EraseAbilityRecord_002, TestSize.Level1)
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     mgr->EraseAbilityRecord(abilityRecord);
     EXPECT_NE(mgr, nullptr);
 }
@@ -966,6 +975,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CompleteBackground_006, TestSize.Level1)
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->currentState_ = AbilityState::BACKGROUNDING;
     mgr->terminateAbilityList_.push_back(abilityRecord);
+    mgr->terminateTokenIndex_.Add(abilityRecord);
     mgr->CompleteBackground(abilityRecord);
     EXPECT_NE(mgr, nullptr);
 }
@@ -1130,6 +1140,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_002, TestSize.Level1)
     uint32_t msgId = 0;
     int64_t abilityRecordId = 0;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1147,6 +1158,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_003, TestSize.Level1)
     uint32_t msgId = 5;
     int64_t abilityRecordId = 0;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1164,6 +1176,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_004, TestSize.Level1)
     uint32_t msgId = 6;
     int64_t abilityRecordId = 0;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(msgId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1253,6 +1266,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_005, TestSize
     sessionInfo->persistentId = 0;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_LOAD_TIMEOUT), "handleLoadTimeout");
     uiAbilityLifecycleManager.reset();
@@ -1275,6 +1289,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_006, TestSize
     sessionInfo->persistentId = 0;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_FOREGROUND_TIMEOUT), "handleForegroundTimeout");
     uiAbilityLifecycleManager.reset();
@@ -1297,6 +1312,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_007, TestSize
     sessionInfo->persistentId = 0;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_DIED), "onAbilityDied");
     uiAbilityLifecycleManager.reset();
@@ -1382,6 +1398,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleLoadTimeout_005, TestSize.Level1)
     sessionInfo->persistentId = 0;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->HandleLoadTimeout(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1485,6 +1502,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleForegroundTimeout_006, TestSize.Le
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->currentState_ = AbilityState::FOREGROUNDING;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->HandleForegroundTimeout(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1569,6 +1587,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAbilityDied_005, TestSize.Level1)
     sessionInfo->persistentId = 0;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAbilityDied(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1688,6 +1707,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetPersistentIdByAbilityRequest_003, Tes
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetPersistentIdByAbilityRequest(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -1714,6 +1734,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetPersistentIdByAbilityRequest_004, Tes
     abilityRequest.abilityInfo.name = "testAbility";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetPersistentIdByAbilityRequest(abilityRequest1, reuse), 0);
 }
@@ -1758,6 +1779,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedSpecifiedPersistentId_002, Test
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetSpecifiedFlag(flag);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedSpecifiedPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -1785,6 +1807,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedSpecifiedPersistentId_003, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedSpecifiedPersistentId(abilityRequest, reuse), 0);
 }
@@ -1826,6 +1849,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedStandardPersistentId_002, TestS
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedStandardPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -1848,6 +1872,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBPendingActivation_001, TestSize
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     auto token = abilityRecord->GetToken();
     EXPECT_NE(token, nullptr);
     abilityRequest.callerToken = token->AsObject();
@@ -1904,6 +1929,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CallAbilityLocked_001, TestSize.Level1)
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     abilityRecord->isReady_ = true;
 
     uiAbilityLifecycleManager->CallAbilityLocked(abilityRequest);
@@ -2062,6 +2088,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CallUIAbilityBySCB_007, TestSize.Level1)
 
     uiAbilityLifecycleManager->tmpAbilityMap_.emplace(1, abilityRecord);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isColdStart = false;
     uiAbilityLifecycleManager->CallUIAbilityBySCB(sessionInfo, isColdStart);
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
@@ -2138,6 +2165,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ReleaseCallLocked_002, TestSize.Level1)
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     auto abilityRecord = InitAbilityRecord();
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IAbilityConnection> connect = new UIAbilityLifcecycleManagerTestStub();
     AppExecFwk::ElementName element("", "com.example.unittest", "MainAbility");
     auto ret = uiAbilityLifecycleManager->ReleaseCallLocked(connect, element);
@@ -2156,6 +2184,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, Dump_001, TestSize.Level1)
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, nullptr);
     std::vector<std::string> info;
     uiAbilityLifecycleManager->Dump(info);
@@ -2192,6 +2221,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionList_002, TestSize.Level1)
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<std::string> info;
     bool isClient = false;
     std::string args;
@@ -2230,6 +2260,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionListByRecordId_002, TestSize.
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<std::string> info;
     bool isClient = false;
     int32_t abilityRecordId = 1;
@@ -2324,6 +2355,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAcceptWantResponse_002, TestSize.Level
     abilityRecord->SetAppIndex(1);
     abilityRecord->SetSpecifiedFlag(flag);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAcceptWantResponse(want, flag);
 
     UIAbilityLifecycleManager::SpecifiedInfo specifiedInfo;
@@ -2525,6 +2557,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityStateByPersistentId_002, TestS
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     abilityRecord->SetPendingState(AbilityState::INITIAL);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(100, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     int32_t persistentId = 100;
     bool state;
     int32_t ret = uiAbilityLifecycleManager->GetAbilityStateByPersistentId(persistentId, state);
@@ -2607,6 +2640,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsContainsAbility_002, TestSize.Level1)
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     auto&& token = abilityRecord->GetToken()->AsObject();
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     bool boolValue = mgr->IsContainsAbility(token);
     EXPECT_TRUE(boolValue);
 }
@@ -2638,6 +2672,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsContainsAbilityInner_002, TestSize.Lev
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     auto&& token = abilityRecord->GetToken()->AsObject();
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     bool boolValue = mgr->IsContainsAbilityInner(token);
     EXPECT_TRUE(boolValue);
 }
@@ -2714,6 +2749,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetUIAbilityRecordBySessionInfo_004, Tes
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_NE(uiAbilityLifecycleManager->GetUIAbilityRecordBySessionInfo(sessionInfo), nullptr);
 }
 
@@ -2844,6 +2880,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetSessionIdByAbilityToken_002, TestSize
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->sessionTokenIndex_.Add(abilityRecord);
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->GetSessionIdByAbilityToken(token), 1);
 }
@@ -2860,6 +2897,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetActiveAbilityList_001, TestSize.Level
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<std::string> abilityList;
     int32_t pid = 100;
     uiAbilityLifecycleManager->GetActiveAbilityList(TEST_UID, abilityList, pid);
@@ -2884,6 +2922,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetActiveAbilityList_002, TestSize.Level
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetOwnerMissionUserId(DelayedSingleton<AbilityManagerService>::GetInstance()->GetUserId());
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<std::string> abilityList;
     int32_t pid = 100;
     uiAbilityLifecycleManager->GetActiveAbilityList(TEST_UID, abilityList, pid);
@@ -2907,6 +2946,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsAbilityStarted_001, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto targetRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, targetRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(targetRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->IsAbilityStarted(abilityRequest, targetRecord), false);
 }
 
@@ -2927,6 +2967,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsAbilityStarted_002, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto targetRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, targetRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(targetRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->IsAbilityStarted(abilityRequest, targetRecord), true);
 }
 
@@ -2984,6 +3025,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsById_001, TestSize.Leve
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->GetAbilityRecordsById(sessionId + 1), nullptr);
 }
 
@@ -2999,6 +3041,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsById_002, TestSize.Leve
     AbilityRequest abilityRequest;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_NE(uiAbilityLifecycleManager->GetAbilityRecordsById(sessionId), nullptr);
 }
 
@@ -3020,6 +3063,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_001, TestSize.Level1)
     info.processName = "AbilityProcess";
     info.state = AppState::TERMINATED;
     uiAbilityLifecycleManager->terminateAbilityList_.emplace_back(abilityRecord);
+    uiAbilityLifecycleManager->terminateTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3042,6 +3086,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_002, TestSize.Level1)
     info.processName = "AbilityProcess";
     info.state = AppState::END;
     uiAbilityLifecycleManager->terminateAbilityList_.emplace_back(abilityRecord);
+    uiAbilityLifecycleManager->terminateTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3064,6 +3109,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_003, TestSize.Level1)
     info.processName = "com.example.unittest";
     info.state = AppState::TERMINATED;
     uiAbilityLifecycleManager->terminateAbilityList_.emplace_back(abilityRecord);
+    uiAbilityLifecycleManager->terminateTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3086,6 +3132,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_004, TestSize.Level1)
     info.processName = "com.example.unittest";
     info.state = AppState::END;
     uiAbilityLifecycleManager->terminateAbilityList_.emplace_back(abilityRecord);
+    uiAbilityLifecycleManager->terminateTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3108,6 +3155,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_005, TestSize.Level1)
     info.processName = "com.example.unittest";
     info.state = AppState::COLD_START;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3130,6 +3178,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_006, TestSize.Level1)
     info.processName = "AbilityProcess";
     info.state = AppState::COLD_START;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3151,6 +3200,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_007, TestSize.Level1)
     AppInfo info;
     info.processName = "com.example.unittest";
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3172,6 +3222,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_008, TestSize.Level1)
     AppInfo info;
     info.processName = "AbilityProcess";
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -3193,6 +3244,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, UninstallApp_001, TestSize.Level1)
     std::string bundleName = "com.example.unittest";
     int32_t uid = 0;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     uiAbilityLifecycleManager->UninstallApp(bundleName, uid);
     uiAbilityLifecycleManager.reset();
 }
@@ -3208,6 +3260,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRunningInfos_001, TestSize.Lev
     ASSERT_NE(uiAbilityLifecycleManager, nullptr);
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<AbilityRunningInfo> info;
     bool isPerm = true;
     uiAbilityLifecycleManager->GetAbilityRunningInfos(info, isPerm);
@@ -3227,6 +3280,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRunningInfos_002, TestSize.Lev
     abilityRequest.appInfo.accessTokenId = IPCSkeleton::GetCallingTokenID();
     std::shared_ptr<AbilityRecord> abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     std::vector<AbilityRunningInfo> info;
     bool isPerm = false;
     uiAbilityLifecycleManager->GetAbilityRunningInfos(info, isPerm);
@@ -3263,6 +3317,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_002, TestSize.Level1)
     std::shared_ptr<StartOptions> startOptions;
     std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_INVALID_VALUE);
 }
 
@@ -3284,6 +3339,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_003, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_INVALID_VALUE);
 }
 
@@ -3305,6 +3361,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_004, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_OK);
 }
 
@@ -3348,6 +3405,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_003, TestSize.Le
     abilityRequest.appInfo.accessTokenId = 100;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_NATIVE_NOT_SELF_APPLICATION);
@@ -3367,6 +3425,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_004, TestSize.Le
     abilityRequest.sessionInfo = nullptr;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_INVALID_VALUE);
@@ -3388,6 +3447,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_005, TestSize.Le
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3409,6 +3469,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_006, TestSize.Le
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3432,6 +3493,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_007, TestSize.Le
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_INVALID_VALUE);
@@ -3456,6 +3518,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_008, TestSize.Le
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_OK);
@@ -3480,6 +3543,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_009, TestSize.Le
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_OK);
@@ -3514,6 +3578,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_003, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow),
         ERR_NATIVE_ABILITY_NOT_FOUND);
@@ -3552,6 +3617,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_005, Test
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::INITIAL);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow),
         ERR_NATIVE_ABILITY_STATE_CHECK_FAILED);
@@ -3573,6 +3639,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_006, Test
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::UNSPECIFIED);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow),
         ERR_NATIVE_ABILITY_STATE_CHECK_FAILED);
@@ -3594,6 +3661,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_007, Test
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::FOREGROUND_SHOW);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3614,6 +3682,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_008, Test
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::FOREGROUND_HIDE);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3633,6 +3702,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_001, TestSize.Le
     abilityRequest.abilityInfo.deviceId = "100";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element);
     EXPECT_EQ(ret.empty(), true);
@@ -3653,6 +3723,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_002, TestSize.Le
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility");
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element);
     EXPECT_EQ(ret.empty(), false);
@@ -3674,6 +3745,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_003, TestSize.Le
     abilityRequest.abilityInfo.moduleName = "entry";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility", "entry");
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element);
     EXPECT_EQ(ret.empty(), false);
@@ -3694,6 +3766,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_001, TestSi
     abilityRequest.abilityInfo.deviceId = "100";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element);
     EXPECT_EQ(ret.empty(), true);
@@ -3714,6 +3787,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_002, TestSi
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility");
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element);
     EXPECT_EQ(ret.empty(), false);
@@ -3735,6 +3809,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_003, TestSi
     abilityRequest.abilityInfo.moduleName = "entry";
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility", "entry");
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element);
     EXPECT_EQ(ret.empty(), false);
@@ -3759,6 +3834,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_001, T
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::DEFAULT_TYPE;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_NE(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -3783,6 +3859,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_002, T
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::RESERVE_TYPE;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -3807,6 +3884,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_003, T
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::OTHERS_TYPE;
     uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -4173,5 +4251,31 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetContentAndTypeId_005, TestSize.Level1
     int typeId;
     EXPECT_EQ(uiAbilityLifecycleManager->GetContentAndTypeId(msgId, msgContent, typeId), false);
 }
+
+/**
+ * @tc.name: UIAbilityLifecycleManager_GetAbilityRecordByToken_0400
+ * @tc.desc: Verify the token indexes follow an ability closed and then terminated
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordByToken_004, TestSize.Level1)
+{
+    auto uiAbilityLifecycleManager = std::make_shared<UIAbilityLifecycleManager>();
+    ASSERT_NE(uiAbilityLifecycleManager, nullptr);
+    std::shared_ptr<AbilityRecord> abilityRecord = InitAbilityRecord();
+    sptr<IRemoteObject> token = abilityRecord->GetToken();
+    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->sessionTokenIndex_.Add(abilityRecord);
+    EXPECT_EQ(uiAbilityLifecycleManager->GetAbilityRecordByToken(token), abilityRecord);
+
+    abilityRecord->currentState_ = AbilityState::BACKGROUND;
+    EXPECT_EQ(uiAbilityLifecycleManager->CloseUIAbilityInner(abilityRecord, -1, nullptr, false), ERR_OK);
+    EXPECT_EQ(uiAbilityLifecycleManager->sessionTokenIndex_.Size(), 0);
+    EXPECT_EQ(uiAbilityLifecycleManager->GetAbilityRecordByToken(token), abilityRecord);
+
+    abilityRecord->currentState_ = AbilityState::TERMINATING;
+    uiAbilityLifecycleManager->CompleteTerminate(abilityRecord);
+    EXPECT_EQ(uiAbilityLifecycleManager->GetAbilityRecordByToken(token), nullptr);
+    EXPECT_EQ(uiAbilityLifecycleManager->terminateTokenIndex_.Size(), 0);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -1008,5 +1008,62 @@ HWTEST_F(UriPermissionImplTest, CheckUriAuthorization_005, TestSize.Level1)
     std::vector<bool> expectRes(1, true);
     EXPECT_EQ(res, expectRes);
 }
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: SyncUriIndex
+ * SubFunction: NA
+ * FunctionPoints: token and authority indexes follow grant and revoke.
+*/
+HWTEST_F(UriPermissionImplTest, Upms_SyncUriIndex_001, TestSize.Level1)
+{
+    auto upms = std::make_shared<UriPermissionManagerStubImpl>();
+    ASSERT_NE(upms, nullptr);
+    uint32_t flagRead = 1;
+    uint32_t fromTokenId = 1001;
+    uint32_t targetTokenId = 1002;
+    int32_t abilityId = 1;
+    std::string uriStr = "file://com.example.testA/data/storage/el2/base/haps/entry/files/test_A.txt";
+    upms->AddTempUriPermission(uriStr, flagRead, fromTokenId, targetTokenId, abilityId);
+    EXPECT_EQ(upms->tokenUriIndex_[fromTokenId].count(uriStr), 1u);
+    EXPECT_EQ(upms->tokenUriIndex_[targetTokenId].count(uriStr), 1u);
+    EXPECT_EQ(upms->authorityUriIndex_["com.example.testA"].count(uriStr), 1u);
+
+    std::vector<std::string> uriList;
+    upms->RemoveUriRecord(uriList, targetTokenId, abilityId);
+    EXPECT_EQ(uriList.size(), 1u);
+    EXPECT_TRUE(upms->uriMap_.empty());
+    EXPECT_TRUE(upms->tokenUriIndex_.empty());
+    EXPECT_TRUE(upms->uriTokenIndex_.empty());
+    EXPECT_TRUE(upms->authorityUriIndex_.empty());
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: VerifySubDirUriPermission
+ * SubFunction: NA
+ * FunctionPoints: distributed sub directory uri is verified by the granted ancestor.
+*/
+HWTEST_F(UriPermissionImplTest, Upms_VerifySubDirUriPermission_001, TestSize.Level1)
+{
+    auto upms = std::make_shared<UriPermissionManagerStubImpl>();
+    ASSERT_NE(upms, nullptr);
+    uint32_t flagRead = 1;
+    uint32_t fromTokenId = 1001;
+    uint32_t targetTokenId = 1002;
+    std::string dirUri = "file://docs/storage/Users/currentUser/Documents?networkid=test";
+    std::string subUri = "file://docs/storage/Users/currentUser/Documents/a/test.txt?networkid=test";
+    std::string otherUri = "file://docs/storage/Users/currentUser/Download/test.txt?networkid=test";
+    upms->AddTempUriPermission(dirUri, flagRead, fromTokenId, targetTokenId, DEFAULT_ABILITY_ID);
+    EXPECT_TRUE(upms->VerifySubDirUriPermission(subUri, flagRead, targetTokenId));
+    EXPECT_FALSE(upms->VerifySubDirUriPermission(subUri, flagRead, fromTokenId));
+    EXPECT_FALSE(upms->VerifySubDirUriPermission(otherUri, flagRead, targetTokenId));
+    EXPECT_FALSE(upms->VerifySubDirUriPermission(dirUri, flagRead, targetTokenId));
+
+    upms->uriMap_.clear();
+    upms->SyncUriIndex(dirUri);
+    EXPECT_TRUE(upms->distributedUriTrie_.children.empty());
+    EXPECT_FALSE(upms->VerifySubDirUriPermission(subUri, flagRead, targetTokenId));
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -16,6 +16,8 @@
 #ifndef OHOS_ABILITY_RUNTIME_FREEZE_UTIL_H
 #define OHOS_ABILITY_RUNTIME_FREEZE_UTIL_H
 
+#include <array>
+#include <deque>
 #include <mutex>
 #include <unordered_map>
 
@@ -24,6 +26,9 @@
 namespace OHOS::AbilityRuntime {
 class FreezeUtil {
 public:
+    // entries kept per flow, older entries are dropped once a flow grows beyond it.
+    static constexpr size_t MAX_LIFECYCLE_EVENT_NUM = 64;
+
     enum class TimeoutState {
         UNKNOWN = 0,
         LOAD,
@@ -52,8 +57,10 @@ public:
     void DeleteLifecycleEvent(sptr<IRemoteObject> token);
 
 private:
+    // flows are spread over shards by token, so all states of a token share one shard.
+    static constexpr size_t LIFECYCLE_FLOW_SHARD_NUM = 8;
+
     FreezeUtil() = default;
-    void DeleteLifecycleEventInner(const LifecycleFlow &flow);
 
     class LifecycleFlowObjHash {
     public:
@@ -63,8 +70,15 @@ private:
         }
     };
 
-    std::mutex mutex_;
-    std::unordered_map<LifecycleFlow, std::string, LifecycleFlowObjHash> lifecycleFlow_;
+    struct LifecycleFlowShard {
+        std::mutex mutex;
+        std::unordered_map<LifecycleFlow, std::deque<std::string>, LifecycleFlowObjHash> lifecycleFlow;
+    };
+
+    LifecycleFlowShard &GetShard(const sptr<IRemoteObject> &token);
+    void DeleteLifecycleEventInner(LifecycleFlowShard &shard, const LifecycleFlow &flow);
+
+    std::array<LifecycleFlowShard, LIFECYCLE_FLOW_SHARD_NUM> shards_;
 };
 }  // namespace OHOS::AbilityRuntime
 #endif  // OHOS_ABILITY_RUNTIME_FREEZE_UTIL_H
\ No newline at end of file
@@ -24,50 +24,72 @@ FreezeUtil& FreezeUtil::GetInstance()
     return instance;
 }
 
+FreezeUtil::LifecycleFlowShard &FreezeUtil::GetShard(const sptr<IRemoteObject> &token)
+{
+    // drop the low bits, they are the same for every heap object.
+    auto key = reinterpret_cast<uintptr_t>(token.GetRefPtr()) >> 4;
+    return shards_[key % LIFECYCLE_FLOW_SHARD_NUM];
+}
+
 void FreezeUtil::AddLifecycleEvent(const LifecycleFlow &flow, const std::string &entry)
 {
-    std::lock_guard lock(mutex_);
-    if (lifecycleFlow_.count(flow)) {
-        lifecycleFlow_[flow] = lifecycleFlow_[flow] + "\n" + entry;
-    } else {
-        lifecycleFlow_[flow] = entry;
+    auto &shard = GetShard(flow.token);
+    std::lock_guard lock(shard.mutex);
+    auto &entries = shard.lifecycleFlow[flow];
+    if (entries.size() >= MAX_LIFECYCLE_EVENT_NUM) {
+        entries.pop_front();
     }
+    entries.push_back(entry);
 }
 
 std::string FreezeUtil::GetLifecycleEvent(const LifecycleFlow &flow)
 {
-    std::lock_guard lock(mutex_);
-    auto search = lifecycleFlow_.find(flow);
-    if (search != lifecycleFlow_.end()) {
-        return search->second;
+    auto &shard = GetShard(flow.token);
+    std::lock_guard lock(shard.mutex);
+    auto search = shard.lifecycleFlow.find(flow);
+    if (search == shard.lifecycleFlow.end()) {
+        return "";
     }
-    return "";
+    const auto &entries = search->second;
+    size_t length = entries.size();
+    for (const auto &entry : entries) {
+        length += entry.size();
+    }
+    std::string result;
+    result.reserve(length);
+    for (auto iter = entries.begin(); iter != entries.end(); iter++) {
+        if (iter != entries.begin()) {
+            result.append("\n");
+        }
+        result.append(*iter);
+    }
+    return result;
 }
 
 void FreezeUtil::DeleteLifecycleEvent(const LifecycleFlow &flow)
 {
-    std::lock_guard lock(mutex_);
-    DeleteLifecycleEventInner(flow);
+    auto &shard = GetShard(flow.token);
+    std::lock_guard lock(shard.mutex);
+    DeleteLifecycleEventInner(shard, flow);
 }
 
 void FreezeUtil::DeleteLifecycleEvent(sptr<IRemoteObject> token)
 {
-    std::lock_guard lock(mutex_);
-    if (lifecycleFlow_.empty()) {
+    auto &shard = GetShard(token);
+    std::lock_guard lock(shard.mutex);
+    if (shard.lifecycleFlow.empty()) {
         return;
     }
     LifecycleFlow foregroundFlow = { token, TimeoutState::FOREGROUND };
-    DeleteLifecycleEventInner(foregroundFlow);
+    DeleteLifecycleEventInner(shard, foregroundFlow);
 
     LifecycleFlow backgroundFlow = { token, TimeoutState::BACKGROUND };
-    DeleteLifecycleEventInner(backgroundFlow);
+    DeleteLifecycleEventInner(shard, backgroundFlow);
 }
 
-void FreezeUtil::DeleteLifecycleEventInner(const LifecycleFlow &flow)
+void FreezeUtil::DeleteLifecycleEventInner(LifecycleFlowShard &shard, const LifecycleFlow &flow)
 {
-    if (lifecycleFlow_.count(flow)) {
-        lifecycleFlow_.erase(flow);
-    }
-    TAG_LOGD(AAFwkTag::DEFAULT, "lifecycleFlow_ size: %{public}zu", lifecycleFlow_.size());
+    shard.lifecycleFlow.erase(flow);
+    TAG_LOGD(AAFwkTag::DEFAULT, "lifecycleFlow size: %{public}zu", shard.lifecycleFlow.size());
 }
 }  // namespace OHOS::AbilityRuntime